@@ -23,6 +23,8 @@
 #include <algorithm>
 #include <unordered_set>
 #include <atomic>
+#include <cstdint>
+#include <functional>
 
 // 条件包含不同平台的套接字库
 #ifdef AntonaStandard_PLATFORM_WINDOWS
@@ -34,6 +36,9 @@
     #include <sys/types.h>
     #include <arpa/inet.h>
     #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <netinet/tcp.h>
+    #include <netinet/udp.h>
     #define INVALID_SOCKET ~0
 #endif
 
@@ -52,9 +57,6 @@
 namespace AntonaStandard{
     namespace CPS{
         class SocketAddress;
-        class SocketAddressImp;
-        class SocketAddressV4Imp;
-        class SocketAddressV6Imp;
         class SocketDataBuffer;
         class SocketLibraryManager;
         class SocketManager;
@@ -103,20 +105,51 @@ namespace AntonaStandard::CPS{
     /**
      * @brief 套接字选项
      * @details 
-     *      套接字选项用于指定是否允许套接字进行端口复用和地址复用。详情可见getSocketOption 函数和 setSocketOption 函数
+     *      套接字选项用于调整套接字的行为，例如端口复用和地址复用、缓冲区大小、TCP 的延迟确认和 Nagle 算法等。
+     *      不同的选项作用于不同的层，设置时需要搭配对应的 SocketLevel：注释中标有 TCP_level 的选项作用于TCP层，
+     *      其余选项作用于 Socket_level。除特别说明外选项的值都是 int。详情可见getSocketOption 函数和 setSocketOption 函数
      * @see 
      *      void AntonaStandard::CPS::SocketLibraryManager::setSocketOption(const SocketFd& fd,SocketLevel level,SocketOptions option,const void* optval,socklen_t optlen)
      *      void AntonaStandard::CPS::SocketLibraryManager::getSocketOption(const SocketFd& fd,SocketLevel level,SocketOptions option,void* accept_optval,socklen_t* accept_optlen)
      */
     enum SocketOptions{            // 套接字选项
-        // ReusePort = SO_REUSEPORT,     // 允许端口复用
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            ReusePort = SO_REUSEPORT,       ///< 允许多个套接字绑定同一地址和端口，由内核在它们之间分配连接，仅 Linux 平台支持
+        #endif
         ReuseAddress = SO_REUSEADDR,        ///< 允许地址和端口复用
-        // KeepAlive = SO_KEEPALIVE,       // 保持连接
-        // NoDelay = TCP_NODELAY,         // 禁用Nagle算法
+        KeepAlive = SO_KEEPALIVE,           ///< 保持连接，定期发送探测报文
+        SendBuffer = SO_SNDBUF,             ///< 发送缓冲区大小，Linux 内核会把设置的值翻倍
+        ReceiveBuffer = SO_RCVBUF,          ///< 接收缓冲区大小，Linux 内核会把设置的值翻倍
+        NoDelay = TCP_NODELAY,              ///< TCP_level，禁用 Nagle 算法，小数据包立即发送
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            BusyPoll = SO_BUSY_POLL,        ///< 接收时忙轮询网卡队列的微秒数，以 CPU 换取更低的延迟，增大该值需要 CAP_NET_ADMIN
+            IncomingCpu = SO_INCOMING_CPU,  ///< 处理该套接字接收数据的 CPU，设置在监听套接字上可以让连接分配给对应 CPU 上的线程
+            QuickAck = TCP_QUICKACK,        ///< TCP_level，立即发送确认而不是延迟确认。内核可能在之后自动恢复延迟确认，需要时应重新设置
+            Cork = TCP_CORK,                ///< TCP_level，积攒数据直到凑满一个报文段或者取消该选项，用于合并头部和正文
+            FastOpen = TCP_FASTOPEN,        ///< TCP_level，监听套接字上开启 TCP Fast Open，值为等待完成握手的请求队列长度
+            FastOpenConnect = TCP_FASTOPEN_CONNECT,   ///< TCP_level，客户端在 connect 时使用 TCP Fast Open，必须在连接之前设置
+            ZeroCopy = SO_ZEROCOPY,         ///< 允许以 MSG_ZEROCOPY 发送，否则内核忽略该标志
+            UdpSegment = UDP_SEGMENT,       ///< UDP_level，默认的 GSO 分段大小，为 0 时不分段。详见 SocketLibraryManager::sendToSegmented
+            UdpGro = UDP_GRO,               ///< UDP_level，接收时允许内核把同一来源的连续数据报合并，详见 SocketLibraryManager::receiveFromCoalesced
+        #endif
         /*其它选项后续用到再添加*/
         InvalidOption = ~0,                 ///< 无效的套接字选项
     };
 
+    /**
+     * @brief 发送和接收数据时的标志，可以按位或组合
+     * @details 
+     *      作为 send、sendTo、receive、receiveFrom 的 flags 参数使用
+     */
+    enum MessageFlags{
+        NoFlags = 0,                        ///< 不使用任何标志
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            More = MSG_MORE,                ///< 还有后续数据，暂不发出报文段，与 TCP_CORK 作用相同但只影响这一次发送
+            DontWait = MSG_DONTWAIT,        ///< 本次调用不阻塞
+            NoSignal = MSG_NOSIGNAL,        ///< 对端关闭时不产生 SIGPIPE 信号
+        #endif
+    };
+
     /**
      * @brief 套接字选项作用的层
      * @details 
@@ -130,6 +163,7 @@ namespace AntonaStandard::CPS{
         Socket_level = SOL_SOCKET,          ///< 套接字层
         IP_level = IPPROTO_IP,              ///< IP层
         TCP_level = IPPROTO_TCP,            ///< TCP层
+        UDP_level = IPPROTO_UDP,            ///< UDP层
         InvalidLevel = ~0,                  ///< 无效层
     };
 
@@ -159,6 +193,22 @@ namespace AntonaStandard::CPS{
         InvalidShutdownOption = ~0,
     };
 
+#ifdef AntonaStandard_PLATFORM_LINUX
+    /**
+     * @brief 一条零拷贝发送的完成通知
+     * @details
+     *      内核为每一次成功的 MSG_ZEROCOPY 发送调用分配一个从 0 开始递增的 32 位编号，
+     *      发送的数据不再被引用之后通过错误队列通知，相邻的通知可能合并为一个编号区间
+     * @see
+     *      bool AntonaStandard::CPS::SocketLibraryManager::readZeroCopyCompletion(const SocketFd&,ZeroCopyCompletion&)
+     */
+    struct ZeroCopyCompletion{
+        std::uint32_t first = 0;        ///< 区间内第一个发送调用的编号
+        std::uint32_t last = 0;         ///< 区间内最后一个发送调用的编号（包含）
+        bool copied = false;            ///< 内核退化为拷贝发送，例如环回地址或者网卡不支持
+    };
+#endif
+
 
     /**
      * @brief 套接字文件描述符的封装，本质是原子类，用于解决可能的条件竞争问题
@@ -177,169 +227,34 @@ namespace AntonaStandard::CPS{
     #endif
     
     /**
-     * @brief 套接字地址封装类 SocketAddress 的实现接口类
+     * @brief 套接字地址类，以值语义内联存储地址结构体
      * @details 
-     *      Windows 和 Linux 平台的套接字通信库中是通过一个名为 `sockaddr_t` 的结构体指针来传递存储IP地址的结构体的
-     *      `sockaddr_in` 和 `sockaddr_in6` 结构体分别用于存储IPV4地址和IPV6。`sockaddr_t` 相当于一个接口类，
-     *      而 `sockaddr_in` 和 `sockaddr_in6` 相当于实现类，当传递它们的指针时需要强制转化成 `sockaddr_t` 的指针
-     *      同时还需要传入结构体的大小，对应的系统API内部会根据结构体大小，判断具体的类型是 `sockaddr_in` 还是 `sockaddr_in6`
-     *      这相当于用C语言实现了简单但巧妙地多态。另外本类中没有纯虚函数，也就是说本类不是抽象类，是可以实例化的。原因是
-     *      SocketAddress 类中有一个imp 成员共享指针变量指向具体的 SocketAddressImp 派生类。SocketAddress 所有的对外接口
-     *      都需要通过这个指针访问具体的 SocketAddressImp 派生类的接口，如果创建SocketAddress 时指定的ip地址无效或者其它问题导致
-     *      没有成功创建 SocketAddressImp 派生类的实例，那么需要为它设置一个默认指针，而设置成空指针会增大判断成本以及会造成访问空指针的
-     *      异常。因此没有成功创建派生类的实例时会创建 SocketAddressImp 的实例，它的接口会返回一些无效值，这样在使用它的其它函数中会对这些无效值
-     *      进行处理。
-     * @see
-     *      AntonaStandard::CPS::SocketAddress
+     *      Windows 和 Linux 平台的套接字通信库中是通过一个名为 `sockaddr` 的结构体指针来传递存储IP地址的结构体的，
+     *      `sockaddr_in` 和 `sockaddr_in6` 结构体分别用于存储IPV4地址和IPV6，系统API根据传入的结构体大小区分它们。
+     *      
+     *      本类直接在对象内部存放一个 `sockaddr_storage`，它足以容纳任何一种地址结构体，另外记录有效长度。
+     *      拷贝、移动以及 accept 和 receiveFrom 填写远端地址都不需要分配堆内存，也没有引用计数的原子操作。
+     *      有效长度为 0 或者地址簇不是 ipv4 和 ipv6 的实例是无效地址，它的接口会返回一些无效值。
+     *      
+     *      相等比较、排序和哈希只考虑地址簇、IP、端口以及 ipv6 的 scope id，不受结构体中填充字节的影响，
+     *      因此可以直接作为 `std::unordered_map` 或者 `std::map` 的键，例如按对端地址管理UDP会话
      */
-    class SocketAddressImp{
-    protected:
-        /**
-         * @brief 存储系统API需要使用的地址结构体指针
-         * @details
-         *      这里使用空类型指针存储真实的地址结构体，因为任何类型的指针都可以自动转化为空类型指针。这样可以根据具体的实现类
-         *      中的构造函数为 addr_in 变量赋值 `sockaddr_in` 或 `sockaddr_in6` 结构体的指针。另外为了避免可能产生的内存泄露
-         *      问题，这里使用共享指针来管理内存释放。
-         */
-        std::shared_ptr<void> addr_in;      
-    public:
-        SocketAddressImp()=default;         ///< 使用默认生成的默认构造函数
-        /**
-         * @brief 获取 addr_in 成员变量
-         * @return std::shared_ptr<void> 
-         */
-        inline std::shared_ptr<void> getAddrIn()const{
-            return addr_in;
+    class SocketAddress{
+    private:
+        sockaddr_storage storage;       ///< 内联存储的地址结构体
+        socklen_t length;               ///< storage 中有效的字节数，0 表示无效地址
+        
+        inline const sockaddr_in* v4()const{
+            return reinterpret_cast<const sockaddr_in*>(&this->storage);
+        }
+        inline const sockaddr_in6* v6()const{
+            return reinterpret_cast<const sockaddr_in6*>(&this->storage);
         }
         /**
-         * @brief 获取 addr_in 成员指向的具体结构体的大小
-         * @return size_t 
-         */
-        virtual size_t getAddrInSize()const;
-        /**
-         * @brief 设置地址和端口 
-         * @details
-         *      该函数会调用系统API `inet_addr` 在addr_in 指向的地址结构体中写入地址，调用
-         *      系统API `htons` 向addr_in 指向的地址结构体中写入端口号。另外该函数不会检查
-         *      地址字符串和端口是否合法。对地址字符串和端口的检查会在使用该类实例的时候进行
-         * @param ip ip 地址字符串
-         * @param port 端口号
-         */
-        virtual void setAddr(const char* ip,
-                                unsigned short port);
-        /**
-         * @brief 获取地址字符串
-         * @details
-         *      该函数会调用系统API `inet_ntop` 从addr_in 指向的地址结构体中解析地址字符串
-         * @return std::string 
-         */
-        virtual std::string getIP()const;
-        /**
-         * @brief 获取端口
-         * @details
-         *      该函数会调用系统API `ntohs` 从addr_in 指向的地址结构体中解析端口号
-         * @return unsigned short 
-         */
-        virtual unsigned short getPort()const;
-        /**
-         * @brief 获取该实例的地址簇协议 
-         * @return AddressFamily 
-         * @see AntonaStandard::CPS::AddressFamily
-         */
-        virtual AddressFamily getAddressFamily()const;
-        virtual ~SocketAddressImp()=default;        ///< 生成默认析构函数，并声明为虚函数
-        /**
-         * @brief 深拷贝当前实例，并以共享指针的形式返回
-         * @return std::shared_ptr<SocketAddressImp> 
-         */
-        virtual std::shared_ptr<SocketAddressImp> copy();
-        /**
-         * @brief 根据地址结构体来构造SocketAddressImp派生类
-         * @details
-         *      SocketAddressImp 及其派生类的工厂函数，会根据 `addr_len` 的长度判断传入的 `addr` 指向的是
-         *      `sockaddr_in` 还是 `sockaddr_in6`。内部通过 `memcpy` 函数进行基于位的拷贝
-         * @param addr          地址结构体的指针
-         * @param addr_len      地址结构体的大小
-         * @return std::shared_ptr<SocketAddressImp> 
-         *  @retval
-         *      std::shared_ptr<SocketAddressImp>       如果 `addr_len` 的长度与 `sockaddr_in`或 `sockaddr_in6` 都不相等。或者addr为空指针
-         *  @retval
-         *      std::shared_ptr<SocketAddressV4Imp>     如果 `addr_len` 的长度与 `sockaddr_in` 相等
-         *  @retval
-         *      std::shared_ptr<SocketAddressV6Imp>     如果 `addr_len` 的长度与 `sockaddr_in6` 相等
-         */
-        static std::shared_ptr<SocketAddressImp> create(const sockaddr* addr,socklen_t addr_len);
-    };
-
-    /**
-     * @brief 套接字地址封装类 SocketAddress 的实现类，派生自 SocketAddresssImp，存储 ipv4 地址
-     * @details
-     *      该类派生自 SocketAddressImp 存储和维护一个指向 `sockaddr_in` 的共享指针
-     */
-    class SocketAddressV4Imp:public SocketAddressImp{
-    public:
-        /**
-         * @brief 默认构造函数
-         * @details
-         *      其内部会调用 std::make_shared<sockaddr_in> 构建一个可以存储ipv4地址的结构体，并将其地址赋值给 addr_in
-         */
-        SocketAddressV4Imp();                  
-        SocketAddressV4Imp(SocketAddressV4Imp& addr);           ///< 拷贝构造函数
-        SocketAddressV4Imp(SocketAddressV4Imp&& addr);          ///< 移动构造函数
-        ~SocketAddressV4Imp()=default;                          
-        virtual size_t getAddrInSize()const override;           
-        virtual void setAddr(const char* ip,
-                                unsigned short port)override;
-        /**
-         * @throw
-         *      std::runtime_error 如果从地址结构体中解析地址字符串时失败了会抛出该异常
-         */
-        virtual std::string getIP()const override;
-        virtual unsigned short getPort()const override;
-        virtual AddressFamily getAddressFamily()const override;
-        /**
-         * @return std::shared_ptr<SocketAddressImp> 
-         *  @retval std::shared_ptr<SocketAddressV4Imp> 重写后实际返回的
-         */
-        virtual std::shared_ptr<SocketAddressImp> copy()override;
-    };
-
-    /**
-     * @brief 套接字地址封装类 SocketAddress 的实现类，派生自 SocketAddresssImp，存储 ipv6 地址
-     * @details
-     *      该类派生自 SocketAddressImp 存储和维护一个指向 `sockaddr_in6` 的共享指针
-     */
-    class SocketAddressV6Imp:public SocketAddressImp{
-    public:
-        SocketAddressV6Imp();                
-        SocketAddressV6Imp(SocketAddressV6Imp& addr);          ///< 拷贝构造函数 
-        SocketAddressV6Imp(SocketAddressV6Imp&& addr);         ///< 移动构造函数
-        ~SocketAddressV6Imp()=default;
-        virtual size_t getAddrInSize()const override;
-        virtual void setAddr(const char* ip,
-                                unsigned short port)override;
-        /**
-         * @throw
-         *      std::runtime_error 如果从地址结构体中解析地址字符串时失败了会抛出该异常
-         */
-        virtual std::string getIP()const override;
-        virtual unsigned short getPort()const override;
-        virtual AddressFamily getAddressFamily()const override;
-        /**
-         * @return std::shared_ptr<SocketAddressImp> 
-         *  @retval std::shared_ptr<SocketAddressV6Imp> 重写后实际返回的
+         * @brief 三路比较，用于实现比较运算符
+         * @details 先比较地址簇，再依次比较IP、端口和 scope id。所有无效地址都相等
          */
-        virtual std::shared_ptr<SocketAddressImp> copy()override;
-    };
-
-    /**
-     * @brief 套接字地址类，通过 Pimpl 策略隐藏了具体的实现细节
-     * @details 
-     *      为了向上提供简单的功能，这里采用 Pimpl 策略隐藏具体的实现细节。所有的功能委托给 `SocketAddresImp` 及其派生类实现
-     */
-    class SocketAddress{
-    private:
-        std::shared_ptr<SocketAddressImp> imp;      ///< 指向实现类的指针
+        int compare(const SocketAddress& other)const noexcept;
     public: 
         /**
          * @brief 根据地址簇协议、地址字符串以及端口构造实例
@@ -348,79 +263,143 @@ namespace AntonaStandard::CPS{
          * @param port 
          * 
          * @details
-         *      该函数不会检查ip_type 、ip以及 port 的合法性
+         *      该函数不会检查 ip 以及 port 的合法性，ip_type 不是 ipv4 或 ipv6 时构造出无效地址
+         */
+        SocketAddress(AddressFamily ip_type,const std::string& ip,unsigned short port);
+        /**
+         * @brief 根据系统API返回的地址结构体构造实例
+         * @details 
+         *      内部通过 `memcpy` 函数进行基于位的拷贝。addr 为空指针或者 addr_len 超过 `sockaddr_storage` 的大小时构造出无效地址
+         * @param addr          地址结构体的指针
+         * @param addr_len      地址结构体的大小
          */
-        SocketAddress(AddressFamily ip_type,std::string ip,unsigned short port);
-        SocketAddress(const SocketAddress&);            ///< 拷贝构造函数
-        void swap(SocketAddress&);                      ///< 与参数所指对象交换imp
-        const SocketAddress& operator=(const SocketAddress&);
-        SocketAddress(SocketAddress&&);                 ///< 移动构造函数
-        const SocketAddress& operator=(SocketAddress&&);
+        SocketAddress(const sockaddr* addr,socklen_t addr_len);
         /**
-         * @brief 默认构造函数，由于未指定地址簇。默认为imp构造一个SocketAddressImp 实例
+         * @brief 默认构造函数，由于未指定地址簇，构造出无效地址
          */
-        SocketAddress():imp(std::make_shared<SocketAddressImp>()){};
+        SocketAddress()noexcept:storage(),length(0){};
+        SocketAddress(const SocketAddress&)=default;
+        SocketAddress& operator=(const SocketAddress&)=default;
         ~SocketAddress()=default;
+        void swap(SocketAddress&)noexcept;               ///< 与参数所指对象交换地址
         /**
-         * @brief 获取指向地址结构体的指针
-         * @details
-         *      具体功能委托给 SocketAddressImp::getAddrIn() 实现
-         * @return const std::shared_ptr<void> 
+         * @brief 获取指向地址结构体的指针，用于传递给系统API
+         * @return const sockaddr* 
          */
-        inline const std::shared_ptr<void> getAddrIn()const{
-            return this->imp->getAddrIn();
+        inline const sockaddr* getAddrIn()const{
+            return reinterpret_cast<const sockaddr*>(&this->storage);
         }
         /**
          * @brief 获取地址结构体的大小
-         * @details 
-         *      具体功能委托给 SocketAddressImp::getAddrInSize() 实现
          * @return socklen_t 
          */
         inline socklen_t getAddrInSize()const{
-            return this->imp->getAddrInSize();
+            return this->length;
+        }
+        /**
+         * @brief 获取可写的地址结构体，供 accept 和 recvfrom 等系统API直接写入
+         * @details 写入之后需要调用 setAddrInSize 设置系统API返回的长度
+         * @return sockaddr* 
+         */
+        inline sockaddr* getAddrInBuffer(){
+            return reinterpret_cast<sockaddr*>(&this->storage);
+        }
+        /// @brief 地址结构体的最大长度，即 `sockaddr_storage` 的大小
+        static constexpr socklen_t getAddrInCapacity(){
+            return sizeof(sockaddr_storage);
+        }
+        /**
+         * @brief 设置系统API写入的地址结构体的长度
+         * @details 超过 getAddrInCapacity() 的长度视为无效地址
+         * @param addr_len 
+         */
+        inline void setAddrInSize(socklen_t addr_len){
+            this->length = addr_len <= getAddrInCapacity() ? addr_len : 0;
         }
         /**
          * @brief 获取地址簇协议
-         * @details
-         *      具体功能委托给 SocketAddressImp::getAddressFamily() 实现
          * @return AddressFamily 
+         *  @retval AddressFamily::invalid 无效地址
          */
         inline AddressFamily getAddressFamily()const{
-            return this->imp->getAddressFamily();
+            if(this->length >= sizeof(sockaddr_in6) && this->storage.ss_family == AF_INET6){
+                return AddressFamily::ipv6;
+            }
+            if(this->length >= sizeof(sockaddr_in) && this->storage.ss_family == AF_INET){
+                return AddressFamily::ipv4;
+            }
+            return AddressFamily::invalid;
+        }
+        /// @brief 是否是有效的 ipv4 或 ipv6 地址
+        inline bool isValid()const{
+            return this->getAddressFamily() != AddressFamily::invalid;
         }
         /**
          * @brief 获取IP地址字符串
          * @details
-         *      具体功能委托给 SocketAdddress::getAddressFamily() 实现
+         *      该函数会调用系统API `inet_ntop` 从地址结构体中解析地址字符串，无效地址返回空字符串
          * @return std::string 
+         * @throw
+         *      std::runtime_error 如果从地址结构体中解析地址字符串时失败了会抛出该异常
          */
-        inline std::string getIP()const{
-            return this->imp->getIP();
-        }
+        std::string getIP()const;
         /**
-         * @brief 获取端口号
-         * @details
-         *      具体功能委托给 SocketAddress::getPort() 实现
+         * @brief 获取端口号，无效地址返回 0
          * @return unsigned short 
          */
         inline unsigned short getPort()const{
-            return this->imp->getPort();
+            switch(this->getAddressFamily()){
+                case AddressFamily::ipv4:
+                    return ntohs(this->v4()->sin_port);
+                case AddressFamily::ipv6:
+                    return ntohs(this->v6()->sin6_port);
+                default:
+                    return 0;
+            }
         }
         /**
-         * @brief 设置实现类
-         * 
-         * @param imp 
+         * @brief 计算哈希值
+         * @details
+         *      ipv4 地址把IP、端口和地址簇拼成一个64位整数，ipv6 地址把16字节IP按两个64位整数读出，
+         *      再与端口和 scope id 混合，最后经过 splitmix64 的终结函数打散。与 operator== 一致：相等的地址哈希值相同
+         * @return size_t 
          */
-        inline void setImp(std::shared_ptr<SocketAddressImp> imp){
-            this->imp = imp;
+        inline size_t hash()const noexcept{
+            auto mix = [](uint64_t x){
+                x ^= x >> 30;
+                x *= 0xbf58476d1ce4e5b9ULL;
+                x ^= x >> 27;
+                x *= 0x94d049bb133111ebULL;
+                x ^= x >> 31;
+                return x;
+            };
+            switch(this->getAddressFamily()){
+                case AddressFamily::ipv4:{
+                    uint64_t key = (uint64_t(this->v4()->sin_addr.s_addr) << 32) |
+                        (uint64_t(this->v4()->sin_port) << 16) | AF_INET;
+                    return static_cast<size_t>(mix(key));
+                }
+                case AddressFamily::ipv6:{
+                    uint64_t high = 0;
+                    uint64_t low = 0;
+                    std::memcpy(&high,&this->v6()->sin6_addr,sizeof(high));
+                    std::memcpy(&low,reinterpret_cast<const char*>(&this->v6()->sin6_addr) + sizeof(high),sizeof(low));
+                    uint64_t tail = (uint64_t(this->v6()->sin6_scope_id) << 32) |
+                        (uint64_t(this->v6()->sin6_port) << 16) | AF_INET6;
+                    return static_cast<size_t>(mix(high ^ mix(low ^ mix(tail))));
+                }
+                default:
+                    return 0;
+            }
         }
-        /**
-         * @brief 获取实现类的指针
-         * 
-         * @return const std::shared_ptr<SocketAddressImp> 
-         */
-        inline const std::shared_ptr<SocketAddressImp> getImp()const{
-            return this->imp;
+        inline bool operator==(const SocketAddress& other)const noexcept{
+            return this->compare(other) == 0;
+        }
+        inline bool operator!=(const SocketAddress& other)const noexcept{
+            return this->compare(other) != 0;
+        }
+        inline bool operator<(const SocketAddress& other)const noexcept{
+            return this->compare(other) < 0;
         }
     public:
         /**
@@ -431,7 +410,7 @@ namespace AntonaStandard::CPS{
          */
         static SocketAddress loopBackAddress(unsigned short port,AddressFamily ip_type=AddressFamily::ipv4);
         /**
-         * @brief 获取一个空地址，本质是一个实现类实例是 SocketAddressImp 的 SocketAddress 实例
+         * @brief 获取一个空地址，即无效地址
          * @return SocketAddress 
          */
         static SocketAddress emptyAddress();
@@ -443,6 +422,10 @@ namespace AntonaStandard::CPS{
          */
         static SocketAddress anyAddress(unsigned short port,AddressFamily ip_type=AddressFamily::ipv4);
     };
+
+    inline void swap(SocketAddress& lhs,SocketAddress& rhs)noexcept{
+        lhs.swap(rhs);
+    }
     
     /**
      * @brief 缓冲套接字通信过程中的数据
@@ -594,6 +577,68 @@ namespace AntonaStandard::CPS{
         inline void movePutPos(size_t size){
             this->pbump(size);
         }
+        /**
+         * @brief 保证可写入的剩余空间不小于 size
+         * @details
+         *      空间不足时按照二倍扩容，扩容后之前获取的 receivingPos() 等指针会失效
+         * @param size 
+         */
+        inline void ensureReceivableSize(size_t size){
+            if(this->getReceivableSize() >= size){
+                return;
+            }
+            size_t required = this->getSendableSize() + size;
+            this->resize(std::max(required,(this->buffer.size()-1)*2));
+        }
+        /**
+         * @brief 将一段内存追加到写入位点之后，空间不足时自动扩容
+         * @param data 
+         * @param size 
+         */
+        inline void append(const void* data,size_t size){
+            this->ensureReceivableSize(size);
+            std::memcpy(this->pptr(),data,size);
+            this->pbump(size);
+        }
+        /**
+         * @brief 获取读取位点
+         * @details 即 gptr，readingPos() 到 receivingPos() 之间是已经写入但还没有读取的数据
+         * @return char* 
+         */
+        inline char* readingPos()const{
+            return this->gptr();
+        }
+        /**
+         * @brief 获取可读取的数据大小
+         * @details 即写入位点减去读取位点
+         * @return size_t 
+         */
+        inline size_t getReadableSize()const{
+            return this->pptr()-this->gptr();
+        }
+        /**
+         * @brief 移动读取位点，size 不能大于 getReadableSize()
+         * @param size 
+         */
+        inline void moveGetPos(size_t size){
+            this->setg(this->eback(),this->gptr()+size,this->pptr());
+        }
+        /**
+         * @brief 丢弃已经读取的数据，把尚未读取的数据移动到缓冲区开头
+         * @details
+         *      按帧解析时，读取位点之前是已经处理完的帧，之后是不完整的帧。在接收更多数据之前压缩缓冲区，
+         *      只需要移动不完整的部分，缓冲区不会无限增长。之前获取的 readingPos() 等指针会失效
+         */
+        inline void compact(){
+            size_t readable = this->getReadableSize();
+            if(this->gptr() == this->pbase()){
+                return;
+            }
+            std::memmove(this->pbase(),this->gptr(),readable);
+            this->setp(&(this->buffer.front()),&(this->buffer.back()));
+            this->pbump(readable);
+            this->setg(this->pbase(),this->pbase(),this->pptr());
+        }
     };
     /**
      * @brief 套接字库管理器
@@ -693,6 +738,16 @@ namespace AntonaStandard::CPS{
          *      std::runtime_error 接受套接字连接失败时可能抛出该异常，异常消息中包含平台相关的错误码，可以查看对应平台的文档跟踪异常
          */
         SocketFd accept(const SocketFd& listen_fd,SocketAddress& remote_addr);
+        /**
+         * @brief 获取套接字文件描述符实际绑定的本地地址
+         * @details
+         *      系统API getsockname 的简单封装。绑定时端口为 0 的套接字由系统分配端口，可以通过该函数查询
+         * @param fd        已经绑定或连接的套接字文件描述符
+         * @return SocketAddress 
+         * @throw
+         *      std::runtime_error 查询失败时可能抛出该异常，异常消息中包含平台相关的错误码
+         */
+        SocketAddress getLocalAddress(const SocketFd& fd);
         /**
          * @brief TCP 通信专用，用于接收远端发送来的数据
          * 
@@ -739,6 +794,127 @@ namespace AntonaStandard::CPS{
          *      std::runtime_error 发送数据失败时可能抛出该异常，异常消息中包含平台相关的错误码，可以查看对应平台的文档跟踪异常
          */
         size_t sendTo(const SocketFd& communication_fd,const SocketDataBuffer& buffer,const SocketAddress& remote_addr,int flags=0);
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        /**
+         * @brief TCP 通信专用，在内核中把文件内容直接发送到套接字，数据不经过用户空间
+         * @details
+         *      普通文件使用 sendfile，管道使用 splice（此时忽略 offset）。单次调用可能只发送一部分，
+         *      非阻塞套接字的发送缓冲区已满（或管道暂时为空）时返回 0 而不是抛出异常，调用方应在套接字可写时继续发送；
+         *      阻塞套接字会等待管道的写端写入数据
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param file_fd           需要发送的文件的文件描述符
+         * @param offset            文件中的起始位置，返回时指向发送的最后一个字节之后
+         * @param count             最多发送的字节数
+         * @return size_t           实际发送的字节数
+         * @throw
+         *      std::runtime_error  发送失败，或者在发送完 count 个字节之前读到了文件末尾
+         */
+        size_t sendFile(const SocketFd& communication_fd,int file_fd,std::uint64_t& offset,size_t count);
+        /**
+         * @brief 设置套接字是否为非阻塞模式
+         * @details 非阻塞模式下没有数据可读或发送缓冲区已满时系统调用立即返回，而不是等待
+         * @throw
+         *      std::runtime_error 设置失败时抛出
+         */
+        void setNonBlocking(const SocketFd& fd,bool non_blocking);
+        /**
+         * @brief 非阻塞套接字专用，发送一段数据
+         * @details 与 send 不同，发送缓冲区已满时返回 0 而不是抛出异常，调用方应在套接字可写时继续发送
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param data              需要发送的数据
+         * @param size              数据长度
+         * @param flags             控制消息发送，一般情况下填0即可
+         * @return size_t           实际发送的字节数
+         * @throw
+         *      std::runtime_error 发送数据失败时抛出，例如连接被对端重置
+         */
+        size_t trySend(const SocketFd& communication_fd,const void* data,size_t size,int flags=0);
+        /**
+         * @brief 非阻塞套接字专用，接收数据写入 buffer 的写入位点之后
+         * @details 与 receive 不同，没有数据可读时返回 false 而不是抛出异常
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param buffer            接收缓冲区，最多接收 getReceivableSize() 字节
+         * @param size              返回实际接收的字节数，为 0 表示对端关闭了连接
+         * @param flags             控制消息接收，一般情况下填0即可
+         * @return true             接收到了数据或者对端关闭了连接
+         * @return false            暂时没有数据可读
+         * @throw
+         *      std::runtime_error 接收数据失败时抛出
+         */
+        bool tryReceive(const SocketFd& communication_fd,SocketDataBuffer& buffer,size_t& size,int flags=0);
+        /**
+         * @brief TCP 通信专用，以 MSG_ZEROCOPY 发送一段用户内存
+         * @details
+         *      内核直接引用用户内存而不是拷贝到套接字缓冲区，因此在收到对应的完成通知之前 data 必须保持有效且不能修改。
+         *      套接字需要先开启 SocketOptions::ZeroCopy。非阻塞套接字的发送缓冲区已满，
+         *      或者未读取的完成通知过多（ENOBUFS）时返回 0，此时没有分配编号，读取完成通知之后可以重试
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param data              需要发送的数据
+         * @param size              数据长度
+         * @param notification_full 返回 0 的原因是未读取的完成通知过多时置为 true，否则置为 false
+         * @param flags             其它发送标志，会与 MSG_ZEROCOPY 组合
+         * @return size_t           实际发送的字节数，大于 0 时占用一个完成通知编号
+         * @throw
+         *      std::runtime_error 发送数据失败时抛出
+         */
+        size_t sendZeroCopy(const SocketFd& communication_fd,const void* data,size_t size,bool& notification_full,int flags=0);
+        /**
+         * @brief 从错误队列中读取一条零拷贝发送的完成通知，不阻塞
+         * @details 错误队列中其它来源的消息会被丢弃
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param completion        用于接收完成通知
+         * @return true             读到了一条完成通知
+         * @return false            错误队列中没有完成通知
+         * @throw
+         *      std::runtime_error 读取错误队列失败时抛出
+         */
+        bool readZeroCopyCompletion(const SocketFd& communication_fd,ZeroCopyCompletion& completion);
+        /**
+         * @brief 等待套接字上发生指定的事件
+         * @details 错误队列非空时总会返回 POLLERR，因此 events 为 0 可以用来等待零拷贝的完成通知
+         * @param fd            套接字文件描述符
+         * @param events        等待的事件，例如 POLLIN、POLLOUT
+         * @param timeout_ms    超时时间（毫秒），负数表示一直等待
+         * @return int          发生的事件，超时返回 0
+         * @throw
+         *      std::runtime_error poll 失败时抛出
+         */
+        int poll(const SocketFd& fd,int events,int timeout_ms);
+        /**
+         * @brief UDP 通信专用，通过分段卸载（GSO）一次发送多个数据报
+         * @details
+         *      data 被切分成若干个 segment_size 字节的数据报（最后一个可以更短）发往同一个目标地址，
+         *      切分由内核或者网卡完成，只需要一次系统调用。单次调用最多 64 个分段，总长度不能超过一个 IP 数据报的上限
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param data              需要发送的数据
+         * @param size              数据长度
+         * @param remote_addr       目标地址
+         * @param segment_size      每个数据报的长度
+         * @param flags             控制消息发送，一般情况下填0即可
+         * @return size_t           实际发送的数据长度
+         * @throw
+         *      std::runtime_error 发送数据失败时抛出，例如分段过多或者内核不支持 UDP_SEGMENT
+         */
+        size_t sendToSegmented(const SocketFd& communication_fd,const void* data,size_t size,const SocketAddress& remote_addr,
+            std::uint16_t segment_size,int flags=0);
+        /**
+         * @brief UDP 通信专用，接收可能被合并（GRO）的多个数据报
+         * @details
+         *      套接字开启 SocketOptions::UdpGro 之后，内核会把同一来源、长度相同的连续数据报合并后一次交付，
+         *      缓冲区中依次存放每个 segment_size 字节的数据报，最后一个可以更短。没有合并时 segment_size 等于接收到的长度。
+         *      合并后的数据最长约 64KB，缓冲区不足时多出的数据会被丢弃
+         * @param communication_fd  用于通信的套接字文件描述符
+         * @param buffer            用于接收数据的SocketDataBuffer对象
+         * @param remote_addr       用于接收数据来源的地址
+         * @param segment_size      用于接收每个数据报的长度
+         * @param flags             控制消息接收，一般情况下填0即可
+         * @return size_t           实际接收到的数据长度
+         * @throw
+         *      std::runtime_error 接收数据失败时抛出
+         */
+        size_t receiveFromCoalesced(const SocketFd& communication_fd,SocketDataBuffer& buffer,SocketAddress& remote_addr,
+            size_t& segment_size,int flags=0);
+    #endif
         /**
          * @brief 检查一个文件描述符能否关闭
          * 
@@ -800,4 +976,16 @@ namespace AntonaStandard::CPS{
     };
 }
 
+/**
+ * @brief 使 SocketAddress 可以直接作为 std::unordered_map 和 std::unordered_set 的键
+ */
+namespace std{
+    template<>
+    struct hash<AntonaStandard::CPS::SocketAddress>{
+        inline size_t operator()(const AntonaStandard::CPS::SocketAddress& addr)const noexcept{
+            return addr.hash();
+        }
+    };
+}
+
 #endif
@@ -1,270 +1,117 @@
 #include <CPS/Socket.h>
 #include <iostream>
+#ifdef AntonaStandard_PLATFORM_LINUX
+    #include <fcntl.h>
+    #include <linux/errqueue.h>
+    #include <poll.h>
+    #include <sys/sendfile.h>
+    #include <sys/stat.h>
+#endif
 
 namespace AntonaStandard::CPS{
 
-    /***********   SocketAddressImp  **********
- ____             _        _      _       _     _                   ___                 
-/ ___|  ___   ___| | _____| |_   / \   __| | __| |_ __ ___  ___ ___|_ _|_ __ ___  _ __  
-\___ \ / _ \ / __| |/ / _ \ __| / _ \ / _` |/ _` | '__/ _ \/ __/ __|| || '_ ` _ \| '_ \ 
- ___) | (_) | (__|   <  __/ |_ / ___ \ (_| | (_| | | |  __/\__ \__ \| || | | | | | |_) |
-|____/ \___/ \___|_|\_\___|\__/_/   \_\__,_|\__,_|_|  \___||___/___/___|_| |_| |_| .__/ 
-                                                                                 |_|    
-    */
-    size_t SocketAddressImp::getAddrInSize() const {
-        return size_t();
-    }
-
-    void SocketAddressImp::setAddr(const char* IP, unsigned short port){
-        return ;
-    }
-
-    std::string SocketAddressImp::getIP()const{
-        return std::string();
-    }
-
-    unsigned short SocketAddressImp::getPort()const{
-        return 0;
-    }
-
-    AddressFamily SocketAddressImp::getAddressFamily()const{
-        return AddressFamily::invalid;
-    }
-    
-    std::shared_ptr<SocketAddressImp> SocketAddressImp::copy(){
-        return std::shared_ptr<SocketAddressImp>();
-    }
-
-   
-std::shared_ptr<SocketAddressImp> SocketAddressImp::create(const sockaddr * addr, socklen_t addr_len){
-    // 通过addr_len 构造SocketAddressImp
-    std::shared_ptr<SocketAddressImp> ret;
-    if(addr == nullptr){
-        return std::make_shared<SocketAddressImp>();
-    }
-    switch(addr_len){
-    case sizeof(sockaddr_in):
-        ret = std::make_shared<SocketAddressV4Imp>();
-        memcpy(ret->addr_in.get(), addr, addr_len);
-        break;
-    case sizeof(sockaddr_in6):
-        ret = std::make_shared<SocketAddressV6Imp>();
-        memcpy(ret->addr_in.get(), addr, addr_len);
-        break;
-    default:
-        ret = std::make_shared<SocketAddressImp>();
-        break;
-    }
-    return  ret; // 构造一个空的SocketAddressImp
-
-} 
-
-/************ SocketAddressV4Imp *******************
- ____             _        _      _       _     _                 __     ___  _  ___                 
-/ ___|  ___   ___| | _____| |_   / \   __| | __| |_ __ ___  ___ __\ \   / / || ||_ _|_ __ ___  _ __  
-\___ \ / _ \ / __| |/ / _ \ __| / _ \ / _` |/ _` | '__/ _ \/ __/ __\ \ / /| || |_| || '_ ` _ \| '_ \ 
- ___) | (_) | (__|   <  __/ |_ / ___ \ (_| | (_| | | |  __/\__ \__ \\ V / |__   _| || | | | | | |_) |
-|____/ \___/ \___|_|\_\___|\__/_/   \_\__,_|\__,_|_|  \___||___/___/ \_/     |_||___|_| |_| |_| .__/ 
-                                                                                              |_|        
-     * ************************************************/
-    
-
-    SocketAddressV4Imp::SocketAddressV4Imp() {
-        this->addr_in = std::make_shared<sockaddr_in>();
-    }
-
-    SocketAddressV4Imp::SocketAddressV4Imp(
-        SocketAddressV4Imp& addr) {
-        this->addr_in = std::make_shared<sockaddr_in>();
-        // 基于内存拷贝addr地址数据结构
-        std::memcpy(this->addr_in.get(),addr.getAddrIn().get(),sizeof(sockaddr_in));
-    }
-
-    SocketAddressV4Imp::SocketAddressV4Imp(
-        SocketAddressV4Imp&& addr) {
-        this->addr_in.reset();
-        using std::swap;
-        swap(this->addr_in,addr.addr_in);
-    }
-
-    size_t SocketAddressV4Imp::getAddrInSize()const {
-        return sizeof(sockaddr_in);
-    }
-
-    void SocketAddressV4Imp::setAddr(const char* IP,
-                                                            unsigned short port) {
-        // 首先将addr_in进行转换，方便操作
-        sockaddr_in* this_addr_in = (sockaddr_in*)this->addr_in.get();
-        // 设置协议 ipv4
-        this_addr_in->sin_family = AddressFamily::ipv4;
-        // 设置IP
-        this_addr_in->sin_addr.s_addr = inet_addr(IP);
-        // 设置端口
-        this_addr_in->sin_port = htons(port);
-    }
-
-    std::string SocketAddressV4Imp::getIP()const {
-        char temp_IP[20];           // IPv4最长15个字符
-        // 首先将addr_in进行转换，方便操作
-        sockaddr_in* this_addr_in = (sockaddr_in*)this->addr_in.get();
-        // 获取IP
-        auto ret = inet_ntop(AddressFamily::ipv4,
-            &(this_addr_in->sin_addr),
-            temp_IP,sizeof(temp_IP));
-
-        if(ret == nullptr){
-            #ifdef AntonaStandard_PLATFORM_WINDOWS
-                int error = WSAGetLastError();
-            #elif AntonaStandard_PLATFORM_LINUX
-                int error = errno;
-            #endif
-            throw std::runtime_error(std::string("SocketAddressV4::getIP() failed: ") +
-                                    std::to_string(error));
+    /***********   SocketAddress   **********
+ ____             _        _      _       _     _                   
+/ ___|  ___   ___| | _____| |_   / \   __| | __| |_ __ ___  ___ ___ 
+\___ \ / _ \ / __| |/ / _ \ __| / _ \ / _` |/ _` | '__/ _ \/ __/ __|
+ ___) | (_) | (__|   <  __/ |_ / ___ \ (_| | (_| | | |  __/\__ \__ \
+|____/ \___/ \___|_|\_\___|\__/_/   \_\__,_|\__,_|_|  \___||___/___/
+                                                                    
+     * **************************************/
+    SocketAddress::SocketAddress(AddressFamily ip_type,const std::string& ip,unsigned short port):storage(),length(0){
+        switch(ip_type){
+            case AddressFamily::ipv4:{
+                sockaddr_in* addr_in = reinterpret_cast<sockaddr_in*>(&this->storage);
+                // 设置协议 ipv4
+                addr_in->sin_family = AddressFamily::ipv4;
+                // 设置IP
+                addr_in->sin_addr.s_addr = inet_addr(ip.c_str());
+                // 设置端口
+                addr_in->sin_port = htons(port);
+                this->length = sizeof(sockaddr_in);
+                break;
+            }
+            case AddressFamily::ipv6:{
+                sockaddr_in6* addr_in = reinterpret_cast<sockaddr_in6*>(&this->storage);
+                addr_in->sin6_family = AddressFamily::ipv6;
+                inet_pton(AddressFamily::ipv6,ip.c_str(),&(addr_in->sin6_addr));
+                addr_in->sin6_port = htons(port);
+                this->length = sizeof(sockaddr_in6);
+                break;
+            }
+            default:
+                break;
         }
-        
-        return std::string(temp_IP); 
-    }
-
-    unsigned short SocketAddressV4Imp::getPort()const {
-        // 首先将addr_in进行转换，方便操作
-        sockaddr_in* this_addr_in = (sockaddr_in*)this->addr_in.get();
-        // 获取端口
-        return ntohs(this_addr_in->sin_port);
-    }
-
-    AddressFamily SocketAddressV4Imp::getAddressFamily()const {
-        return AddressFamily::ipv4;
-    }
-
-    std::shared_ptr<SocketAddressImp>
-    SocketAddressV4Imp::copy() {
-        return std::make_shared<SocketAddressV4Imp>(*this);
     }
 
-    /************ SocketAddressV6Imp *******************
- ____             _        _      _       _     _                 __     ____  ___                 
-/ ___|  ___   ___| | _____| |_   / \   __| | __| |_ __ ___  ___ __\ \   / / /_|_ _|_ __ ___  _ __  
-\___ \ / _ \ / __| |/ / _ \ __| / _ \ / _` |/ _` | '__/ _ \/ __/ __\ \ / / '_ \| || '_ ` _ \| '_ \ 
- ___) | (_) | (__|   <  __/ |_ / ___ \ (_| | (_| | | |  __/\__ \__ \\ V /| (_) | || | | | | | |_) |
-|____/ \___/ \___|_|\_\___|\__/_/   \_\__,_|\__,_|_|  \___||___/___/ \_/  \___/___|_| |_| |_| .__/ 
-                                                                                            |_|    
-
-     * ************************************************/
-
-    SocketAddressV6Imp::SocketAddressV6Imp() {
-        this->addr_in = std::make_shared<sockaddr_in6>();
-    }
-
-    SocketAddressV6Imp::SocketAddressV6Imp(
-        SocketAddressV6Imp& addr) {
-        this->addr_in = std::make_shared<sockaddr_in6>();
-        std::memcpy(this->addr_in.get(),addr.getAddrIn().get(),sizeof(sockaddr_in6));
+    SocketAddress::SocketAddress(const sockaddr* addr,socklen_t addr_len):storage(),length(0){
+        if(addr == nullptr || addr_len > getAddrInCapacity()){
+            return;
+        }
+        std::memcpy(&this->storage,addr,addr_len);
+        this->length = addr_len;
     }
 
-    SocketAddressV6Imp::SocketAddressV6Imp(
-        SocketAddressV6Imp&& addr) {
-        this->addr_in.reset();
+    void SocketAddress::swap(SocketAddress& other)noexcept{
         using std::swap;
-        swap(this->addr_in,addr.addr_in);
+        swap(this->storage,other.storage);
+        swap(this->length,other.length);
     }
 
-    size_t SocketAddressV6Imp::getAddrInSize()const {
-        return sizeof(sockaddr_in6);
-    }
-
-    void SocketAddressV6Imp::setAddr(const char* IP,
-                                                            unsigned short port) {
-        // 首先转化addr_in，方便操作
-        sockaddr_in6* this_addr_in = (sockaddr_in6*)this->addr_in.get();
-        // 设置协议
-        this_addr_in->sin6_family = AddressFamily::ipv6;
-        // 设置IP
-        inet_pton(AddressFamily::ipv6,IP,&(this_addr_in->sin6_addr));
-        // 设置端口
-        this_addr_in->sin6_port = htons(port);
-    }
-
-    std::string SocketAddressV6Imp::getIP()const {
-        char temp_IP[50];
-        auto ret = inet_ntop(AddressFamily::ipv6,
-            &(((sockaddr_in6*)this->addr_in.get())->sin6_addr),
-            temp_IP,sizeof(temp_IP));
+    std::string SocketAddress::getIP()const{
+        char temp_IP[INET6_ADDRSTRLEN];
+        const char* ret = nullptr;
+        switch(this->getAddressFamily()){
+            case AddressFamily::ipv4:
+                ret = inet_ntop(AddressFamily::ipv4,&(this->v4()->sin_addr),temp_IP,sizeof(temp_IP));
+                break;
+            case AddressFamily::ipv6:
+                ret = inet_ntop(AddressFamily::ipv6,&(this->v6()->sin6_addr),temp_IP,sizeof(temp_IP));
+                break;
+            default:
+                return std::string();
+        }
         if(ret == nullptr){
             #ifdef AntonaStandard_PLATFORM_WINDOWS
                 int error = WSAGetLastError();
             #elif AntonaStandard_PLATFORM_LINUX
                 int error = errno;
             #endif
-            // 抛出异常
-            throw std::runtime_error("SocketAddressV6::getIP() failed: " + 
-            std::to_string(error));
+            throw std::runtime_error(std::string("SocketAddress::getIP() failed: ") +
+                                    std::to_string(error));
         }
         return std::string(temp_IP);
     }
 
-    unsigned short SocketAddressV6Imp::getPort()const {
-        // 首先转化addr_in 方便操作
-        sockaddr_in6* this_addr_in = (sockaddr_in6*)this->addr_in.get();
-        return ntohs(this_addr_in->sin6_port);
-    }
-
-    AddressFamily SocketAddressV6Imp::getAddressFamily()const {
-        return AddressFamily::ipv6;
-    }
-
-    std::shared_ptr<SocketAddressImp>
-    SocketAddressV6Imp::copy() {
-        return std::make_shared<SocketAddressV6Imp>(*this);
-    }
-
-    /***********   SocketAddress   **********
- ____             _        _      _       _     _                   
-/ ___|  ___   ___| | _____| |_   / \   __| | __| |_ __ ___  ___ ___ 
-\___ \ / _ \ / __| |/ / _ \ __| / _ \ / _` |/ _` | '__/ _ \/ __/ __|
- ___) | (_) | (__|   <  __/ |_ / ___ \ (_| | (_| | | |  __/\__ \__ \
-|____/ \___/ \___|_|\_\___|\__/_/   \_\__,_|\__,_|_|  \___||___/___/
-                                                                    
-     * **************************************/
-    SocketAddress::SocketAddress(AddressFamily ip_type,std::string ip,unsigned short port){
-        switch(ip_type){
+    int SocketAddress::compare(const SocketAddress& other)const noexcept{
+        AddressFamily family = this->getAddressFamily();
+        AddressFamily other_family = other.getAddressFamily();
+        if(family != other_family){
+            return family < other_family ? -1 : 1;
+        }
+        int result = 0;
+        switch(family){
             case AddressFamily::ipv4:
-                this->imp = std::make_shared<SocketAddressV4Imp>();
-                this->imp->setAddr(ip.c_str(),port);
+                result = std::memcmp(&(this->v4()->sin_addr),&(other.v4()->sin_addr),sizeof(in_addr));
                 break;
             case AddressFamily::ipv6:
-                this->imp = std::make_shared<SocketAddressV6Imp>();
-                this->imp->setAddr(ip.c_str(),port);
+                result = std::memcmp(&(this->v6()->sin6_addr),&(other.v6()->sin6_addr),sizeof(in6_addr));
                 break;
             default:
-                this->imp = std::make_shared<SocketAddressImp>();
-                break;
+                return 0;
         }
-    }
-
-    SocketAddress::SocketAddress(const SocketAddress& other){
-        this->imp = other.imp->copy();
-    }
-
-    void SocketAddress::swap(SocketAddress& other) {
-        using std::swap;
-        swap(this->imp,other.imp);
-    }
-
-    const SocketAddress& SocketAddress::operator=(
-        const SocketAddress& other) {
-        SocketAddress temp(other);
-        this->swap(temp); 
-        return *this;
-    }
-
-    SocketAddress::SocketAddress(SocketAddress&& other) {
-        this->swap(other);
-    }
-
-    const SocketAddress& SocketAddress::operator=(
-        SocketAddress&& other) {
-        this->swap(other);
-        return *this;
+        if(result != 0){
+            return result;
+        }
+        unsigned short port = this->getPort();
+        unsigned short other_port = other.getPort();
+        if(port != other_port){
+            return port < other_port ? -1 : 1;
+        }
+        if(family == AddressFamily::ipv6 && this->v6()->sin6_scope_id != other.v6()->sin6_scope_id){
+            return this->v6()->sin6_scope_id < other.v6()->sin6_scope_id ? -1 : 1;
+        }
+        return 0;
     }
 
     SocketAddress SocketAddress::loopBackAddress(
@@ -281,9 +128,7 @@ std::shared_ptr<SocketAddressImp> SocketAddressImp::create(const sockaddr * addr
     }
 
     SocketAddress SocketAddress::emptyAddress(){
-        SocketAddress addr;
-        addr.imp = std::shared_ptr<SocketAddressImp>();
-        return addr;
+        return SocketAddress();
     }
 
 
@@ -403,7 +248,7 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
     }
 
     void SocketLibraryManager::bind(const SocketFd& listen_fd,const SocketAddress& local_addr){
-        int error = ::bind(listen_fd,static_cast<sockaddr*>(local_addr.getAddrIn().get()),local_addr.getAddrInSize());
+        int error = ::bind(listen_fd,local_addr.getAddrIn(),local_addr.getAddrInSize());
         if (error) {
             // result 不为0，返回错误
             #ifdef AntonaStandard_PLATFORM_WINDOWS
@@ -434,7 +279,7 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
     }
 
     void SocketLibraryManager::connect(const SocketFd& communication_fd,const SocketAddress& remote_addr){
-        int error = ::connect(communication_fd,static_cast<sockaddr*>(remote_addr.getAddrIn().get()),remote_addr.getAddrInSize());
+        int error = ::connect(communication_fd,remote_addr.getAddrIn(),remote_addr.getAddrInSize());
         if (error) {
             // result 不为0，返回错误
             #ifdef AntonaStandard_PLATFORM_WINDOWS
@@ -449,10 +294,9 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
     }
 
     SocketFd SocketLibraryManager::accept(const SocketFd& listen_fd,SocketAddress& remote_addr){
-        char addr_buf[64] = {0};
-        sockaddr* temp = reinterpret_cast<sockaddr*>(addr_buf);
-        socklen_t temp_len = sizeof(addr_buf);
-        auto remote_fd = ::accept(listen_fd,temp,&temp_len);
+        // 系统API直接写入 remote_addr 内联的地址结构体
+        socklen_t temp_len = SocketAddress::getAddrInCapacity();
+        auto remote_fd = ::accept(listen_fd,remote_addr.getAddrInBuffer(),&temp_len);
         if (remote_fd == INVALID_SOCKET) {
             // result 不为0，返回错误
             #ifdef AntonaStandard_PLATFORM_WINDOWS
@@ -464,12 +308,28 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
             ss << "SocketLibraryManager::accept() error, error = " << error;
             throw std::runtime_error(ss.str());
         }
-        // 根据sockaddr实际大小构造Imp
-        auto addr_imp = SocketAddressImp::create(temp,temp_len);
-        remote_addr.setImp(addr_imp);
+        remote_addr.setAddrInSize(temp_len);
         return remote_fd;
     }
 
+    SocketAddress SocketLibraryManager::getLocalAddress(const SocketFd& fd){
+        SocketAddress local_addr;
+        socklen_t len = SocketAddress::getAddrInCapacity();
+        int error = ::getsockname(fd,local_addr.getAddrInBuffer(),&len);
+        if (error) {
+            #ifdef AntonaStandard_PLATFORM_WINDOWS
+                int error = WSAGetLastError();
+            #else
+                int error = errno;
+            #endif
+            std::stringstream ss;
+            ss << "SocketLibraryManager::getLocalAddress() error, error = " << error;
+            throw std::runtime_error(ss.str());
+        }
+        local_addr.setAddrInSize(len);
+        return local_addr;
+    }
+
     size_t SocketLibraryManager::receive(const SocketFd& communication_fd,SocketDataBuffer& buffer,int flags){
         size_t size_accepted = ::recv(communication_fd, buffer.receivingPos(), buffer.getReceivableSize(), flags);
         if (size_accepted == -1) {
@@ -516,11 +376,10 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
          * 
          * 
         */
-        char addr_buf[64]={0};
-        sockaddr* temp_addr = reinterpret_cast<sockaddr*>(addr_buf);
-        socklen_t len = sizeof(addr_buf);
+        // 系统API直接写入 remote_addr 内联的地址结构体，不需要分配内存
+        socklen_t len = SocketAddress::getAddrInCapacity();
         size_t size_accepted = ::recvfrom(communication_fd, buffer.receivingPos(), buffer.getReceivableSize(),
-                                        flags, temp_addr, &len);
+                                        flags, remote_addr.getAddrInBuffer(), &len);
         if (size_accepted == -1) {
             #ifdef AntonaStandard_PLATFORM_WINDOWS
                 int error = WSAGetLastError();
@@ -531,7 +390,7 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
             ss<<"receive error, error = '"<<error<<"' with target address = "<<remote_addr.getIP()<<":"<<remote_addr.getPort();
             throw std::runtime_error(ss.str());
         }
-        remote_addr.setImp(SocketAddressImp::create(temp_addr, len));
+        remote_addr.setAddrInSize(len);
 
         buffer.movePutPos(size_accepted);
         return size_accepted;
@@ -553,7 +412,7 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
             }
         #endif
         size_t size_send = ::sendto(communication_fd, buffer.sendingPos(), buffer.getSendableSize(), flags
-            ,static_cast<sockaddr*>(remote_addr.getAddrIn().get()), remote_addr.getAddrInSize());
+            ,remote_addr.getAddrIn(), remote_addr.getAddrInSize());
 
         if (size_send == -1) {
             // error = -1，返回错误
@@ -572,6 +431,233 @@ SocketAddress SocketAddress::anyAddress(unsigned short port, AddressFamily ip_ty
 
     
 
+#ifdef AntonaStandard_PLATFORM_LINUX
+    size_t SocketLibraryManager::sendFile(const SocketFd& communication_fd,int file_fd,std::uint64_t& offset,size_t count){
+        if(count == 0){
+            return 0;
+        }
+        struct stat file_stat;
+        if(::fstat(file_fd,&file_stat) == -1){
+            std::stringstream ss;
+            ss<<"In 'sendFile' fstat error, error = '"<<errno<<"' with file fd = "<<file_fd;
+            throw std::runtime_error(ss.str());
+        }
+        bool is_pipe = S_ISFIFO(file_stat.st_mode);
+        unsigned int splice_flags = SPLICE_F_MOVE | SPLICE_F_MORE;
+        if(is_pipe){
+            // 只有非阻塞套接字才使用 SPLICE_F_NONBLOCK，否则管道暂时为空时会返回 EAGAIN 而不是等待写端写入
+            int socket_flags = ::fcntl(communication_fd,F_GETFL,0);
+            if(socket_flags != -1 && (socket_flags & O_NONBLOCK)){
+                splice_flags |= SPLICE_F_NONBLOCK;
+            }
+        }
+        // sendfile 单次最多传输 0x7ffff000 字节
+        count = std::min<size_t>(count,0x7ffff000);
+        ssize_t size_send = 0;
+        do{
+            if(is_pipe){
+                size_send = ::splice(file_fd,nullptr,communication_fd,nullptr,count,splice_flags);
+            }
+            else{
+                off_t file_offset = static_cast<off_t>(offset);
+                size_send = ::sendfile(communication_fd,file_fd,&file_offset,count);
+            }
+        }while(size_send == -1 && errno == EINTR);
+
+        if(size_send == -1){
+            if(errno == EAGAIN || errno == EWOULDBLOCK){
+                // 非阻塞套接字的发送缓冲区已满
+                return 0;
+            }
+            std::stringstream ss;
+            ss<<"In 'sendFile' send error, error = '"<<errno<<"' with socket fd = "<<communication_fd<<" and file fd = "<<file_fd;
+            throw std::runtime_error(ss.str());
+        }
+        if(size_send == 0){
+            std::stringstream ss;
+            ss<<"In 'sendFile' reached the end of file fd = "<<file_fd<<" at offset "<<offset<<" with "<<count<<" bytes left";
+            throw std::runtime_error(ss.str());
+        }
+        offset += static_cast<std::uint64_t>(size_send);
+        return static_cast<size_t>(size_send);
+    }
+
+    void SocketLibraryManager::setNonBlocking(const SocketFd& fd,bool non_blocking){
+        int flags = ::fcntl(fd,F_GETFL,0);
+        if(flags != -1){
+            flags = non_blocking ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
+            flags = ::fcntl(fd,F_SETFL,flags);
+        }
+        if(flags == -1){
+            std::stringstream ss;
+            ss<<"In 'setNonBlocking' fcntl error, error = '"<<errno<<"' with socket fd = "<<fd;
+            throw std::runtime_error(ss.str());
+        }
+    }
+    size_t SocketLibraryManager::trySend(const SocketFd& communication_fd,const void* data,size_t size,int flags){
+        ssize_t size_send = 0;
+        do{
+            size_send = ::send(communication_fd,data,size,flags);
+        }while(size_send == -1 && errno == EINTR);
+        if(size_send == -1){
+            if(errno == EAGAIN || errno == EWOULDBLOCK){
+                return 0;
+            }
+            std::stringstream ss;
+            ss<<"In 'trySend' send error, error = '"<<errno<<"' with socket fd = "<<communication_fd;
+            throw std::runtime_error(ss.str());
+        }
+        return static_cast<size_t>(size_send);
+    }
+    bool SocketLibraryManager::tryReceive(const SocketFd& communication_fd,SocketDataBuffer& buffer,size_t& size,int flags){
+        ssize_t size_accepted = 0;
+        do{
+            size_accepted = ::recv(communication_fd,buffer.receivingPos(),buffer.getReceivableSize(),flags);
+        }while(size_accepted == -1 && errno == EINTR);
+        if(size_accepted == -1){
+            if(errno == EAGAIN || errno == EWOULDBLOCK){
+                size = 0;
+                return false;
+            }
+            std::stringstream ss;
+            ss<<"In 'tryReceive' receive error, error = '"<<errno<<"' with socket fd = "<<communication_fd;
+            throw std::runtime_error(ss.str());
+        }
+        buffer.movePutPos(static_cast<size_t>(size_accepted));
+        size = static_cast<size_t>(size_accepted);
+        return true;
+    }
+    size_t SocketLibraryManager::sendZeroCopy(const SocketFd& communication_fd,const void* data,size_t size,bool& notification_full,int flags){
+        notification_full = false;
+        ssize_t size_send = 0;
+        do{
+            size_send = ::send(communication_fd,data,size,flags | MSG_ZEROCOPY);
+        }while(size_send == -1 && errno == EINTR);
+        if(size_send == -1){
+            if(errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS){
+                notification_full = errno == ENOBUFS;
+                return 0;
+            }
+            std::stringstream ss;
+            ss<<"In 'sendZeroCopy' send error, error = '"<<errno<<"' with socket fd = "<<communication_fd;
+            throw std::runtime_error(ss.str());
+        }
+        return static_cast<size_t>(size_send);
+    }
+    bool SocketLibraryManager::readZeroCopyCompletion(const SocketFd& communication_fd,ZeroCopyCompletion& completion){
+        char control[CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+        while(true){
+            msghdr msg{};
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+            if(::recvmsg(communication_fd,&msg,MSG_ERRQUEUE | MSG_DONTWAIT) == -1){
+                if(errno == EINTR){
+                    continue;
+                }
+                if(errno == EAGAIN || errno == EWOULDBLOCK){
+                    return false;
+                }
+                std::stringstream ss;
+                ss<<"In 'readZeroCopyCompletion' recvmsg error, error = '"<<errno<<"' with socket fd = "<<communication_fd;
+                throw std::runtime_error(ss.str());
+            }
+            for(cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg,cmsg)){
+                bool is_recverr = (cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                    (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR);
+                if(!is_recverr){
+                    continue;
+                }
+                sock_extended_err err;
+                std::memcpy(&err,CMSG_DATA(cmsg),sizeof(err));
+                if(err.ee_errno != 0 || err.ee_origin != SO_EE_ORIGIN_ZEROCOPY){
+                    continue;
+                }
+                completion.first = err.ee_info;
+                completion.last = err.ee_data;
+                completion.copied = (err.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+                return true;
+            }
+        }
+    }
+    int SocketLibraryManager::poll(const SocketFd& fd,int events,int timeout_ms){
+        pollfd pfd{};
+        pfd.fd = fd;
+        pfd.events = static_cast<short>(events);
+        int ready = 0;
+        do{
+            ready = ::poll(&pfd,1,timeout_ms);
+        }while(ready == -1 && errno == EINTR);
+        if(ready == -1){
+            std::stringstream ss;
+            ss<<"In 'poll' error, error = '"<<errno<<"' with socket fd = "<<fd;
+            throw std::runtime_error(ss.str());
+        }
+        return ready == 0 ? 0 : pfd.revents;
+    }
+    size_t SocketLibraryManager::sendToSegmented(const SocketFd& communication_fd,const void* data,size_t size,const SocketAddress& remote_addr,
+        std::uint16_t segment_size,int flags){
+        iovec iov{const_cast<void*>(data),size};
+        char control[CMSG_SPACE(sizeof(std::uint16_t))] = {};
+        msghdr msg{};
+        msg.msg_name = const_cast<sockaddr*>(remote_addr.getAddrIn());
+        msg.msg_namelen = remote_addr.getAddrInSize();
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_UDP;
+        cmsg->cmsg_type = UDP_SEGMENT;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+        std::memcpy(CMSG_DATA(cmsg),&segment_size,sizeof(segment_size));
+
+        ssize_t size_send = 0;
+        do{
+            size_send = ::sendmsg(communication_fd,&msg,flags);
+        }while(size_send == -1 && errno == EINTR);
+        if(size_send == -1){
+            std::stringstream ss;
+            ss<<"In 'sendToSegmented' send error, error = '"<<errno<<"' with target address = "<<remote_addr.getIP()<<":"<<remote_addr.getPort()
+                <<", size = "<<size<<", segment size = "<<segment_size;
+            throw std::runtime_error(ss.str());
+        }
+        return static_cast<size_t>(size_send);
+    }
+    size_t SocketLibraryManager::receiveFromCoalesced(const SocketFd& communication_fd,SocketDataBuffer& buffer,SocketAddress& remote_addr,
+        size_t& segment_size,int flags){
+        iovec iov{buffer.receivingPos(),buffer.getReceivableSize()};
+        char control[CMSG_SPACE(sizeof(int))];
+        msghdr msg{};
+        msg.msg_name = remote_addr.getAddrInBuffer();
+        msg.msg_namelen = SocketAddress::getAddrInCapacity();
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+
+        ssize_t size_accepted = 0;
+        do{
+            size_accepted = ::recvmsg(communication_fd,&msg,flags);
+        }while(size_accepted == -1 && errno == EINTR);
+        if(size_accepted == -1){
+            std::stringstream ss;
+            ss<<"In 'receiveFromCoalesced' receive error, error = '"<<errno<<"' with socket fd = "<<communication_fd;
+            throw std::runtime_error(ss.str());
+        }
+        remote_addr.setAddrInSize(msg.msg_namelen);
+        segment_size = static_cast<size_t>(size_accepted);
+        for(cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg,cmsg)){
+            if(cmsg->cmsg_level == SOL_UDP && cmsg->cmsg_type == UDP_GRO){
+                int gso_size = 0;
+                std::memcpy(&gso_size,CMSG_DATA(cmsg),sizeof(gso_size));
+                segment_size = static_cast<size_t>(gso_size);
+            }
+        }
+        buffer.movePutPos(size_accepted);
+        return static_cast<size_t>(size_accepted);
+    }
+#endif
+
     void SocketLibraryManager::close(SocketFd& fd){
         if(this->isClosable(fd)){
             
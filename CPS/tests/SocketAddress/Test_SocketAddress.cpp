@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <CPS/Socket.h>
+#include <map>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+using AntonaStandard::CPS::AddressFamily;
+using AntonaStandard::CPS::SocketAddress;
+
+TEST(Test_SocketAddress, Construct){
+    // 值类型：不持有任何堆内存
+    static_assert(std::is_nothrow_default_constructible<SocketAddress>::value, "SocketAddress should be a value type");
+    static_assert(std::is_trivially_copyable<SocketAddress>::value, "SocketAddress should be trivially copyable");
+
+    SocketAddress v4(AddressFamily::ipv4, "192.168.1.20", 8080);
+    EXPECT_EQ(AddressFamily::ipv4, v4.getAddressFamily());
+    EXPECT_EQ("192.168.1.20", v4.getIP());
+    EXPECT_EQ(8080, v4.getPort());
+    EXPECT_EQ(sizeof(sockaddr_in), v4.getAddrInSize());
+
+    SocketAddress v6(AddressFamily::ipv6, "fe80::1", 443);
+    EXPECT_EQ(AddressFamily::ipv6, v6.getAddressFamily());
+    EXPECT_EQ("fe80::1", v6.getIP());
+    EXPECT_EQ(443, v6.getPort());
+    EXPECT_EQ(sizeof(sockaddr_in6), v6.getAddrInSize());
+
+    SocketAddress empty;
+    EXPECT_FALSE(empty.isValid());
+    EXPECT_EQ(AddressFamily::invalid, empty.getAddressFamily());
+    EXPECT_EQ("", empty.getIP());
+    EXPECT_EQ(0, empty.getPort());
+    EXPECT_FALSE(SocketAddress::emptyAddress().isValid());
+    EXPECT_FALSE(SocketAddress(AddressFamily::invalid, "127.0.0.1", 1).isValid());
+
+    // 从系统API返回的地址结构体构造
+    SocketAddress raw(v6.getAddrIn(), v6.getAddrInSize());
+    EXPECT_EQ(v6, raw);
+    EXPECT_FALSE(SocketAddress(nullptr, sizeof(sockaddr_in)).isValid());
+    EXPECT_FALSE(SocketAddress(v4.getAddrIn(), sizeof(sockaddr_in) - 1).isValid());
+
+    // 模拟 recvfrom 直接写入
+    SocketAddress written;
+    std::memcpy(written.getAddrInBuffer(), v4.getAddrIn(), v4.getAddrInSize());
+    written.setAddrInSize(v4.getAddrInSize());
+    EXPECT_EQ(v4, written);
+    written.setAddrInSize(SocketAddress::getAddrInCapacity() + 1);
+    EXPECT_FALSE(written.isValid());
+}
+
+TEST(Test_SocketAddress, CopyAndSwap){
+    SocketAddress a = SocketAddress::loopBackAddress(9000);
+    SocketAddress b = SocketAddress::anyAddress(9001, AddressFamily::ipv6);
+    SocketAddress c = a;
+    EXPECT_EQ(a, c);
+    swap(a, b);
+    EXPECT_EQ("::", a.getIP());
+    EXPECT_EQ(9001, a.getPort());
+    EXPECT_EQ(c, b);
+    b = a;
+    EXPECT_EQ(a, b);
+}
+
+TEST(Test_SocketAddress, CompareAndHash){
+    SocketAddress a(AddressFamily::ipv4, "10.0.0.1", 5000);
+    SocketAddress same(AddressFamily::ipv4, "10.0.0.1", 5000);
+    SocketAddress other_port(AddressFamily::ipv4, "10.0.0.1", 5001);
+    SocketAddress other_ip(AddressFamily::ipv4, "10.0.0.2", 5000);
+    SocketAddress v6(AddressFamily::ipv6, "::ffff:10.0.0.1", 5000);
+
+    EXPECT_EQ(a, same);
+    EXPECT_EQ(a.hash(), same.hash());
+    EXPECT_NE(a, other_port);
+    EXPECT_NE(a, other_ip);
+    EXPECT_NE(a, v6);
+    // 先比较地址簇，再比较IP，最后比较端口
+    EXPECT_LT(a, other_port);
+    EXPECT_LT(other_port, other_ip);
+    EXPECT_LT(a, v6);
+    EXPECT_FALSE(a < same);
+    EXPECT_LT(SocketAddress(), a);
+
+    // 填充字节不影响比较和哈希
+    sockaddr_in dirty;
+    std::memcpy(&dirty, a.getAddrIn(), sizeof(dirty));
+    std::memset(dirty.sin_zero, 0x5a, sizeof(dirty.sin_zero));
+    SocketAddress padded(reinterpret_cast<sockaddr*>(&dirty), sizeof(dirty));
+    EXPECT_EQ(a, padded);
+    EXPECT_EQ(a.hash(), padded.hash());
+
+    // scope id 不同的链路本地地址是不同的对端
+    sockaddr_in6 scoped;
+    SocketAddress link(AddressFamily::ipv6, "fe80::1", 5000);
+    std::memcpy(&scoped, link.getAddrIn(), sizeof(scoped));
+    scoped.sin6_scope_id = 2;
+    EXPECT_NE(link, SocketAddress(reinterpret_cast<sockaddr*>(&scoped), sizeof(scoped)));
+}
+
+TEST(Test_SocketAddress, AsMapKey){
+    std::unordered_map<SocketAddress, int> sessions;
+    std::map<SocketAddress, int> ordered;
+    for(int i = 0; i < 1000; ++i){
+        SocketAddress v4(AddressFamily::ipv4, "127.0.0." + std::to_string(i % 250 + 1), static_cast<unsigned short>(10000 + i));
+        SocketAddress v6(AddressFamily::ipv6, "2001:db8::" + std::to_string(i % 100), static_cast<unsigned short>(20000 + i));
+        sessions[v4] = i;
+        sessions[v6] = -i;
+        ordered[v4] = i;
+        ordered[v6] = -i;
+    }
+    EXPECT_EQ(2000u, sessions.size());
+    EXPECT_EQ(2000u, ordered.size());
+    EXPECT_EQ(42, sessions.at(SocketAddress(AddressFamily::ipv4, "127.0.0.43", 10042)));
+    EXPECT_EQ(-7, sessions.at(SocketAddress(AddressFamily::ipv6, "2001:db8::7", 20007)));
+
+    // 哈希值分布：1000 个只有端口不同的地址几乎没有碰撞
+    std::unordered_set<size_t> hashes;
+    for(int port = 0; port < 1000; ++port){
+        hashes.insert(SocketAddress(AddressFamily::ipv4, "192.168.0.1", static_cast<unsigned short>(port)).hash());
+    }
+    EXPECT_EQ(1000u, hashes.size());
+}
@@ -29,6 +29,8 @@ namespace AntonaStandard{
 		class  FailToLoadDll_Error;
 		class  FailToUnloadDll_Error;
 		class  FailToGetFunction_Error;
+		class  DataCorrupted_Error;
+		class  Overflow_Error;
 	}
 }
 
@@ -122,6 +124,22 @@ namespace AntonaStandard::Globals{
 	public:
 		FailToGetFunction_Error(const char* msg):std::runtime_error(msg){};
 	};
+	/**
+	 * @brief 数据损坏错误，一般是反序列化时数据被截断或者格式不正确
+	 * 
+	 */
+	class DataCorrupted_Error:public std::runtime_error{
+	public:
+		DataCorrupted_Error(const char* msg):std::runtime_error(msg){};
+	};
+	/**
+	 * @brief 算术溢出错误，运算结果无法用目标类型表示
+	 * 
+	 */
+	class Overflow_Error:public std::runtime_error{
+	public:
+		Overflow_Error(const char* msg):std::runtime_error(msg){};
+	};
 }
 
 
@@ -36,6 +36,11 @@ int main(){
 
     Fraction f7 = -1*f1 ;
     cout<<(f7 == -f1)<<endl;					// 1
+    // 编译期常量
+    using namespace AntonaStandard::Math::literals;
+    constexpr Fraction f9 = 3_fr/4;		// f9 == "3/4"
+    constexpr Fraction f10 = "1/8"_fr;		// f10 == "1/8"
+    cout<<(f9 + f10)<<endl;					// 7/8
     // 输入流运算符
     Fraction f8;
     cin>>f8;								// 会尝试按照"num/den"的形式读取，如果不存在字符'/'则会终止读取den，并将den赋值为1
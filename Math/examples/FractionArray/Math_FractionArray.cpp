@@ -0,0 +1,82 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Math/FractionArray.h"   // 分数数组
+using namespace std;
+using namespace AntonaStandard::Math;
+
+// 计时，返回毫秒
+template<typename type_FUNC>
+double measure(type_FUNC&& func,int rounds){
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < rounds; ++i){
+        func();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double,milli>(end - start).count() / rounds;
+}
+
+int main(){
+    cout<<"Benchmark of FractionArray:"<<endl;
+    const size_t size = 1 << 20;
+    const int rounds = 10;
+    mt19937 engine(2024);
+    uniform_int_distribution<int> num_dist(-1000,1000);
+    uniform_int_distribution<int> den_dist(1,1000);
+
+    vector<Fraction> scalar_lhs,scalar_rhs,scalar_out(size);
+    FractionArray lhs,rhs,out;
+    for(size_t i = 0; i < size; ++i){
+        int an = num_dist(engine),ad = den_dist(engine);
+        int bn = num_dist(engine),bd = den_dist(engine);
+        scalar_lhs.emplace_back(an,ad);
+        scalar_rhs.emplace_back(bn,bd);
+    }
+    for(size_t i = 0; i < size; ++i){
+        lhs.push_back(scalar_lhs[i]);
+        rhs.push_back(scalar_rhs[i]);
+    }
+
+    // Fraction 的标量循环，每次运算都要化简
+    double fraction_add = measure([&](){
+        for(size_t i = 0; i < size; ++i){
+            scalar_out[i] = scalar_lhs[i] + scalar_rhs[i];
+        }
+    },rounds);
+    double fraction_mul = measure([&](){
+        for(size_t i = 0; i < size; ++i){
+            scalar_out[i] = scalar_lhs[i] * scalar_rhs[i];
+        }
+    },rounds);
+    cout<<"Fraction loop            add: "<<fraction_add<<" ms, mul: "<<fraction_mul<<" ms"<<endl;
+
+    vector<signed char> result;
+    for(SimdLevel level:{SimdLevel::Scalar,SimdLevel::AVX2}){
+        if(FractionArray::setSimdLevel(level) != level){
+            cout<<"AVX2 is not supported by this CPU"<<endl;
+            continue;
+        }
+        double add = measure([&](){ FractionArray::add(lhs,rhs,out); },rounds);
+        double mul = measure([&](){ FractionArray::mul(lhs,rhs,out); },rounds);
+        double cmp = measure([&](){ FractionArray::compare(lhs,rhs,result); },rounds);
+        double normalize = measure([&](){
+            FractionArray::add(lhs,rhs,out);
+            out.normalize();
+        },rounds) - add;
+        cout<<(level == SimdLevel::AVX2 ? "FractionArray AVX2   " : "FractionArray scalar ")
+            <<"    add: "<<add<<" ms, mul: "<<mul<<" ms, compare: "<<cmp<<" ms, normalize: "<<normalize<<" ms"<<endl;
+    }
+    FractionArray::setSimdLevel(FractionArray::supportedSimdLevel());
+
+    // 校验结果
+    FractionArray::add(lhs,rhs,out);
+    size_t mismatch = 0;
+    for(size_t i = 0; i < size; ++i){
+        if(out.get(i) != scalar_lhs[i] + scalar_rhs[i]){
+            ++mismatch;
+        }
+    }
+    cout<<"mismatch: "<<mismatch<<endl;
+    return 0;
+}
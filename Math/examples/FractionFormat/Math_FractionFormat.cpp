@@ -0,0 +1,89 @@
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "Math/FractionFormat.h"   // 分数的快速解析和格式化
+using namespace std;
+using namespace AntonaStandard::Math;
+
+// 计时，返回秒
+template<typename type_FUNC>
+double measure(type_FUNC&& func){
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+int main(){
+    cout<<"Benchmark of Fraction parsing and formatting:"<<endl;
+    const size_t count = 1000000;
+    mt19937 engine(2024);
+    uniform_int_distribution<int> num_dist(-1000000,1000000);
+    uniform_int_distribution<int> den_dist(1,1000000);
+
+    // 生成每行 4 列、逗号分隔的文本
+    string text;
+    char buffer[fraction_chars_max];
+    for(size_t i = 0; i < count; ++i){
+        auto result = to_chars(buffer,buffer + sizeof(buffer),Fraction(num_dist(engine),den_dist(engine)));
+        text.append(buffer,result.ptr);
+        text.push_back((i % 4 == 3) ? '\n' : ',');
+    }
+    double megabytes = text.size() / 1048576.0;
+    cout<<"input: "<<count<<" fractions, "<<megabytes<<" MB"<<endl;
+
+    // iostream 逐个读取
+    vector<Fraction> stream_values;
+    stream_values.reserve(count);
+    double stream_time = measure([&](){
+        stringstream ss(text);
+        Fraction value;
+        while(ss>>value){
+            stream_values.push_back(value);
+            // 跳过分隔符
+            ss.get();
+        }
+    });
+    cout<<"operator>>      : "<<stream_time<<" s, "<<megabytes / stream_time<<" MB/s"<<endl;
+
+    // 批量解析
+    vector<Fraction> values;
+    values.reserve(count);
+    double parse_time = measure([&](){
+        parseFractions(text,values);
+    });
+    cout<<"parseFractions  : "<<parse_time<<" s, "<<megabytes / parse_time<<" MB/s"<<endl;
+
+    FractionArray array;
+    array.reserve(count);
+    double array_time = measure([&](){
+        parseFractions(text,array);
+    });
+    cout<<"parseFractions (FractionArray): "<<array_time<<" s, "<<megabytes / array_time<<" MB/s"<<endl;
+
+    // 格式化
+    string stream_output;
+    double stream_format_time = measure([&](){
+        stringstream ss;
+        for(const auto& value:values){
+            ss<<value.getNumerator()<<"/"<<value.getDenominator()<<'\n';
+        }
+        stream_output = ss.str();
+    });
+    string output;
+    output.reserve(text.size());
+    double format_time = measure([&](){
+        for(const auto& value:values){
+            auto result = to_chars(buffer,buffer + sizeof(buffer),value);
+            output.append(buffer,result.ptr);
+            output.push_back('\n');
+        }
+    });
+    cout<<"iostream format : "<<stream_format_time<<" s"<<endl;
+    cout<<"to_chars        : "<<format_time<<" s"<<endl;
+    cout<<"results match: "<<(values == stream_values && output == stream_output)<<endl;
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Math/LinearAlgebra.h"   // 有理数矩阵的精确求解
+using namespace std;
+using namespace AntonaStandard::Math;
+
+// 计时，返回秒
+template<typename type_FUNC>
+double measure(type_FUNC&& func){
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double>(end - start).count();
+}
+
+// 直接对分数做高斯消元，作为对照
+vector<BigFraction> gaussSolve(BigFractionMatrix matrix,vector<BigFraction> rhs){
+    size_t n = matrix.rows();
+    for(size_t k = 0; k < n; ++k){
+        size_t pivot = k;
+        while(matrix(pivot,k) == BigFraction()){
+            ++pivot;
+        }
+        matrix.swapRows(pivot,k);
+        swap(rhs[pivot],rhs[k]);
+        for(size_t i = k + 1; i < n; ++i){
+            BigFraction factor = matrix(i,k) / matrix(k,k);
+            for(size_t j = k; j < n; ++j){
+                matrix(i,j) -= factor * matrix(k,j);
+            }
+            rhs[i] -= factor * rhs[k];
+        }
+    }
+    vector<BigFraction> x(n);
+    for(size_t i = n; i-- > 0;){
+        BigFraction sum = rhs[i];
+        for(size_t j = i + 1; j < n; ++j){
+            sum -= matrix(i,j) * x[j];
+        }
+        x[i] = sum / matrix(i,i);
+    }
+    return x;
+}
+
+int main(int argc,char** argv){
+    size_t n = argc > 1 ? static_cast<size_t>(atoi(argv[1])) : 60;
+    cout<<"Solving a "<<n<<"x"<<n<<" rational system:"<<endl;
+    mt19937 engine(2024);
+    uniform_int_distribution<int> num_dist(-100,100);
+    uniform_int_distribution<int> den_dist(1,16);
+    BigFractionMatrix matrix(n,n);
+    vector<BigFraction> rhs(n);
+    for(size_t i = 0; i < n; ++i){
+        for(size_t j = 0; j < n; ++j){
+            matrix(i,j) = BigFraction(num_dist(engine),den_dist(engine));
+        }
+        rhs[i] = BigFraction(num_dist(engine),den_dist(engine));
+    }
+
+    vector<BigFraction> gauss_x;
+    double gauss_time = measure([&](){
+        gauss_x = gaussSolve(matrix,rhs);
+    });
+    cout<<"fraction Gaussian elimination: "<<gauss_time<<" s"<<endl;
+
+    vector<BigFraction> bareiss_x;
+    double bareiss_time = measure([&](){
+        bareiss_x = solve(matrix,rhs);
+    });
+    cout<<"Bareiss elimination: "<<bareiss_time<<" s"<<endl;
+
+    AntonaStandard::ThreadTools::ThreadsPool pool(2,4);
+    pool.lauch();
+    vector<BigFraction> parallel_x;
+    double parallel_time = measure([&](){
+        parallel_x = solve(matrix,rhs,&pool);
+    });
+    pool.shutdown();
+    cout<<"Bareiss elimination with ThreadsPool: "<<parallel_time<<" s"<<endl;
+
+    cout<<"denominator bits of the solution: "<<bareiss_x[0].getDenominator().bitLength()<<endl;
+    cout<<"results match: "<<boolalpha<<(gauss_x == bareiss_x && bareiss_x == parallel_x && matrix * bareiss_x == rhs)<<endl;
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "Math/CsrMatrix.h"        // 稀疏矩阵
+#include "Math/NumericKernels.h"   // 浮点数运算内核
+using namespace std;
+using namespace AntonaStandard::Math;
+
+// 计时，返回毫秒
+template<typename type_FUNC>
+double measure(type_FUNC&& func,int rounds){
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < rounds; ++i){
+        func();
+    }
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double,milli>(end - start).count() / rounds;
+}
+
+vector<double> randomVector(size_t size,mt19937& engine){
+    uniform_real_distribution<double> dist(-1.0,1.0);
+    vector<double> result(size);
+    for(auto& value:result){
+        value = dist(engine);
+    }
+    return result;
+}
+
+// 对照用的朴素循环
+double naiveDot(const vector<double>& x,const vector<double>& y){
+    double result = 0;
+    for(size_t i = 0; i < x.size(); ++i){
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+void naiveGemm(size_t n,const double* a,const double* b,double* c){
+    for(size_t i = 0; i < n; ++i){
+        for(size_t j = 0; j < n; ++j){
+            double value = 0;
+            for(size_t k = 0; k < n; ++k){
+                value += a[i * n + k] * b[k * n + j];
+            }
+            c[i * n + j] = value;
+        }
+    }
+}
+
+void naiveSpmv(const CsrMatrix& matrix,const double* x,double* y){
+    const auto& offsets = matrix.rowOffsets();
+    const auto& columns = matrix.columnIndices();
+    const auto& values = matrix.values();
+    for(size_t i = 0; i < matrix.rows(); ++i){
+        double value = 0;
+        for(size_t p = offsets[i]; p < offsets[i + 1]; ++p){
+            value += values[p] * x[columns[p]];
+        }
+        y[i] = value;
+    }
+}
+
+int main(){
+    cout<<"Benchmark of NumericKernels:"<<endl;
+    mt19937 engine(2024);
+    const size_t vector_size = 1 << 16;
+    const size_t matrix_size = 512;
+    const int rounds = 20;
+    vector<double> x = randomVector(vector_size,engine);
+    vector<double> y = randomVector(vector_size,engine);
+    vector<double> a = randomVector(matrix_size * matrix_size,engine);
+    vector<double> b = randomVector(matrix_size * matrix_size,engine);
+    vector<double> c(matrix_size * matrix_size);
+    vector<double> expected(matrix_size * matrix_size);
+
+    // 每行约 32 个非零元素的稀疏矩阵
+    const size_t sparse_rows = 1 << 15;
+    uniform_int_distribution<size_t> column_dist(0,vector_size - 1);
+    vector<CsrMatrix::Entry> entries;
+    for(size_t i = 0; i < sparse_rows; ++i){
+        for(int p = 0; p < 32; ++p){
+            entries.push_back({i,column_dist(engine),1.0 / (p + 1)});
+        }
+    }
+    CsrMatrix sparse(sparse_rows,vector_size,entries);
+    vector<double> spmv_out(sparse_rows);
+    vector<double> spmv_expected(sparse_rows);
+
+    volatile double sink = 0;
+    double dot_time = measure([&](){ sink = naiveDot(x,y); },rounds * 10);
+    double gemm_time = measure([&](){ naiveGemm(matrix_size,a.data(),b.data(),expected.data()); },1);
+    double spmv_time = measure([&](){ naiveSpmv(sparse,x.data(),spmv_expected.data()); },rounds);
+    cout<<"naive loop   dot: "<<dot_time<<" ms, gemm "<<matrix_size<<": "<<gemm_time<<" ms, spmv: "<<spmv_time<<" ms"<<endl;
+
+    for(SimdLevel level:{SimdLevel::Scalar,SimdLevel::SSE2,SimdLevel::AVX2,SimdLevel::AVX512}){
+        if(NumericKernels::setSimdLevel(level) != level){
+            cout<<simdLevelName(level)<<" is not supported by this CPU"<<endl;
+            continue;
+        }
+        double dot = measure([&](){ sink = NumericKernels::dot(x.data(),y.data(),vector_size); },rounds * 10);
+        double gemm = measure([&](){
+            NumericKernels::gemm(matrix_size,matrix_size,matrix_size,1.0,a.data(),matrix_size,b.data(),matrix_size,0.0,c.data(),matrix_size);
+        },1);
+        double spmv = measure([&](){ sparse.multiply(x.data(),spmv_out.data()); },rounds);
+        double gflops = 2.0 * matrix_size * matrix_size * matrix_size / gemm / 1e6;
+        double error = 0;
+        for(size_t i = 0; i < c.size(); ++i){
+            error = max(error,fabs(c[i] - expected[i]));
+        }
+        for(size_t i = 0; i < spmv_out.size(); ++i){
+            error = max(error,fabs(spmv_out[i] - spmv_expected[i]));
+        }
+        cout<<simdLevelName(level)<<"\tdot: "<<dot<<" ms, gemm: "<<gemm<<" ms ("<<gflops<<" GFLOPS), spmv: "<<spmv
+            <<" ms, max error: "<<error<<endl;
+    }
+    NumericKernels::setSimdLevel(NumericKernels::supportedSimdLevel());
+    return 0;
+}
@@ -0,0 +1,303 @@
+/**
+ * @file BasicFraction.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义以任意有符号整数存储的分数模板
+ * @details
+ *      Fraction 以 int 存储分子分母，运算时在 int 中交叉相乘，数值稍大就会静默溢出；每次构造都要用取模的欧几里得算法化简。
+ *      BasicFraction<type_INT> 做了以下改进：
+ *      - 中间结果使用更宽的整数：int 使用 64 位，long long 使用 128 位，交叉相乘和比较不会溢出
+ *      - 最大公约数使用基于 ctz（末尾零的个数）的二进制 GCD（Stein 算法），只有移位和减法，没有除法
+ *      - 惰性化简：运算结果能够用 type_INT 表示时直接保存，不计算最大公约数，只有放不下时才化简；
+ *        化简后仍然放不下则抛出 AntonaStandard::Globals::Overflow_Error
+ *      - 分母相同时加减法直接合并分子
+ *
+ *      由于惰性化简，getNumerator() 和 getDenominator() 返回的不一定是最简形式，需要最简形式时调用 normalize() 或 reduced()。
+ *      分母始终为正，比较运算与是否化简无关
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_BASICFRACTION_H
+#define MATH_BASICFRACTION_H
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <Globals/Exception.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        template<typename type_INT>
+        struct FractionWide;
+
+        template<typename type_INT>
+        class BasicFraction;
+    }
+}
+
+namespace AntonaStandard::Math{
+    __extension__ typedef __int128 int128_t;
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    /**
+     * @brief 分数运算使用的宽整数类型
+     * @details 32 位及以下的整数使用 64 位，64 位整数使用 128 位
+     * @tparam type_INT 有符号整数
+     */
+    template<typename type_INT>
+    struct FractionWide{
+        static_assert(std::is_integral<type_INT>::value && std::is_signed<type_INT>::value,
+            "BasicFraction requires a signed integer type");
+        static_assert(sizeof(type_INT) <= sizeof(std::int64_t),"BasicFraction supports at most 64-bit integers");
+        using Signed = std::conditional_t<(sizeof(type_INT) <= sizeof(std::int32_t)),std::int64_t,int128_t>;
+        using Unsigned = std::conditional_t<(sizeof(type_INT) <= sizeof(std::int32_t)),std::uint64_t,uint128_t>;
+    };
+
+    /**
+     * @brief 计算无符号整数末尾零的个数，value 不能为 0
+     */
+    template<typename type_UINT>
+    constexpr int countTrailingZeros(type_UINT value){
+        if constexpr(sizeof(type_UINT) <= sizeof(unsigned int)){
+            return __builtin_ctz(value);
+        }
+        else if constexpr(sizeof(type_UINT) <= sizeof(unsigned long long)){
+            return __builtin_ctzll(value);
+        }
+        else{
+            unsigned long long low = static_cast<unsigned long long>(value);
+            if(low != 0){
+                return __builtin_ctzll(low);
+            }
+            return 64 + __builtin_ctzll(static_cast<unsigned long long>(value >> 64));
+        }
+    }
+
+    /**
+     * @brief 二进制 GCD（Stein 算法）
+     * @details 先移除两个数共同的因子 2，之后每轮把较大的数减去较小的数并移除末尾的零，直到差为 0
+     * @return 最大公约数，gcd(0,b) = b
+     */
+    template<typename type_UINT>
+    constexpr type_UINT binaryGcd(type_UINT lhs,type_UINT rhs){
+        static_assert(!std::is_signed<type_UINT>::value,"binaryGcd requires an unsigned integer type");
+        if(lhs == 0){
+            return rhs;
+        }
+        if(rhs == 0){
+            return lhs;
+        }
+        int shift = countTrailingZeros<type_UINT>(lhs | rhs);
+        lhs >>= countTrailingZeros<type_UINT>(lhs);
+        do{
+            rhs >>= countTrailingZeros<type_UINT>(rhs);
+            if(lhs > rhs){
+                type_UINT temp = lhs;
+                lhs = rhs;
+                rhs = temp;
+            }
+            rhs -= lhs;
+        }while(rhs != 0);
+        return lhs << shift;
+    }
+
+    /**
+     * @brief 分数模板
+     * @tparam type_INT 存储分子分母的有符号整数，最多 64 位
+     */
+    template<typename type_INT>
+    class BasicFraction{
+    public:
+        using Int = type_INT;
+        using Wide = typename FractionWide<type_INT>::Signed;
+        using UWide = typename FractionWide<type_INT>::Unsigned;
+    private:
+        type_INT numerator;     ///< 分子
+        type_INT denominator;   ///< 分母，始终为正
+
+        static constexpr UWide absolute(Wide value){
+            return value < 0 ? UWide(0) - UWide(value) : UWide(value);
+        }
+        static constexpr bool fits(Wide value){
+            return value >= Wide(std::numeric_limits<type_INT>::min()) && value <= Wide(std::numeric_limits<type_INT>::max());
+        }
+        /**
+         * @brief 从宽整数设置分子分母，den 必须为正
+         * @details 能够直接表示时不化简，否则化简后再保存
+         * @throw AntonaStandard::Globals::Overflow_Error 化简后仍然无法表示
+         */
+        constexpr void assign(Wide num,Wide den){
+            if(!fits(num) || !fits(den)){
+                Wide ratio = static_cast<Wide>(binaryGcd<UWide>(absolute(num),UWide(den)));
+                num /= ratio;
+                den /= ratio;
+                if(!fits(num) || !fits(den)){
+                    throw AntonaStandard::Globals::Overflow_Error("The fraction can not be represented by the integer type!");
+                }
+            }
+            this->numerator = static_cast<type_INT>(num);
+            this->denominator = static_cast<type_INT>(den);
+        }
+    public:
+        constexpr BasicFraction(type_INT num = 0,type_INT den = 1):numerator(num),denominator(den){
+            assert(den != 0);
+            if(den < 0){
+                this->assign(-Wide(num),-Wide(den));
+            }
+        }
+        /**
+         * @brief 从宽整数构造，分母可以为负
+         * @throw AntonaStandard::Globals::Overflow_Error 化简后仍然无法表示
+         */
+        static constexpr BasicFraction fromWide(Wide num,Wide den){
+            assert(den != 0);
+            BasicFraction result;
+            if(den < 0){
+                num = -num;
+                den = -den;
+            }
+            result.assign(num,den);
+            return result;
+        }
+
+        /// @brief 获取分子，不一定是最简形式
+        inline constexpr type_INT getNumerator()const{
+            return this->numerator;
+        }
+        /// @brief 获取分母，始终为正，不一定是最简形式
+        inline constexpr type_INT getDenominator()const{
+            return this->denominator;
+        }
+        /// @brief 就地化简为最简形式
+        constexpr BasicFraction& normalize(){
+            type_INT ratio = static_cast<type_INT>(binaryGcd<UWide>(absolute(this->numerator),UWide(this->denominator)));
+            if(ratio > 1){
+                this->numerator /= ratio;
+                this->denominator /= ratio;
+            }
+            return *this;
+        }
+        /// @brief 返回最简形式的拷贝
+        constexpr BasicFraction reduced()const{
+            BasicFraction result = *this;
+            result.normalize();
+            return result;
+        }
+        /// @brief 是否为最简形式
+        constexpr bool isReduced()const{
+            return binaryGcd<UWide>(absolute(this->numerator),UWide(this->denominator)) == 1;
+        }
+        template<typename type_FLOAT = double>
+        constexpr type_FLOAT toFloating()const{
+            return static_cast<type_FLOAT>(this->numerator) / static_cast<type_FLOAT>(this->denominator);
+        }
+
+        constexpr BasicFraction operator-()const{
+            return fromWide(-Wide(this->numerator),this->denominator);
+        }
+        constexpr BasicFraction operator+()const{
+            return *this;
+        }
+        constexpr BasicFraction& operator++(){
+            this->assign(Wide(this->numerator) + this->denominator,this->denominator);
+            return *this;
+        }
+        constexpr BasicFraction& operator--(){
+            this->assign(Wide(this->numerator) - this->denominator,this->denominator);
+            return *this;
+        }
+        constexpr BasicFraction operator++(int){
+            BasicFraction temp = *this;
+            ++(*this);
+            return temp;
+        }
+        constexpr BasicFraction operator--(int){
+            BasicFraction temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        constexpr BasicFraction& operator+=(const BasicFraction& rhs){
+            if(this->denominator == rhs.denominator){
+                this->assign(Wide(this->numerator) + rhs.numerator,this->denominator);
+            }
+            else{
+                this->assign(Wide(this->numerator) * rhs.denominator + Wide(rhs.numerator) * this->denominator,
+                    Wide(this->denominator) * rhs.denominator);
+            }
+            return *this;
+        }
+        constexpr BasicFraction& operator-=(const BasicFraction& rhs){
+            if(this->denominator == rhs.denominator){
+                this->assign(Wide(this->numerator) - rhs.numerator,this->denominator);
+            }
+            else{
+                this->assign(Wide(this->numerator) * rhs.denominator - Wide(rhs.numerator) * this->denominator,
+                    Wide(this->denominator) * rhs.denominator);
+            }
+            return *this;
+        }
+        constexpr BasicFraction& operator*=(const BasicFraction& rhs){
+            this->assign(Wide(this->numerator) * rhs.numerator,Wide(this->denominator) * rhs.denominator);
+            return *this;
+        }
+        constexpr BasicFraction& operator/=(const BasicFraction& rhs){
+            *this = fromWide(Wide(this->numerator) * rhs.denominator,Wide(this->denominator) * rhs.numerator);
+            return *this;
+        }
+
+        friend constexpr BasicFraction operator+(BasicFraction lhs,const BasicFraction& rhs){
+            return lhs += rhs;
+        }
+        friend constexpr BasicFraction operator-(BasicFraction lhs,const BasicFraction& rhs){
+            return lhs -= rhs;
+        }
+        friend constexpr BasicFraction operator*(BasicFraction lhs,const BasicFraction& rhs){
+            return lhs *= rhs;
+        }
+        friend constexpr BasicFraction operator/(BasicFraction lhs,const BasicFraction& rhs){
+            return lhs /= rhs;
+        }
+
+        /// @brief 比较 lhs 和 rhs，分母为正，在宽整数中交叉相乘，返回负数、零或正数
+        friend constexpr int compare(const BasicFraction& lhs,const BasicFraction& rhs){
+            Wide left = Wide(lhs.numerator) * rhs.denominator;
+            Wide right = Wide(rhs.numerator) * lhs.denominator;
+            return (left > right) - (left < right);
+        }
+        friend constexpr bool operator==(const BasicFraction& lhs,const BasicFraction& rhs){
+            return compare(lhs,rhs) == 0;
+        }
+        friend constexpr bool operator!=(const BasicFraction& lhs,const BasicFraction& rhs){
+            return compare(lhs,rhs) != 0;
+        }
+        friend constexpr bool operator<(const BasicFraction& lhs,const BasicFraction& rhs){
+            return compare(lhs,rhs) < 0;
+        }
+        friend constexpr bool operator<=(const BasicFraction& lhs,const BasicFraction& rhs){
+            return compare(lhs,rhs) <= 0;
+        }
+        friend constexpr bool operator>(const BasicFraction& lhs,const BasicFraction& rhs){
+            return compare(lhs,rhs) > 0;
+        }
+        friend constexpr bool operator>=(const BasicFraction& lhs,const BasicFraction& rhs){
+            return compare(lhs,rhs) >= 0;
+        }
+
+        /// @brief 以最简形式输出，格式与 Fraction 相同
+        friend std::ostream& operator<<(std::ostream& output,const BasicFraction& rhs){
+            BasicFraction temp = rhs.reduced();
+            output<<static_cast<long long>(temp.numerator)<<"/"<<static_cast<long long>(temp.denominator);
+            return output;
+        }
+    };
+
+    using Fraction32 = BasicFraction<std::int32_t>;
+    using Fraction64 = BasicFraction<std::int64_t>;
+}
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file BigFraction.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义以任意精度整数存储的分数
+ * @details
+ *      Fraction 以 int 存储分子分母，结果超出范围时抛出 Overflow_Error。BigFraction 以 BigInteger 存储分子分母，
+ *      运算不会溢出，运算符与 Fraction 相同，并且可以与 Fraction 相互转换。
+ *      分子分母较小时 BigInteger 不申请堆内存，运算走内部的快速路径；每次运算后化简为最简形式，分母始终为正
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_BIGFRACTION_H
+#define MATH_BIGFRACTION_H
+
+#include <cassert>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <Globals/Exception.h>
+#include <Math/BigInteger.h>
+#include <Math/Fraction.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        class BigFraction;
+
+        const BigFraction operator+(const BigFraction& lhs,const BigFraction& rhs);
+        const BigFraction operator-(const BigFraction& lhs,const BigFraction& rhs);
+        const BigFraction operator*(const BigFraction& lhs,const BigFraction& rhs);
+        const BigFraction operator/(const BigFraction& lhs,const BigFraction& rhs);
+
+        bool operator==(const BigFraction& lhs,const BigFraction& rhs);
+        bool operator!=(const BigFraction& lhs,const BigFraction& rhs);
+        bool operator>(const BigFraction& lhs,const BigFraction& rhs);
+        bool operator>=(const BigFraction& lhs,const BigFraction& rhs);
+        bool operator<(const BigFraction& lhs,const BigFraction& rhs);
+        bool operator<=(const BigFraction& lhs,const BigFraction& rhs);
+
+        std::istream& operator>>(std::istream& input,BigFraction& rhs);
+        std::ostream& operator<<(std::ostream& output,const BigFraction& rhs);
+    }
+}
+
+namespace AntonaStandard::Math{
+    /**
+     * @brief 任意精度的分数类
+     * @details 支持从整数、BigInteger、Fraction 和字符串构造，字符串的解析规则与 Fraction 相同
+     */
+    class BigFraction{
+        TESTING_MESSAGE
+    private:
+        BigInteger numerator;       ///< 分子
+        BigInteger denominator;     ///< 分母，始终为正
+
+        /// @brief 化简并保证分母为正
+        void reduce();
+        /// @brief 把任意整数类型转为 BigInteger，无符号类型保留完整的值
+        template<typename type_INT>
+        static BigInteger fromIntegral(type_INT value){
+            if constexpr(std::is_unsigned<type_INT>::value){
+                return BigInteger::fromUnsigned(value);
+            }
+            else{
+                return BigInteger(static_cast<long long>(value));
+            }
+        }
+    public:
+        BigFraction():numerator(0),denominator(1){};
+        // 整数使用模板构造，避免字面量 0 在 long long 和 const char* 之间产生二义性
+        template<typename type_INT,typename = std::enable_if_t<std::is_integral<type_INT>::value>>
+        BigFraction(type_INT num):numerator(fromIntegral(num)),denominator(1){};
+        template<typename type_NUM,typename type_DEN,
+            typename = std::enable_if_t<std::is_integral<type_NUM>::value && std::is_integral<type_DEN>::value>>
+        BigFraction(type_NUM num,type_DEN den):numerator(fromIntegral(num)),denominator(fromIntegral(den)){
+            assert(den != 0);
+            this->reduce();
+        }
+        BigFraction(const BigInteger& num,const BigInteger& den = BigInteger(1)):numerator(num),denominator(den){
+            assert(!den.isZero());
+            this->reduce();
+        }
+        BigFraction(const Fraction& fraction):numerator(fraction.getNumerator()),denominator(fraction.getDenominator()){};
+        // 保留隐式转换，与 Fraction 相同
+        BigFraction(const char* str);
+        BigFraction(const BigFraction&) = default;
+        BigFraction(BigFraction&&) noexcept = default;
+        BigFraction& operator=(const BigFraction&) = default;
+        BigFraction& operator=(BigFraction&&) noexcept = default;
+
+        inline const BigInteger& getNumerator()const{
+            return this->numerator;
+        }
+        inline const BigInteger& getDenominator()const{
+            return this->denominator;
+        }
+        /**
+         * @brief 转换为 Fraction
+         * @throw AntonaStandard::Globals::Overflow_Error 分子或分母超出 int 的范围
+         */
+        Fraction toFraction()const;
+        double toDouble()const;
+
+        inline const BigFraction operator-()const{
+            BigFraction result(*this);
+            result.numerator = -result.numerator;
+            return result;
+        }
+        inline const BigFraction operator+()const{
+            return *this;
+        }
+        inline const BigFraction operator++(int){
+            BigFraction temp = *this;
+            ++(*this);
+            return temp;
+        }
+        inline const BigFraction operator--(int){
+            BigFraction temp = *this;
+            --(*this);
+            return temp;
+        }
+        inline const BigFraction operator++(){
+            // 分数已经是最简形式，加减分母后仍然是最简形式
+            this->numerator += this->denominator;
+            return *this;
+        }
+        inline const BigFraction operator--(){
+            this->numerator -= this->denominator;
+            return *this;
+        }
+
+        BigFraction& operator+=(const BigFraction& f);
+        BigFraction& operator-=(const BigFraction& f);
+        BigFraction& operator*=(const BigFraction& f);
+        BigFraction& operator/=(const BigFraction& f);
+
+        /// @brief 比较 lhs 和 rhs，返回负数、零或正数
+        static int compare(const BigFraction& lhs,const BigFraction& rhs);
+
+        friend std::istream& operator>>(std::istream& input,BigFraction& f);
+    };
+}
+#endif
@@ -0,0 +1,182 @@
+/**
+ * @file BigInteger.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义任意精度整数
+ * @details
+ *      能用 long long 表示的值直接保存在对象内部，运算使用带溢出检查的内建函数，不申请堆内存；
+ *      结果溢出时才转为以 32 位为一节（limb）的绝对值数组加符号位的形式。数组形式的值在运算后如果又能用 long long
+ *      表示，会转回内部形式，因此每个值只有唯一的表示。
+ *      - 乘法：较短的操作数不少于 karatsuba_threshold 节时使用 Karatsuba 算法，否则使用竖式乘法
+ *      - 除法：Knuth 算法 D，结果向零取整，余数的符号与被除数相同
+ *      - 最大公约数：两个数都超出 64 位时使用 Lehmer 算法，否则使用二进制 GCD
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_BIGINTEGER_H
+#define MATH_BIGINTEGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+#include <Globals/Exception.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        class BigInteger;
+
+        const BigInteger operator+(const BigInteger& lhs,const BigInteger& rhs);
+        const BigInteger operator-(const BigInteger& lhs,const BigInteger& rhs);
+        const BigInteger operator*(const BigInteger& lhs,const BigInteger& rhs);
+        const BigInteger operator/(const BigInteger& lhs,const BigInteger& rhs);
+        const BigInteger operator%(const BigInteger& lhs,const BigInteger& rhs);
+
+        bool operator==(const BigInteger& lhs,const BigInteger& rhs);
+        bool operator!=(const BigInteger& lhs,const BigInteger& rhs);
+        bool operator>(const BigInteger& lhs,const BigInteger& rhs);
+        bool operator>=(const BigInteger& lhs,const BigInteger& rhs);
+        bool operator<(const BigInteger& lhs,const BigInteger& rhs);
+        bool operator<=(const BigInteger& lhs,const BigInteger& rhs);
+
+        std::istream& operator>>(std::istream& input,BigInteger& rhs);
+        std::ostream& operator<<(std::ostream& output,const BigInteger& rhs);
+    }
+}
+
+namespace AntonaStandard::Math{
+    /**
+     * @brief 任意精度整数
+     */
+    class BigInteger{
+        TESTING_MESSAGE
+    public:
+        using Limb = std::uint32_t;
+        using Magnitude = std::vector<Limb>;
+        /// @brief 较短的操作数达到该节数时乘法使用 Karatsuba 算法
+        static constexpr std::size_t karatsuba_threshold = 32;
+    private:
+        long long small;        ///< limbs 为空时的值
+        Magnitude limbs;        ///< 超出 long long 时的绝对值，低位在前，最高节不为 0
+        bool negative;          ///< limbs 不为空时的符号
+
+        /// @brief 从符号和绝对值构造，能用 long long 表示时转为内部形式
+        static BigInteger fromMagnitude(bool negative,Magnitude&& magnitude);
+        /// @brief 获取绝对值，内部形式的值写入 buffer 后返回 buffer
+        const Magnitude& magnitude(Magnitude& buffer)const;
+        /// @brief 两个数都不是内部形式，或者内部形式的运算溢出时使用的通用实现
+        static BigInteger addSlow(const BigInteger& lhs,const BigInteger& rhs,bool subtract);
+        static BigInteger mulSlow(const BigInteger& lhs,const BigInteger& rhs);
+        static void divModSlow(const BigInteger& lhs,const BigInteger& rhs,BigInteger* quotient,BigInteger* remainder);
+    public:
+        BigInteger():small(0),negative(false){};
+        // 整数使用模板构造，按有无符号选择，避免 int、long、unsigned 等参数在多个重载之间产生二义性
+        template<typename type_INT,typename std::enable_if_t<std::is_integral<type_INT>::value && std::is_signed<type_INT>::value,int> = 0>
+        BigInteger(type_INT value):small(static_cast<long long>(value)),negative(false){};
+        /// @brief 无符号整数超出 long long 的值转为数组形式，不会变成负数
+        template<typename type_UINT,typename std::enable_if_t<std::is_integral<type_UINT>::value && std::is_unsigned<type_UINT>::value,int> = 0>
+        BigInteger(type_UINT value):small(0),negative(false){
+            if(static_cast<unsigned long long>(value) <= static_cast<unsigned long long>(std::numeric_limits<long long>::max())){
+                this->small = static_cast<long long>(value);
+            }
+            else{
+                *this = fromUnsigned(value);
+            }
+        };
+        /**
+         * @brief 从十进制字符串构造，允许前导的正负号
+         * @throw AntonaStandard::Globals::WrongArgument_Error 字符串不是合法的十进制整数
+         */
+        explicit BigInteger(std::string_view str);
+        /// @brief 从无符号整数构造，超出 long long 的值转为数组形式，不会变成负数
+        static BigInteger fromUnsigned(unsigned long long value);
+        BigInteger(const BigInteger&) = default;
+        BigInteger(BigInteger&&) noexcept = default;
+        BigInteger& operator=(const BigInteger&) = default;
+        BigInteger& operator=(BigInteger&&) noexcept = default;
+
+        /**
+         * @brief 按照 std::istream 读取整数的规则解析十进制整数
+         * @details 跳过前导空白，读取可选的符号和数字，没有数字时结果为 0 并返回 false
+         * @param pos 当前位置，返回时指向第一个未读取的字符
+         */
+        static bool parse(const char*& pos,const char* end,BigInteger& value);
+
+        /// @brief 是否以内部形式保存，即能否用 long long 表示
+        inline bool isSmall()const{
+            return this->limbs.empty();
+        }
+        inline bool isZero()const{
+            return this->limbs.empty() && this->small == 0;
+        }
+        inline bool isNegative()const{
+            return this->limbs.empty() ? this->small < 0 : this->negative;
+        }
+        /// @brief 符号，返回 -1、0 或 1
+        inline int sign()const{
+            if(this->limbs.empty()){
+                return (this->small > 0) - (this->small < 0);
+            }
+            return this->negative ? -1 : 1;
+        }
+        /**
+         * @brief 转换为 long long
+         * @throw AntonaStandard::Globals::Overflow_Error 超出 long long 的范围
+         */
+        long long toLongLong()const;
+        /// @brief 转换为浮点数，超出范围时为无穷大
+        double toDouble()const;
+        /// @brief 转换为十进制字符串
+        std::string toString()const;
+        /// @brief 绝对值的二进制位数，0 的位数为 0
+        std::size_t bitLength()const;
+        /// @brief 占用的节数，内部形式为 0
+        inline std::size_t limbCount()const{
+            return this->limbs.size();
+        }
+
+        BigInteger abs()const;
+        /**
+         * @brief 同时计算商和余数
+         * @throw AntonaStandard::Globals::UnlawfulOperation_Error 除数为 0
+         */
+        static void divMod(const BigInteger& lhs,const BigInteger& rhs,BigInteger& quotient,BigInteger& remainder);
+        /// @brief 最大公约数，结果非负，gcd(0,0) = 0
+        static BigInteger gcd(const BigInteger& lhs,const BigInteger& rhs);
+
+        const BigInteger operator-()const;
+        inline const BigInteger operator+()const{
+            return *this;
+        }
+        BigInteger& operator++();
+        BigInteger& operator--();
+        inline const BigInteger operator++(int){
+            BigInteger temp = *this;
+            ++(*this);
+            return temp;
+        }
+        inline const BigInteger operator--(int){
+            BigInteger temp = *this;
+            --(*this);
+            return temp;
+        }
+
+        BigInteger& operator+=(const BigInteger& rhs);
+        BigInteger& operator-=(const BigInteger& rhs);
+        BigInteger& operator*=(const BigInteger& rhs);
+        BigInteger& operator/=(const BigInteger& rhs);
+        BigInteger& operator%=(const BigInteger& rhs);
+
+        /// @brief 比较 lhs 和 rhs，返回负数、零或正数
+        static int compare(const BigInteger& lhs,const BigInteger& rhs);
+    };
+}
+#endif
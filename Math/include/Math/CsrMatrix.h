@@ -0,0 +1,102 @@
+/**
+ * @file CsrMatrix.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义以 CSR（压缩行）格式存储的双精度稀疏矩阵
+ * @details
+ *      非零元素按行连续存放，row_offsets[i] 到 row_offsets[i+1] 之间是第 i 行的列号和值，同一行内列号递增。
+ *      与向量相乘时逐行计算稀疏行与向量的内积，AVX2 和 AVX-512 通过 gather 指令一次读取多个 x 的元素，
+ *      指令集的选择与 NumericKernels 相同
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_CSRMATRIX_H
+#define MATH_CSRMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <Globals/Exception.h>
+#include <Math/Matrix.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        class CsrMatrix;
+    }
+}
+
+namespace AntonaStandard::Math{
+    /**
+     * @brief CSR 格式的稀疏矩阵
+     */
+    class CsrMatrix{
+        TESTING_MESSAGE
+    public:
+        /// @brief 构造时使用的三元组
+        struct Entry{
+            std::size_t row;
+            std::size_t column;
+            double value;
+        };
+    private:
+        std::size_t row_count = 0;
+        std::size_t column_count = 0;
+        std::vector<std::size_t> row_offsets{0};
+        std::vector<std::uint32_t> column_indices;
+        std::vector<double> element_values;
+
+        /// @brief 检查列数能否用 gather 指令的 32 位有符号下标表示
+        static void checkColumns(std::size_t columns);
+    public:
+        CsrMatrix() = default;
+        /**
+         * @brief 从三元组构造，顺序任意，相同位置的值相加
+         * @throw AntonaStandard::Globals::WrongArgument_Error 下标越界，或者列数超过 INT32_MAX
+         */
+        CsrMatrix(std::size_t rows,std::size_t columns,std::vector<Entry> entries);
+        /**
+         * @brief 从稠密矩阵构造，绝对值不超过 tolerance 的元素视为 0
+         * @throw AntonaStandard::Globals::WrongArgument_Error 列数超过 INT32_MAX
+         */
+        static CsrMatrix fromDense(const Matrix<double>& dense,double tolerance = 0.0);
+
+        inline std::size_t rows()const{
+            return this->row_count;
+        }
+        inline std::size_t columns()const{
+            return this->column_count;
+        }
+        /// @brief 非零元素的个数
+        inline std::size_t nonZeros()const{
+            return this->element_values.size();
+        }
+        inline const std::vector<std::size_t>& rowOffsets()const{
+            return this->row_offsets;
+        }
+        inline const std::vector<std::uint32_t>& columnIndices()const{
+            return this->column_indices;
+        }
+        inline const std::vector<double>& values()const{
+            return this->element_values;
+        }
+
+        /**
+         * @brief 获取元素，同一行内二分查找
+         * @throw AntonaStandard::Globals::WrongArgument_Error 下标越界
+         */
+        double at(std::size_t row,std::size_t column)const;
+        Matrix<double> toDense()const;
+
+        /// @brief y = A * x，x 的长度为列数，y 的长度为行数
+        void multiply(const double* x,double* y)const;
+        /**
+         * @brief 矩阵与向量相乘
+         * @throw AntonaStandard::Globals::WrongArgument_Error 向量长度与矩阵列数不同
+         */
+        friend std::vector<double> operator*(const CsrMatrix& lhs,const std::vector<double>& rhs);
+    };
+}
+#endif
@@ -4,6 +4,15 @@
  * @file Fraction.h
  * @author Anton (yunye_helloworld@qq.com)
  * @brief 定义数学分数类
+ * @details
+ *      构造、运算和比较都是 constexpr 的，常量表达式中的分数在编译期求值：
+ *      @code
+ *      using namespace AntonaStandard::Math::literals;
+ *      constexpr Fraction rate = 3_fr/4;               // 3/4
+ *      constexpr Fraction tax = "13/100"_fr;            // 13/100
+ *      constexpr Fraction third = ratio_v<std::ratio<1,3>>;
+ *      @endcode
+ *      只有流运算符在 Fraction.cpp 中实现
  * @version 1.0.0
  * @date 2024-03-07
  * 
@@ -13,7 +22,10 @@
 #include <sstream>
 #include <cassert>
 #include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <Globals/Exception.h>
+#include <Math/BasicFraction.h>
 #include <TestingSupport/TestingMessageMacro.h>
 
 namespace AntonaStandard{
@@ -25,23 +37,25 @@ namespace AntonaStandard{
     namespace Math{
         class Fraction;
         // 运算符，友元函数声明
-        const Fraction operator+(const Fraction& lhs,const Fraction& rhs);
+        constexpr const Fraction operator+(const Fraction& lhs,const Fraction& rhs);
 
-        const Fraction operator-(const Fraction& lhs,const Fraction& rhs);
+        constexpr const Fraction operator-(const Fraction& lhs,const Fraction& rhs);
 
-        const Fraction operator*(const Fraction& lhs,const Fraction& rhs);
+        constexpr const Fraction operator*(const Fraction& lhs,const Fraction& rhs);
 
-        const Fraction operator/(const Fraction& lhs,const Fraction& rhs);
+        constexpr const Fraction operator/(const Fraction& lhs,const Fraction& rhs);
             // 接收两个运算算子的引用，返回一个Fraction对象
 
-        bool operator==(const Fraction& lhs,const Fraction& rhs);
+        constexpr int compare(const Fraction& lhs,const Fraction& rhs);
+
+        constexpr bool operator==(const Fraction& lhs,const Fraction& rhs);
         
-        bool operator!=(const Fraction& lhs,const Fraction& rhs);
+        constexpr bool operator!=(const Fraction& lhs,const Fraction& rhs);
 
-        bool operator>(const Fraction& lhs,const Fraction& rhs);
-        bool operator>=(const Fraction& lhs,const Fraction& rhs);
-        bool operator<(const Fraction& lhs,const Fraction& rhs);
-        bool operator<=(const Fraction& lhs,const Fraction& rhs);
+        constexpr bool operator>(const Fraction& lhs,const Fraction& rhs);
+        constexpr bool operator>=(const Fraction& lhs,const Fraction& rhs);
+        constexpr bool operator<(const Fraction& lhs,const Fraction& rhs);
+        constexpr bool operator<=(const Fraction& lhs,const Fraction& rhs);
 
         std::istream& operator>>(std::istream& input,Fraction& rhs);
         std::ostream& operator<<(std::ostream& output,const Fraction& rhs);
@@ -53,13 +67,77 @@ namespace AntonaStandard::Math{
     /**
      * @brief 分数类
      * @details
-     *      支持从整数和字符串构造分数类
+     *      支持从整数和字符串构造分数类。
+     *      运算和比较在 64 位整数中进行，结果用二进制 GCD 化简，化简后仍然无法用 int 表示时抛出
+     *      AntonaStandard::Globals::Overflow_Error。需要惰性化简或者 64 位存储时使用 BasicFraction
      */
     class Fraction{
         TESTING_MESSAGE
     private:
         int numerator;      ///< 分子
         int denominator;    ///< 分母
+
+        /**
+         * @brief 用 64 位的分子分母设置分数，化简并保证分母为正
+         * @throw AntonaStandard::Globals::Overflow_Error 化简后无法用 int 表示
+         */
+        constexpr void assign(long long num,long long den){
+            assert(den != 0);
+            if(den < 0){
+                num = -num;
+                den = -den;
+            }
+            unsigned long long abs_num = num < 0 ? 0ULL - static_cast<unsigned long long>(num) : static_cast<unsigned long long>(num);
+            long long ratio = static_cast<long long>(binaryGcd<unsigned long long>(abs_num,static_cast<unsigned long long>(den)));
+            num /= ratio;
+            den /= ratio;
+            if(num < std::numeric_limits<int>::min() || num > std::numeric_limits<int>::max() || den > std::numeric_limits<int>::max()){
+                throw AntonaStandard::Globals::Overflow_Error("The fraction can not be represented by int!");
+            }
+            this->numerator = static_cast<int>(num);
+            this->denominator = static_cast<int>(den);
+        }
+        static constexpr bool isSpace(char c){
+            return c == ' ' || c == '\t' || c == '\n' || c == '\v' || c == '\f' || c == '\r';
+        }
+        /**
+         * @brief 按照 std::istream 读取 int 的规则解析整数
+         * @details 跳过前导空白，读取可选的符号和十进制数字；没有数字时结果为 0，超出范围时结果为 int 的最值，两种情况都视为失败
+         * @param pos 当前位置，返回时指向第一个未读取的字符
+         * @param value 解析结果
+         * @return bool 是否成功
+         */
+        static constexpr bool parseInt(const char*& pos,const char* end,int& value){
+            while(pos != end && isSpace(*pos)){
+                ++pos;
+            }
+            bool negative = false;
+            if(pos != end && (*pos == '+' || *pos == '-')){
+                negative = (*pos == '-');
+                ++pos;
+            }
+            const char* digits = pos;
+            long long result = 0;
+            bool overflow = false;
+            while(pos != end && *pos >= '0' && *pos <= '9'){
+                if(!overflow){
+                    result = result * 10 + (*pos - '0');
+                    overflow = result > static_cast<long long>(std::numeric_limits<int>::max()) + 1;
+                }
+                ++pos;
+            }
+            if(pos == digits){
+                value = 0;
+                return false;
+            }
+            result = negative ? -result : result;
+            if(overflow || result > std::numeric_limits<int>::max() || result < std::numeric_limits<int>::min()){
+                value = negative ? std::numeric_limits<int>::min() : std::numeric_limits<int>::max();
+                return false;
+            }
+            value = static_cast<int>(result);
+            return true;
+        }
     public:
         /**
          * @brief 欧几里得算法，计算最大公约数，用于化简分数
@@ -68,11 +146,11 @@ namespace AntonaStandard::Math{
          * @param den 
          * @return int 
          */
-        static int Euclid(int num, int den) {
+        static constexpr int Euclid(int num, int den) {
             // 计算两个数的最大公因数(欧几里得算法)
             
             // 声明为静态成员函数
-            int pivot;
+            int pivot = 0;
             while (num % den != 0) {
                 pivot = den;
                 den = num % den;
@@ -80,78 +158,227 @@ namespace AntonaStandard::Math{
             }
             return den;
         };
+        /**
+         * @brief 从字符串的 [str,end) 解析分数，规则与 operator>> 相同
+         * @details 格式为 "num" 或 "num/den"，num 解析失败时结果为 0/1，den 解析失败或为 0 时结果为 0/1
+         */
+        static constexpr Fraction parse(const char* str,const char* end){
+            int num = 0;
+            int den = 1;
+            if(parseInt(str,end,num) && str != end && *str == '/'){
+                ++str;
+                parseInt(str,end,den);
+                if(den == 0){
+                    num = 0;
+                    den = 1;
+                }
+            }
+            return Fraction(num,den);
+        }
+        /**
+         * @brief 从 64 位整数构造分数
+         * @throw AntonaStandard::Globals::Overflow_Error 化简后无法用 int 表示
+         */
+        static constexpr Fraction fromWide(long long num,long long den){
+            Fraction result;
+            result.assign(num,den);
+            return result;
+        }
         // 保留隐式转换，减少编程工作
-        Fraction(const char* str){
-            std::stringstream inistream(str);
-            inistream>>(*this);    
+        constexpr Fraction(const char* str):numerator(0),denominator(1){
+            const char* end = str;
+            while(*end != '\0'){
+                ++end;
+            }
+            *this = parse(str,end);
         }
-        Fraction(int num=0,int den=1){
+        constexpr Fraction(int num=0,int den=1):numerator(0),denominator(1){
             assert(den != 0);
-            int ratio = this->Euclid(num,den);
-            num /=ratio;
-            den /=ratio;
-            if(den <0){
-                num *= -1;
-                den *= -1;
-            }
-            this->numerator = num;
-            this->denominator = den;
+            this->assign(num,den);
         };
-        Fraction(const Fraction& f):numerator(f.getNumerator()),denominator(f.getDenominator()){};
+        constexpr Fraction(const Fraction& f):numerator(f.getNumerator()),denominator(f.getDenominator()){};
 
-        Fraction& operator=(const Fraction& rhs);
+        constexpr Fraction& operator=(const Fraction& rhs){
+            this->numerator = rhs.getNumerator();
+            this->denominator = rhs.getDenominator();
+            return *this;
+        }
 
-        inline int getNumerator()const{
+        inline constexpr int getNumerator()const{
             return numerator;
         }
         // 申明为不可修改数据的函数，const常函数
-        inline int getDenominator()const{
+        inline constexpr int getDenominator()const{
             return denominator;
         }
 
+        /// @brief 转换为 BasicFraction<int>
+        inline constexpr BasicFraction<int> toBasic()const{
+            return BasicFraction<int>(this->numerator,this->denominator);
+        }
+
 
         // 负号运算符，将一个分数变成其相反数
-        inline const Fraction  operator-(){
-            return Fraction(-this->getNumerator(),this->getDenominator());
+        inline constexpr const Fraction  operator-()const{
+            return fromWide(-static_cast<long long>(this->getNumerator()),this->getDenominator());
         }
 
-        inline const Fraction operator+(){
+        inline constexpr const Fraction operator+()const{
             return *this;
         }
 
-        inline const Fraction operator++(int){
+        inline constexpr const Fraction operator++(int){
             Fraction temp = *this;
             *this += Fraction(1);
             return temp;
         }
 
-        inline const Fraction operator--(int){
+        inline constexpr const Fraction operator--(int){
             Fraction temp = *this;
             *this -= Fraction(1);
             return temp;
         }
 
-        inline const Fraction operator--(){
+        inline constexpr const Fraction operator--(){
             *this -= Fraction(1);
             return *this;
         }
 
-        inline const Fraction operator++(){
+        inline constexpr const Fraction operator++(){
             *this += Fraction(1);
             return *this;
         }
 
-        Fraction& operator+=(const Fraction& f);
+        // "+="运算符作为成员函数进行重载，中间结果使用 64 位整数
+        constexpr Fraction& operator+=(const Fraction& f){
+            if(this->denominator == f.getDenominator()){
+                // 分母相同时直接合并分子
+                this->assign(static_cast<long long>(this->numerator) + f.getNumerator(), this->denominator);
+                return (*this);
+            }
+            long long retnum = static_cast<long long>(this->numerator) * f.getDenominator() + static_cast<long long>(this->denominator) * f.getNumerator();
+            long long retden = static_cast<long long>(this->denominator) * f.getDenominator();
+            this->assign(retnum, retden);
+            return (*this);
+        }
 
-        Fraction& operator-=(const Fraction& f);
+        // "-="运算符作为成员函数进行重载
+        constexpr Fraction& operator-=(const Fraction& f){
+            if(this->denominator == f.getDenominator()){
+                this->assign(static_cast<long long>(this->numerator) - f.getNumerator(), this->denominator);
+                return (*this);
+            }
+            long long retnum = static_cast<long long>(this->numerator) * f.getDenominator() - static_cast<long long>(this->denominator) * f.getNumerator();
+            long long retden = static_cast<long long>(this->denominator) * f.getDenominator();
+            this->assign(retnum, retden);
+            return (*this);
+        }
 
-        Fraction& operator*=(const Fraction& f);
+        // "*="运算符作为成员函数进行重载
+        constexpr Fraction& operator*=(const Fraction& f){
+            long long retnum = static_cast<long long>(this->numerator) * f.getNumerator();
+            long long retden = static_cast<long long>(this->denominator) * f.getDenominator();
+            this->assign(retnum, retden);
+            return *this;
+        }
 
-        Fraction& operator/=(const Fraction& f);
+        constexpr Fraction& operator/=(const Fraction& f){
+            long long retnum = static_cast<long long>(this->numerator) * f.getDenominator();
+            long long retden = static_cast<long long>(this->denominator) * f.getNumerator();
+            this->assign(retnum, retden);
+            return *this;
+        }
 
         friend std::istream& operator>>(std::istream& input,Fraction& f);
         
     };
+
+    /*			"+",加法重载部分					*/
+    // 二元运算符通过复合赋值运算符实现
+    constexpr const Fraction operator+(const Fraction& lhs, const Fraction& rhs) {
+        Fraction result(lhs);
+        result += rhs;
+        return result;
+    }
+
+    /*			"-",减法重载部分					*/
+    constexpr const Fraction operator-(const Fraction& lhs, const Fraction& rhs) {
+        Fraction result(lhs);
+        result -= rhs;
+        return result;
+    }
+
+    /*			"*",乘法重载部分					*/
+    constexpr const Fraction operator*(const Fraction& lhs, const Fraction& rhs) {
+        Fraction result(lhs);
+        result *= rhs;
+        return result;
+    }
+
+    /*          '/'乘法重载                 */
+    constexpr const Fraction operator/(const Fraction& lhs, const Fraction& rhs) {
+        Fraction result(lhs);
+        result /= rhs;
+        return result;
+    }
+
+    /// @brief 在 64 位整数中交叉相乘比较两个分数，分母均为正，返回负数、零或正数
+    constexpr int compare(const Fraction& lhs,const Fraction& rhs){
+        long long left = static_cast<long long>(lhs.getNumerator()) * rhs.getDenominator();
+        long long right = static_cast<long long>(rhs.getNumerator()) * lhs.getDenominator();
+        return (left > right) - (left < right);
+    }
+
+    constexpr bool operator==(const Fraction& lhs, const Fraction& rhs){
+        return compare(lhs,rhs) == 0;
+    }
+
+    constexpr bool operator!=(const Fraction& lhs, const Fraction& rhs){
+        return compare(lhs,rhs) != 0;
+    }
+
+    constexpr bool operator>(const Fraction& lhs, const Fraction& rhs){
+        return compare(lhs,rhs) > 0;
+    }
+
+    constexpr bool operator>=(const Fraction& lhs, const Fraction& rhs){
+        return compare(lhs,rhs) >= 0;
+    }
+
+    constexpr bool operator<(const Fraction& lhs, const Fraction& rhs){
+        return compare(lhs,rhs) < 0;
+    }
+
+    constexpr bool operator<=(const Fraction& lhs, const Fraction& rhs){
+        return compare(lhs,rhs) <= 0;
+    }
+
+    /**
+     * @brief 编译期有理数常量，把 std::ratio 转换为 Fraction
+     * @code
+     * constexpr Fraction third = ratio_v<std::ratio<1,3>>;
+     * @endcode
+     */
+    template<typename type_RATIO>
+    inline constexpr Fraction ratio_v = Fraction::fromWide(type_RATIO::num,type_RATIO::den);
+
+    /**
+     * @brief 分数字面量
+     * @details 使用 using namespace AntonaStandard::Math::literals; 引入
+     */
+    inline namespace literals{
+        /// @brief 整数字面量，3_fr/4 在编译期求值为 3/4
+        constexpr Fraction operator""_fr(unsigned long long value){
+            if(value > static_cast<unsigned long long>(std::numeric_limits<int>::max())){
+                throw AntonaStandard::Globals::Overflow_Error("The fraction literal can not be represented by int!");
+            }
+            return Fraction(static_cast<int>(value));
+        }
+        /// @brief 字符串字面量，"3/4"_fr 在编译期求值为 3/4
+        constexpr Fraction operator""_fr(const char* str,std::size_t size){
+            return Fraction::parse(str,str + size);
+        }
+    }
 }
 
 #endif // FRACTION_H
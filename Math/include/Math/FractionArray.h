@@ -0,0 +1,150 @@
+/**
+ * @file FractionArray.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义以结构数组（SoA）布局存储的分数数组
+ * @details
+ *      对大量分数逐个调用 Fraction::operator+ 时，每次运算都要化简。FractionArray 把分子和分母分别存放在两个连续的
+ *      int 数组中，批量运算时每次处理 8 个分数：
+ *      - 加法、乘法在 64 位通道中交叉相乘，结果能放进 int 时直接保存，不化简（与 BasicFraction 相同的惰性化简）；
+ *        某一批中有结果放不下时，这一批退回标量运算
+ *      - 比较在 64 位通道中交叉相乘
+ *      - 化简使用向量化的二进制 GCD，除法通过双精度浮点数完成（商为整数，结果精确）
+ *
+ *      运行时检测 CPU 是否支持 AVX2，不支持时使用标量实现（没有单独的 SSE2 和 AVX-512 实现）。分母始终为正，元素不一定是最简形式
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_FRACTIONARRAY_H
+#define MATH_FRACTIONARRAY_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+#include <Globals/Exception.h>
+#include <Math/BasicFraction.h>
+#include <Math/Fraction.h>
+#include <Math/SimdLevel.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        class FractionArray;
+    }
+}
+
+namespace AntonaStandard::Math{
+    /**
+     * @brief 以结构数组布局存储的分数数组
+     */
+    class FractionArray{
+        TESTING_MESSAGE
+    private:
+        std::vector<int> numerators;    ///< 分子
+        std::vector<int> denominators;  ///< 分母，始终为正
+
+        /// @brief 检查两个数组的长度是否相同
+        static void checkSize(const FractionArray& lhs,const FractionArray& rhs);
+    public:
+        FractionArray() = default;
+        /// @brief 构造 size 个 0/1
+        explicit FractionArray(std::size_t size):numerators(size,0),denominators(size,1){};
+        FractionArray(std::initializer_list<Fraction> fractions);
+
+        inline std::size_t size()const{
+            return this->numerators.size();
+        }
+        inline bool empty()const{
+            return this->numerators.empty();
+        }
+        inline void reserve(std::size_t size){
+            this->numerators.reserve(size);
+            this->denominators.reserve(size);
+        }
+        /// @brief 调整长度，新增的元素为 0/1
+        inline void resize(std::size_t size){
+            this->numerators.resize(size,0);
+            this->denominators.resize(size,1);
+        }
+        inline void clear(){
+            this->numerators.clear();
+            this->denominators.clear();
+        }
+        /// @brief 追加分数，分母不能为 0，不化简
+        void push_back(int num,int den = 1);
+        inline void push_back(const Fraction& fraction){
+            this->numerators.push_back(fraction.getNumerator());
+            this->denominators.push_back(fraction.getDenominator());
+        }
+        /// @brief 获取第 index 个分数的最简形式
+        inline Fraction get(std::size_t index)const{
+            return Fraction(this->numerators[index],this->denominators[index]);
+        }
+        /// @brief 获取第 index 个分数，不化简
+        inline BasicFraction<int> getBasic(std::size_t index)const{
+            return BasicFraction<int>(this->numerators[index],this->denominators[index]);
+        }
+        inline void set(std::size_t index,const Fraction& fraction){
+            this->numerators[index] = fraction.getNumerator();
+            this->denominators[index] = fraction.getDenominator();
+        }
+        inline const int* numeratorData()const{
+            return this->numerators.data();
+        }
+        inline const int* denominatorData()const{
+            return this->denominators.data();
+        }
+
+        /**
+         * @brief 逐元素相加，out 可以是 lhs 或 rhs
+         * @throw AntonaStandard::Globals::WrongArgument_Error 长度不同
+         * @throw AntonaStandard::Globals::Overflow_Error 化简后仍然无法用 int 表示
+         */
+        static void add(const FractionArray& lhs,const FractionArray& rhs,FractionArray& out);
+        /**
+         * @brief 逐元素相乘，out 可以是 lhs 或 rhs
+         * @throw AntonaStandard::Globals::WrongArgument_Error 长度不同
+         * @throw AntonaStandard::Globals::Overflow_Error 化简后仍然无法用 int 表示
+         */
+        static void mul(const FractionArray& lhs,const FractionArray& rhs,FractionArray& out);
+        /**
+         * @brief 逐元素比较，out[i] 为 -1、0 或 1，分别表示 lhs[i] 小于、等于或大于 rhs[i]
+         * @throw AntonaStandard::Globals::WrongArgument_Error 长度不同
+         */
+        static void compare(const FractionArray& lhs,const FractionArray& rhs,std::vector<signed char>& out);
+        /// @brief 把所有元素化简为最简形式
+        void normalize();
+
+        FractionArray& operator+=(const FractionArray& rhs){
+            add(*this,rhs,*this);
+            return *this;
+        }
+        FractionArray& operator*=(const FractionArray& rhs){
+            mul(*this,rhs,*this);
+            return *this;
+        }
+        friend FractionArray operator+(const FractionArray& lhs,const FractionArray& rhs){
+            FractionArray result;
+            add(lhs,rhs,result);
+            return result;
+        }
+        friend FractionArray operator*(const FractionArray& lhs,const FractionArray& rhs){
+            FractionArray result;
+            mul(lhs,rhs,result);
+            return result;
+        }
+
+        /// @brief 获取批量运算当前使用的指令集
+        static SimdLevel simdLevel();
+        /**
+         * @brief 设置批量运算使用的指令集，用于测试和性能对比
+         * @return SimdLevel 实际使用的指令集：SSE2 使用标量实现，AVX512 使用 AVX2 实现，CPU 不支持时退回标量实现
+         */
+        static SimdLevel setSimdLevel(SimdLevel level);
+        /// @brief 获取 CPU 支持的、FractionArray 有对应实现的最高指令集
+        static SimdLevel supportedSimdLevel();
+    };
+}
+#endif
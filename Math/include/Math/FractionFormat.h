@@ -0,0 +1,61 @@
+/**
+ * @file FractionFormat.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 分数的快速解析和格式化
+ * @details
+ *      仿照 std::from_chars 和 std::to_chars，直接读写调用方提供的字符区间，不申请内存，不经过 iostream：
+ *      - from_chars 解析 "num" 或 "num/den"，不跳过空白，不接受正号；den 为 0 或者数值超出 int 时报错，
+ *        失败时不修改 value
+ *      - to_chars 按照 operator<< 的格式 "num/den" 输出
+ *      - parseFractions 批量解析以逗号或换行分隔的文本，字段两侧可以有空格、制表符，行尾可以是 "\r\n"，空行被忽略；
+ *        输出到 FractionArray 时与 FractionArray 的运算一样不化简，省去每个分数的 GCD
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_FRACTIONFORMAT_H
+#define MATH_FRACTIONFORMAT_H
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#include <Globals/Exception.h>
+#include <Math/Fraction.h>
+#include <Math/FractionArray.h>
+
+namespace AntonaStandard::Math{
+    /// @brief to_chars 输出一个分数最多需要的字符数："-2147483648/2147483647"
+    constexpr std::size_t fraction_chars_max = 22;
+
+    /**
+     * @brief 从 [first,last) 解析分数
+     * @return std::from_chars_result
+     *      - 成功时 ptr 指向第一个未解析的字符，ec 为空
+     *      - 没有数字或者分母为 0 时 ptr 为 first，ec 为 std::errc::invalid_argument
+     *      - 分子或分母超出 int 时 ptr 指向数字之后，ec 为 std::errc::result_out_of_range
+     */
+    std::from_chars_result from_chars(const char* first,const char* last,Fraction& value);
+    inline std::from_chars_result from_chars(std::string_view str,Fraction& value){
+        return from_chars(str.data(),str.data() + str.size(),value);
+    }
+
+    /**
+     * @brief 把分数以 "num/den" 的格式写入 [first,last)
+     * @return std::to_chars_result 空间不足时 ptr 为 last，ec 为 std::errc::value_too_large
+     */
+    std::to_chars_result to_chars(char* first,char* last,const Fraction& value);
+
+    /**
+     * @brief 批量解析以逗号或换行分隔的分数，结果追加到 out 的末尾
+     * @return std::size_t 解析的个数
+     * @throw AntonaStandard::Globals::DataCorrupted_Error 字段不是合法的分数，异常信息中包含出错的偏移量，
+     *      此前解析的分数仍然保留在 out 中
+     */
+    std::size_t parseFractions(std::string_view text,std::vector<Fraction>& out);
+    std::size_t parseFractions(std::string_view text,FractionArray& out);
+}
+#endif
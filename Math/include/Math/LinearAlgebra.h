@@ -0,0 +1,65 @@
+/**
+ * @file LinearAlgebra.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 有理数矩阵的精确行列式和线性方程组求解
+ * @details
+ *      直接对分数做高斯消元时，每一步都要通分和化简，分子分母的长度会随消元步数成倍增长。这里的做法是：
+ *      - 先把每一行乘以该行分母的最小公倍数，得到整数矩阵，行列式相差的倍数就是这些公倍数的乘积
+ *      - 对整数矩阵做 Bareiss 无分数消元：第 k 步的元素等于原矩阵的 k+1 阶子式，每一步的除法都是整除，
+ *        中间结果的长度不超过 Hadamard 界，只随阶数线性增长
+ *      - 解方程时所有未知数有相同的分母（增广矩阵消元后的最后一个主元），回代时同样只做整除
+ *
+ *      传入线程池时，每一步消元把主元以下的行分给线程池并行更新，调用线程也参与计算。
+ *      不要在线程池的任务中调用这些函数，否则所有工作线程都可能在等待子任务而无法继续
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_LINEARALGEBRA_H
+#define MATH_LINEARALGEBRA_H
+
+#include <cstddef>
+#include <vector>
+#include <Globals/Exception.h>
+#include <Math/BigFraction.h>
+#include <Math/BigInteger.h>
+#include <Math/Fraction.h>
+#include <Math/Matrix.h>
+#include <ThreadTools/ThreadsPool.h>
+
+namespace AntonaStandard::Math{
+    using FractionMatrix = Matrix<Fraction>;
+    using BigFractionMatrix = Matrix<BigFraction>;
+
+    /// @brief 每个并行任务至少处理的行数，行数更少时不值得提交任务
+    constexpr std::size_t bareiss_rows_per_task = 4;
+
+    /**
+     * @brief 对整数矩阵原地做 Bareiss 消元，前 pivot_columns 列选主元
+     * @details
+     *      消元后前 pivot_columns 列为上三角形式，最后一个主元等于原矩阵前 pivot_columns 列构成的方阵的行列式（考虑行交换的符号）
+     * @param pool 为 nullptr 时在当前线程完成
+     * @return int 行交换带来的符号 1 或 -1，矩阵奇异时返回 0
+     */
+    int bareissEliminate(Matrix<BigInteger>& matrix,std::size_t pivot_columns,AntonaStandard::ThreadTools::ThreadsPool* pool = nullptr);
+
+    /**
+     * @brief 计算方阵的行列式
+     * @throw AntonaStandard::Globals::WrongArgument_Error 矩阵不是方阵
+     */
+    BigFraction determinant(const BigFractionMatrix& matrix,AntonaStandard::ThreadTools::ThreadsPool* pool = nullptr);
+    BigFraction determinant(const FractionMatrix& matrix,AntonaStandard::ThreadTools::ThreadsPool* pool = nullptr);
+
+    /**
+     * @brief 求解 matrix * x = rhs
+     * @throw AntonaStandard::Globals::WrongArgument_Error 矩阵不是方阵，或者 rhs 的长度与矩阵阶数不同
+     * @throw AntonaStandard::Globals::UnlawfulOperation_Error 矩阵奇异
+     */
+    std::vector<BigFraction> solve(const BigFractionMatrix& matrix,const std::vector<BigFraction>& rhs,
+        AntonaStandard::ThreadTools::ThreadsPool* pool = nullptr);
+    std::vector<BigFraction> solve(const FractionMatrix& matrix,const std::vector<Fraction>& rhs,
+        AntonaStandard::ThreadTools::ThreadsPool* pool = nullptr);
+}
+#endif
@@ -0,0 +1,262 @@
+/**
+ * @file Matrix.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义稠密矩阵模板
+ * @details
+ *      Matrix 以行主序把元素存放在一段连续内存中，元素类型可以是 Fraction、BigFraction、BigInteger 等支持四则运算的类型。
+ *      矩阵乘法按 block_size 分块，内层循环按 i-k-j 的顺序访问，两个操作数和结果都按行连续读写，
+ *      分块后参与运算的子块能留在缓存中。精确求解行列式和线性方程组见 LinearAlgebra.h
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_MATRIX_H
+#define MATH_MATRIX_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <ostream>
+#include <utility>
+#include <vector>
+#include <Globals/Exception.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        template<typename type_VALUE>
+        class Matrix;
+    }
+}
+
+namespace AntonaStandard::Math{
+    /**
+     * @brief 行主序存储的稠密矩阵
+     * @tparam type_VALUE 元素类型，默认构造的值为 0，可以从整数 1 构造
+     */
+    template<typename type_VALUE>
+    class Matrix{
+        TESTING_MESSAGE
+    public:
+        using value_type = type_VALUE;
+        /// @brief 矩阵乘法分块的边长
+        static constexpr std::size_t block_size = 32;
+    private:
+        std::size_t row_count = 0;
+        std::size_t column_count = 0;
+        std::vector<type_VALUE> elements;
+
+        inline static void checkSameShape(const Matrix& lhs,const Matrix& rhs){
+            if(lhs.row_count != rhs.row_count || lhs.column_count != rhs.column_count){
+                throw AntonaStandard::Globals::WrongArgument_Error("The shapes of the matrices are different!");
+            }
+        }
+    public:
+        Matrix() = default;
+        /// @brief 构造 rows 行 columns 列的零矩阵
+        Matrix(std::size_t rows,std::size_t columns):row_count(rows),column_count(columns),elements(rows * columns){};
+        /**
+         * @brief 按行构造矩阵
+         * @throw AntonaStandard::Globals::WrongArgument_Error 各行长度不同
+         */
+        Matrix(std::initializer_list<std::initializer_list<type_VALUE>> rows):row_count(rows.size()){
+            this->column_count = rows.size() == 0 ? 0 : rows.begin()->size();
+            this->elements.reserve(this->row_count * this->column_count);
+            for(const auto& row:rows){
+                if(row.size() != this->column_count){
+                    throw AntonaStandard::Globals::WrongArgument_Error("The rows of the matrix have different lengths!");
+                }
+                this->elements.insert(this->elements.end(),row.begin(),row.end());
+            }
+        }
+        /// @brief 从其他元素类型的矩阵逐个转换
+        template<typename type_OTHER>
+        explicit Matrix(const Matrix<type_OTHER>& other):row_count(other.rows()),column_count(other.columns()){
+            this->elements.reserve(this->row_count * this->column_count);
+            for(std::size_t i = 0;i < this->row_count;++i){
+                for(std::size_t j = 0;j < this->column_count;++j){
+                    this->elements.emplace_back(other(i,j));
+                }
+            }
+        }
+
+        /// @brief n 阶单位矩阵
+        static Matrix identity(std::size_t n){
+            Matrix result(n,n);
+            for(std::size_t i = 0;i < n;++i){
+                result(i,i) = type_VALUE(1);
+            }
+            return result;
+        }
+
+        inline std::size_t rows()const{
+            return this->row_count;
+        }
+        inline std::size_t columns()const{
+            return this->column_count;
+        }
+        inline bool isSquare()const{
+            return this->row_count == this->column_count;
+        }
+
+        inline type_VALUE& operator()(std::size_t row,std::size_t column){
+            return this->elements[row * this->column_count + column];
+        }
+        inline const type_VALUE& operator()(std::size_t row,std::size_t column)const{
+            return this->elements[row * this->column_count + column];
+        }
+        /// @brief 返回第 row 行的首元素，同一行的元素连续存放
+        inline type_VALUE* rowData(std::size_t row){
+            return this->elements.data() + row * this->column_count;
+        }
+        inline const type_VALUE* rowData(std::size_t row)const{
+            return this->elements.data() + row * this->column_count;
+        }
+
+        /**
+         * @brief 带边界检查的访问
+         * @throw AntonaStandard::Globals::WrongArgument_Error 下标越界
+         */
+        type_VALUE& at(std::size_t row,std::size_t column){
+            if(row >= this->row_count || column >= this->column_count){
+                throw AntonaStandard::Globals::WrongArgument_Error("The index of the matrix is out of range!");
+            }
+            return (*this)(row,column);
+        }
+        const type_VALUE& at(std::size_t row,std::size_t column)const{
+            return const_cast<Matrix*>(this)->at(row,column);
+        }
+
+        void swapRows(std::size_t lhs,std::size_t rhs){
+            if(lhs == rhs){
+                return;
+            }
+            std::swap_ranges(this->rowData(lhs),this->rowData(lhs) + this->column_count,this->rowData(rhs));
+        }
+
+        Matrix transpose()const{
+            Matrix result(this->column_count,this->row_count);
+            for(std::size_t i = 0;i < this->row_count;++i){
+                for(std::size_t j = 0;j < this->column_count;++j){
+                    result(j,i) = (*this)(i,j);
+                }
+            }
+            return result;
+        }
+
+        Matrix& operator+=(const Matrix& rhs){
+            checkSameShape(*this,rhs);
+            for(std::size_t i = 0;i < this->elements.size();++i){
+                this->elements[i] += rhs.elements[i];
+            }
+            return *this;
+        }
+        Matrix& operator-=(const Matrix& rhs){
+            checkSameShape(*this,rhs);
+            for(std::size_t i = 0;i < this->elements.size();++i){
+                this->elements[i] -= rhs.elements[i];
+            }
+            return *this;
+        }
+        Matrix& operator*=(const type_VALUE& scalar){
+            for(auto& element:this->elements){
+                element *= scalar;
+            }
+            return *this;
+        }
+        Matrix& operator*=(const Matrix& rhs){
+            *this = (*this) * rhs;
+            return *this;
+        }
+
+        friend Matrix operator+(Matrix lhs,const Matrix& rhs){
+            lhs += rhs;
+            return lhs;
+        }
+        friend Matrix operator-(Matrix lhs,const Matrix& rhs){
+            lhs -= rhs;
+            return lhs;
+        }
+        friend Matrix operator*(Matrix lhs,const type_VALUE& scalar){
+            lhs *= scalar;
+            return lhs;
+        }
+        /**
+         * @brief 分块矩阵乘法
+         * @throw AntonaStandard::Globals::WrongArgument_Error lhs 的列数与 rhs 的行数不同
+         */
+        friend Matrix operator*(const Matrix& lhs,const Matrix& rhs){
+            if(lhs.column_count != rhs.row_count){
+                throw AntonaStandard::Globals::WrongArgument_Error("The shapes of the matrices can not be multiplied!");
+            }
+            Matrix result(lhs.row_count,rhs.column_count);
+            const std::size_t n = lhs.row_count;
+            const std::size_t m = lhs.column_count;
+            const std::size_t p = rhs.column_count;
+            for(std::size_t ii = 0;ii < n;ii += block_size){
+                const std::size_t i_end = std::min(ii + block_size,n);
+                for(std::size_t kk = 0;kk < m;kk += block_size){
+                    const std::size_t k_end = std::min(kk + block_size,m);
+                    for(std::size_t jj = 0;jj < p;jj += block_size){
+                        const std::size_t j_end = std::min(jj + block_size,p);
+                        for(std::size_t i = ii;i < i_end;++i){
+                            type_VALUE* result_row = result.rowData(i);
+                            for(std::size_t k = kk;k < k_end;++k){
+                                const type_VALUE& factor = lhs(i,k);
+                                if(factor == type_VALUE()){
+                                    // 有理数乘法开销大，跳过零元素
+                                    continue;
+                                }
+                                const type_VALUE* rhs_row = rhs.rowData(k);
+                                for(std::size_t j = jj;j < j_end;++j){
+                                    result_row[j] += factor * rhs_row[j];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+            return result;
+        }
+        /**
+         * @brief 矩阵与列向量相乘
+         * @throw AntonaStandard::Globals::WrongArgument_Error 向量长度与矩阵列数不同
+         */
+        friend std::vector<type_VALUE> operator*(const Matrix& lhs,const std::vector<type_VALUE>& rhs){
+            if(lhs.column_count != rhs.size()){
+                throw AntonaStandard::Globals::WrongArgument_Error("The size of the vector is different from the columns of the matrix!");
+            }
+            std::vector<type_VALUE> result(lhs.row_count);
+            for(std::size_t i = 0;i < lhs.row_count;++i){
+                const type_VALUE* row = lhs.rowData(i);
+                for(std::size_t j = 0;j < lhs.column_count;++j){
+                    result[i] += row[j] * rhs[j];
+                }
+            }
+            return result;
+        }
+
+        friend bool operator==(const Matrix& lhs,const Matrix& rhs){
+            return lhs.row_count == rhs.row_count && lhs.column_count == rhs.column_count && lhs.elements == rhs.elements;
+        }
+        friend bool operator!=(const Matrix& lhs,const Matrix& rhs){
+            return !(lhs == rhs);
+        }
+        /// @brief 每行输出一行，元素之间以空格分隔
+        friend std::ostream& operator<<(std::ostream& output,const Matrix& matrix){
+            for(std::size_t i = 0;i < matrix.row_count;++i){
+                for(std::size_t j = 0;j < matrix.column_count;++j){
+                    if(j != 0){
+                        output<<' ';
+                    }
+                    output<<matrix(i,j);
+                }
+                output<<'\n';
+            }
+            return output;
+        }
+    };
+}
+#endif
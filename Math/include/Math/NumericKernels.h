@@ -0,0 +1,82 @@
+/**
+ * @file NumericKernels.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义双精度浮点数的向量和矩阵运算内核
+ * @details
+ *      提供 BLAS 风格的接口，矩阵按行主序存储，ld* 参数为相邻两行首元素之间的距离：
+ *      - 一级：dot、axpy、sum、maxAbs、norm2
+ *      - 二级：gemv，以及 CSR 格式稀疏矩阵与向量的乘法 spmv（见 CsrMatrix.h）
+ *      - 三级：gemm，按 GotoBLAS 的方式分块：B 的 depth×columns 子块和 A 的 rows×depth 子块分别打包成连续的窄条，
+ *        由 6 行的寄存器分块内核计算，分块大小按 L1/L2 缓存选取
+ *
+ *      运行时检测 CPU 支持的指令集（SSE2、AVX2+FMA、AVX-512F），选择对应的实现。
+ *      不同指令集的累加顺序不同，归约的结果可能在最后几位有差别
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_NUMERICKERNELS_H
+#define MATH_NUMERICKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <Math/SimdLevel.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Math{
+        class NumericKernels;
+    }
+}
+
+namespace AntonaStandard::Math{
+    /**
+     * @brief 双精度浮点数运算内核
+     */
+    class NumericKernels{
+        TESTING_MESSAGE
+    public:
+        /// @brief 返回 x 和 y 的内积
+        static double dot(const double* x,const double* y,std::size_t n);
+        /// @brief y = alpha * x + y
+        static void axpy(double alpha,const double* x,double* y,std::size_t n);
+        static double sum(const double* x,std::size_t n);
+        /// @brief 绝对值的最大值，n 为 0 时返回 0
+        static double maxAbs(const double* x,std::size_t n);
+        /// @brief 欧几里得范数
+        static double norm2(const double* x,std::size_t n);
+
+        /**
+         * @brief y = alpha * A * x + beta * y，A 为 rows 行 columns 列
+         * @details beta 为 0 时不读取 y 原来的值
+         */
+        static void gemv(std::size_t rows,std::size_t columns,double alpha,const double* a,std::size_t lda,
+            const double* x,double beta,double* y);
+        /**
+         * @brief C = alpha * A * B + beta * C，A 为 m 行 k 列，B 为 k 行 n 列
+         * @details beta 为 0 时不读取 C 原来的值
+         */
+        static void gemm(std::size_t m,std::size_t n,std::size_t k,double alpha,const double* a,std::size_t lda,
+            const double* b,std::size_t ldb,double beta,double* c,std::size_t ldc);
+        /**
+         * @brief CSR 格式稀疏矩阵与向量相乘，y = A * x
+         * @param row_offsets 长度为 rows + 1，第 i 行的非零元素位于 [row_offsets[i],row_offsets[i+1])
+         * @param column_indices 非零元素的列号，不超过 INT32_MAX
+         */
+        static void spmv(std::size_t rows,const std::size_t* row_offsets,const std::uint32_t* column_indices,
+            const double* values,const double* x,double* y);
+
+        /// @brief 获取当前使用的指令集
+        static SimdLevel simdLevel();
+        /**
+         * @brief 设置使用的指令集，用于测试和性能对比
+         * @return SimdLevel 实际使用的指令集，CPU 不支持时退回支持的最高指令集
+         */
+        static SimdLevel setSimdLevel(SimdLevel level);
+        /// @brief 获取 CPU 支持的最高指令集
+        static SimdLevel supportedSimdLevel();
+    };
+}
+#endif
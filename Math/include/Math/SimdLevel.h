@@ -0,0 +1,41 @@
+/**
+ * @file SimdLevel.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义批量运算使用的指令集以及运行时检测
+ * @details
+ *      FractionArray、NumericKernels 等批量运算在运行时检测 CPU 支持的指令集，选择对应的实现。
+ *      枚举值按能力从低到高排列，可以直接比较大小
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef MATH_SIMDLEVEL_H
+#define MATH_SIMDLEVEL_H
+
+namespace AntonaStandard{
+    namespace Math{
+        enum class SimdLevel;
+    }
+}
+
+namespace AntonaStandard::Math{
+    /// @brief 批量运算使用的指令集
+    enum class SimdLevel{
+        Scalar,
+        SSE2,
+        AVX2,       ///< 同时要求 FMA
+        AVX512      ///< AVX-512F
+    };
+
+    /**
+     * @brief 检测 CPU 和操作系统支持的最高指令集
+     * @details 非 x86 平台或者编译器不支持运行时检测时返回 SimdLevel::Scalar
+     */
+    SimdLevel cpuSimdLevel();
+
+    /// @brief 指令集的名称，用于输出
+    const char* simdLevelName(SimdLevel level);
+}
+#endif
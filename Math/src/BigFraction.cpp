@@ -0,0 +1,159 @@
+#include <Math/BigFraction.h>
+#include <cstring>
+
+namespace AntonaStandard::Math{
+    void BigFraction::reduce(){
+        if(this->denominator.isNegative()){
+            this->numerator = -this->numerator;
+            this->denominator = -this->denominator;
+        }
+        BigInteger ratio = BigInteger::gcd(this->numerator,this->denominator);
+        if(ratio != 1){
+            this->numerator /= ratio;
+            this->denominator /= ratio;
+        }
+    }
+
+    BigFraction::BigFraction(const char* str):numerator(0),denominator(1){
+        const char* end = str + std::strlen(str);
+        BigInteger num;
+        BigInteger den(1);
+        if(BigInteger::parse(str,end,num) && str != end && *str == '/'){
+            ++str;
+            BigInteger::parse(str,end,den);
+            if(den.isZero()){
+                num = 0;
+                den = 1;
+            }
+        }
+        *this = BigFraction(num,den);
+    }
+
+    Fraction BigFraction::toFraction()const{
+        return Fraction::fromWide(this->numerator.toLongLong(),this->denominator.toLongLong());
+    }
+
+    double BigFraction::toDouble()const{
+        return this->numerator.toDouble() / this->denominator.toDouble();
+    }
+
+    // 加减法：设 g = gcd(b,d)，a/b + c/d = (a*(d/g) + c*(b/g)) / (b/g*d)，只需要再与 g 约分
+    BigFraction& BigFraction::operator+=(const BigFraction& f){
+        BigInteger ratio = BigInteger::gcd(this->denominator,f.denominator);
+        if(ratio == 1){
+            this->numerator = this->numerator * f.denominator + f.numerator * this->denominator;
+            this->denominator *= f.denominator;
+            return *this;
+        }
+        BigInteger temp = this->numerator * (f.denominator / ratio) + f.numerator * (this->denominator / ratio);
+        BigInteger rest = BigInteger::gcd(temp,ratio);
+        this->numerator = temp / rest;
+        this->denominator = (this->denominator / ratio) * (f.denominator / rest);
+        return *this;
+    }
+
+    BigFraction& BigFraction::operator-=(const BigFraction& f){
+        return (*this) += -f;
+    }
+
+    // 乘法：先交叉约分，结果直接是最简形式
+    BigFraction& BigFraction::operator*=(const BigFraction& f){
+        BigInteger lhs_ratio = BigInteger::gcd(this->numerator,f.denominator);
+        BigInteger rhs_ratio = BigInteger::gcd(f.numerator,this->denominator);
+        if(lhs_ratio.isZero() || rhs_ratio.isZero()){
+            // 分母不为 0，gcd 为 0 只会在分子为 0 时出现，此时结果为 0
+            *this = BigFraction();
+            return *this;
+        }
+        this->numerator = (this->numerator / lhs_ratio) * (f.numerator / rhs_ratio);
+        this->denominator = (this->denominator / rhs_ratio) * (f.denominator / lhs_ratio);
+        return *this;
+    }
+
+    BigFraction& BigFraction::operator/=(const BigFraction& f){
+        assert(!f.numerator.isZero());
+        BigFraction reciprocal;
+        reciprocal.numerator = f.denominator;
+        reciprocal.denominator = f.numerator;
+        if(reciprocal.denominator.isNegative()){
+            reciprocal.numerator = -reciprocal.numerator;
+            reciprocal.denominator = -reciprocal.denominator;
+        }
+        return (*this) *= reciprocal;
+    }
+
+    int BigFraction::compare(const BigFraction& lhs,const BigFraction& rhs){
+        return BigInteger::compare(lhs.numerator * rhs.denominator,rhs.numerator * lhs.denominator);
+    }
+
+    const BigFraction operator+(const BigFraction& lhs,const BigFraction& rhs){
+        BigFraction result(lhs);
+        result += rhs;
+        return result;
+    }
+
+    const BigFraction operator-(const BigFraction& lhs,const BigFraction& rhs){
+        BigFraction result(lhs);
+        result -= rhs;
+        return result;
+    }
+
+    const BigFraction operator*(const BigFraction& lhs,const BigFraction& rhs){
+        BigFraction result(lhs);
+        result *= rhs;
+        return result;
+    }
+
+    const BigFraction operator/(const BigFraction& lhs,const BigFraction& rhs){
+        BigFraction result(lhs);
+        result /= rhs;
+        return result;
+    }
+
+    bool operator==(const BigFraction& lhs,const BigFraction& rhs){
+        // 两者都是最简形式，直接比较分子分母
+        return lhs.getNumerator() == rhs.getNumerator() && lhs.getDenominator() == rhs.getDenominator();
+    }
+
+    bool operator!=(const BigFraction& lhs,const BigFraction& rhs){
+        return !(lhs == rhs);
+    }
+
+    bool operator>(const BigFraction& lhs,const BigFraction& rhs){
+        return BigFraction::compare(lhs,rhs) > 0;
+    }
+
+    bool operator>=(const BigFraction& lhs,const BigFraction& rhs){
+        return BigFraction::compare(lhs,rhs) >= 0;
+    }
+
+    bool operator<(const BigFraction& lhs,const BigFraction& rhs){
+        return BigFraction::compare(lhs,rhs) < 0;
+    }
+
+    bool operator<=(const BigFraction& lhs,const BigFraction& rhs){
+        return BigFraction::compare(lhs,rhs) <= 0;
+    }
+
+    std::istream& operator>>(std::istream& input,BigFraction& f){
+        BigInteger numerator;
+        BigInteger denominator(1);
+        input>>numerator;
+        if(input && input.peek() == '/'){
+            input.get();
+            // 满足分数形式，继续读取
+            input>>denominator;
+            if(denominator.isZero()){
+                numerator = 0;
+                denominator = 1;
+            }
+        }
+        f = BigFraction(numerator,denominator);
+        return input;
+    }
+
+    std::ostream& operator<<(std::ostream& output,const BigFraction& f){
+        output<<f.getNumerator()<<"/"<<f.getDenominator();
+        return output;
+    }
+}
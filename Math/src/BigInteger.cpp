@@ -0,0 +1,706 @@
+#include <Math/BigInteger.h>
+#include <Math/BasicFraction.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace AntonaStandard::Math{
+    namespace{
+        using Limb = BigInteger::Limb;
+        using Magnitude = BigInteger::Magnitude;
+        constexpr std::uint64_t limb_base = std::uint64_t(1) << 32;
+        /// @brief 十进制转换时每次处理的位数
+        constexpr int decimal_chunk_digits = 9;
+        constexpr Limb decimal_chunk_base = 1000000000;
+
+        inline void trim(Magnitude& value){
+            while(!value.empty() && value.back() == 0){
+                value.pop_back();
+            }
+        }
+        inline std::size_t trimmedSize(const Limb* value,std::size_t size){
+            while(size > 0 && value[size - 1] == 0){
+                --size;
+            }
+            return size;
+        }
+        inline Magnitude magnitudeOf(std::uint64_t value){
+            Magnitude result;
+            if(value != 0){
+                result.push_back(static_cast<Limb>(value));
+                if(value >> 32){
+                    result.push_back(static_cast<Limb>(value >> 32));
+                }
+            }
+            return result;
+        }
+        inline std::uint64_t absoluteOf(long long value){
+            return value < 0 ? 0ULL - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value);
+        }
+
+        int compareMagnitude(const Magnitude& lhs,const Magnitude& rhs){
+            if(lhs.size() != rhs.size()){
+                return lhs.size() < rhs.size() ? -1 : 1;
+            }
+            for(std::size_t i = lhs.size(); i > 0; --i){
+                if(lhs[i - 1] != rhs[i - 1]){
+                    return lhs[i - 1] < rhs[i - 1] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        Magnitude addMagnitude(const Limb* lhs,std::size_t lhs_size,const Limb* rhs,std::size_t rhs_size){
+            if(lhs_size < rhs_size){
+                std::swap(lhs,rhs);
+                std::swap(lhs_size,rhs_size);
+            }
+            Magnitude result(lhs_size + 1);
+            std::uint64_t carry = 0;
+            for(std::size_t i = 0; i < lhs_size; ++i){
+                std::uint64_t sum = std::uint64_t(lhs[i]) + (i < rhs_size ? rhs[i] : 0) + carry;
+                result[i] = static_cast<Limb>(sum);
+                carry = sum >> 32;
+            }
+            result[lhs_size] = static_cast<Limb>(carry);
+            trim(result);
+            return result;
+        }
+
+        /// @brief lhs -= rhs，要求 lhs >= rhs
+        void subtractInPlace(Magnitude& lhs,const Limb* rhs,std::size_t rhs_size){
+            std::int64_t borrow = 0;
+            for(std::size_t i = 0; i < lhs.size(); ++i){
+                if(i >= rhs_size && borrow == 0){
+                    break;
+                }
+                std::int64_t diff = std::int64_t(lhs[i]) - (i < rhs_size ? rhs[i] : 0) - borrow;
+                borrow = diff < 0;
+                lhs[i] = static_cast<Limb>(diff + (borrow ? std::int64_t(limb_base) : 0));
+            }
+            trim(lhs);
+        }
+
+        /// @brief result[offset...] += value，result 的长度需要足够容纳进位
+        void addInto(Magnitude& result,std::size_t offset,const Magnitude& value){
+            std::uint64_t carry = 0;
+            std::size_t i = 0;
+            for(; i < value.size(); ++i){
+                std::uint64_t sum = std::uint64_t(result[offset + i]) + value[i] + carry;
+                result[offset + i] = static_cast<Limb>(sum);
+                carry = sum >> 32;
+            }
+            for(; carry != 0; ++i){
+                std::uint64_t sum = std::uint64_t(result[offset + i]) + carry;
+                result[offset + i] = static_cast<Limb>(sum);
+                carry = sum >> 32;
+            }
+        }
+
+        Magnitude multiplySchoolbook(const Limb* lhs,std::size_t lhs_size,const Limb* rhs,std::size_t rhs_size){
+            Magnitude result(lhs_size + rhs_size,0);
+            for(std::size_t i = 0; i < lhs_size; ++i){
+                std::uint64_t carry = 0;
+                std::uint64_t factor = lhs[i];
+                if(factor == 0){
+                    continue;
+                }
+                for(std::size_t j = 0; j < rhs_size; ++j){
+                    std::uint64_t product = factor * rhs[j] + result[i + j] + carry;
+                    result[i + j] = static_cast<Limb>(product);
+                    carry = product >> 32;
+                }
+                result[i + rhs_size] = static_cast<Limb>(carry);
+            }
+            trim(result);
+            return result;
+        }
+
+        Magnitude multiplyMagnitude(const Limb* lhs,std::size_t lhs_size,const Limb* rhs,std::size_t rhs_size){
+            lhs_size = trimmedSize(lhs,lhs_size);
+            rhs_size = trimmedSize(rhs,rhs_size);
+            if(lhs_size < rhs_size){
+                std::swap(lhs,rhs);
+                std::swap(lhs_size,rhs_size);
+            }
+            if(rhs_size == 0){
+                return Magnitude();
+            }
+            if(rhs_size < BigInteger::karatsuba_threshold){
+                return multiplySchoolbook(lhs,lhs_size,rhs,rhs_size);
+            }
+            if(rhs_size * 2 <= lhs_size){
+                // 长度相差较大时把较长的数按较短的数的长度分段相乘，每段仍然是平衡的
+                Magnitude result(lhs_size + rhs_size + 1,0);
+                for(std::size_t offset = 0; offset < lhs_size; offset += rhs_size){
+                    std::size_t chunk = std::min(rhs_size,lhs_size - offset);
+                    addInto(result,offset,multiplyMagnitude(lhs + offset,chunk,rhs,rhs_size));
+                }
+                trim(result);
+                return result;
+            }
+            // Karatsuba：(a1*B^h + a0)(b1*B^h + b0) = z2*B^2h + z1*B^h + z0，z1 = (a0+a1)(b0+b1) - z0 - z2
+            std::size_t half = lhs_size / 2;
+            Magnitude z0 = multiplyMagnitude(lhs,half,rhs,half);
+            Magnitude z2 = multiplyMagnitude(lhs + half,lhs_size - half,rhs + half,rhs_size - half);
+            Magnitude lhs_sum = addMagnitude(lhs,half,lhs + half,lhs_size - half);
+            Magnitude rhs_sum = addMagnitude(rhs,half,rhs + half,rhs_size - half);
+            Magnitude z1 = multiplyMagnitude(lhs_sum.data(),lhs_sum.size(),rhs_sum.data(),rhs_sum.size());
+            subtractInPlace(z1,z0.data(),z0.size());
+            subtractInPlace(z1,z2.data(),z2.size());
+
+            Magnitude result(lhs_size + rhs_size + 1,0);
+            addInto(result,0,z0);
+            addInto(result,half,z1);
+            addInto(result,half * 2,z2);
+            trim(result);
+            return result;
+        }
+
+        /// @brief 除以单节的除数，返回余数
+        Limb divideSmall(const Magnitude& dividend,Limb divisor,Magnitude& quotient){
+            quotient.assign(dividend.size(),0);
+            std::uint64_t remainder = 0;
+            for(std::size_t i = dividend.size(); i > 0; --i){
+                std::uint64_t current = (remainder << 32) | dividend[i - 1];
+                quotient[i - 1] = static_cast<Limb>(current / divisor);
+                remainder = current % divisor;
+            }
+            trim(quotient);
+            return static_cast<Limb>(remainder);
+        }
+
+        /// @brief value = value * factor + addend
+        void multiplyAddSmall(Magnitude& value,Limb factor,Limb addend){
+            std::uint64_t carry = addend;
+            for(auto& limb:value){
+                std::uint64_t product = std::uint64_t(limb) * factor + carry;
+                limb = static_cast<Limb>(product);
+                carry = product >> 32;
+            }
+            if(carry != 0){
+                value.push_back(static_cast<Limb>(carry));
+            }
+        }
+
+        /**
+         * @brief Knuth 算法 D，除数至少两节且被除数不小于除数
+         * @details 先把除数左移使最高位为 1，每一步用被除数最高的两节除以除数最高的一节估计商，估计值最多大 2
+         */
+        void divideKnuth(const Magnitude& dividend,const Magnitude& divisor,Magnitude& quotient,Magnitude& remainder){
+            const std::size_t m = dividend.size();
+            const std::size_t n = divisor.size();
+            const int shift = __builtin_clz(divisor[n - 1]);
+            Magnitude vn(n);
+            Magnitude un(m + 1);
+            for(std::size_t i = n - 1; i > 0; --i){
+                vn[i] = static_cast<Limb>((std::uint64_t(divisor[i]) << shift) | (std::uint64_t(divisor[i - 1]) >> (32 - shift)));
+            }
+            vn[0] = static_cast<Limb>(std::uint64_t(divisor[0]) << shift);
+            un[m] = static_cast<Limb>(std::uint64_t(dividend[m - 1]) >> (32 - shift));
+            for(std::size_t i = m - 1; i > 0; --i){
+                un[i] = static_cast<Limb>((std::uint64_t(dividend[i]) << shift) | (std::uint64_t(dividend[i - 1]) >> (32 - shift)));
+            }
+            un[0] = static_cast<Limb>(std::uint64_t(dividend[0]) << shift);
+
+            quotient.assign(m - n + 1,0);
+            for(std::size_t j = m - n + 1; j > 0; --j){
+                const std::size_t k = j - 1;
+                std::uint64_t numerator = (std::uint64_t(un[k + n]) << 32) | un[k + n - 1];
+                std::uint64_t qhat = numerator / vn[n - 1];
+                std::uint64_t rhat = numerator % vn[n - 1];
+                while(qhat >= limb_base || qhat * vn[n - 2] > ((rhat << 32) | un[k + n - 2])){
+                    --qhat;
+                    rhat += vn[n - 1];
+                    if(rhat >= limb_base){
+                        break;
+                    }
+                }
+                // 乘以除数并从被除数中减去
+                std::int64_t borrow = 0;
+                std::int64_t diff = 0;
+                for(std::size_t i = 0; i < n; ++i){
+                    std::uint64_t product = qhat * vn[i];
+                    diff = std::int64_t(un[i + k]) - borrow - std::int64_t(product & 0xFFFFFFFFULL);
+                    un[i + k] = static_cast<Limb>(diff);
+                    borrow = std::int64_t(product >> 32) - (diff >> 32);
+                }
+                diff = std::int64_t(un[k + n]) - borrow;
+                un[k + n] = static_cast<Limb>(diff);
+                quotient[k] = static_cast<Limb>(qhat);
+                if(diff < 0){
+                    // 估计值大了 1，加回一个除数
+                    --quotient[k];
+                    std::uint64_t carry = 0;
+                    for(std::size_t i = 0; i < n; ++i){
+                        std::uint64_t sum = std::uint64_t(un[i + k]) + vn[i] + carry;
+                        un[i + k] = static_cast<Limb>(sum);
+                        carry = sum >> 32;
+                    }
+                    un[k + n] = static_cast<Limb>(un[k + n] + carry);
+                }
+            }
+            remainder.assign(n,0);
+            for(std::size_t i = 0; i < n; ++i){
+                remainder[i] = static_cast<Limb>((std::uint64_t(un[i]) >> shift) | (std::uint64_t(un[i + 1]) << (32 - shift)));
+            }
+            trim(quotient);
+            trim(remainder);
+        }
+
+        /// @brief 取绝对值从第 shift 位开始的 32 位
+        std::uint64_t extractBits(const Magnitude& value,std::size_t shift){
+            std::size_t index = shift / 32;
+            std::size_t offset = shift % 32;
+            std::uint64_t low = index < value.size() ? value[index] : 0;
+            std::uint64_t high = index + 1 < value.size() ? value[index + 1] : 0;
+            return (((high << 32) | low) >> offset) & 0xFFFFFFFFULL;
+        }
+    }
+
+    BigInteger BigInteger::fromMagnitude(bool negative,Magnitude&& magnitude){
+        trim(magnitude);
+        BigInteger result;
+        if(magnitude.size() <= 2){
+            std::uint64_t value = 0;
+            if(magnitude.size() > 0){
+                value = magnitude[0];
+            }
+            if(magnitude.size() > 1){
+                value |= std::uint64_t(magnitude[1]) << 32;
+            }
+            const std::uint64_t max = static_cast<std::uint64_t>(std::numeric_limits<long long>::max());
+            if(!negative && value <= max){
+                result.small = static_cast<long long>(value);
+                return result;
+            }
+            if(negative && value <= max + 1){
+                result.small = static_cast<long long>(0ULL - value);
+                return result;
+            }
+        }
+        result.limbs = std::move(magnitude);
+        result.negative = negative;
+        return result;
+    }
+
+    BigInteger BigInteger::fromUnsigned(unsigned long long value){
+        return fromMagnitude(false,magnitudeOf(value));
+    }
+
+    const BigInteger::Magnitude& BigInteger::magnitude(Magnitude& buffer)const{
+        if(!this->limbs.empty()){
+            return this->limbs;
+        }
+        buffer = magnitudeOf(absoluteOf(this->small));
+        return buffer;
+    }
+
+    BigInteger::BigInteger(std::string_view str):small(0),negative(false){
+        const char* pos = str.data();
+        const char* end = str.data() + str.size();
+        bool is_negative = false;
+        if(pos != end && (*pos == '+' || *pos == '-')){
+            is_negative = (*pos == '-');
+            ++pos;
+        }
+        if(pos == end){
+            throw AntonaStandard::Globals::WrongArgument_Error("The string is not a decimal integer!");
+        }
+        Magnitude value;
+        std::size_t digits = static_cast<std::size_t>(end - pos);
+        // 第一段的位数使剩余的位数为 9 的倍数
+        std::size_t chunk = digits % decimal_chunk_digits == 0 ? decimal_chunk_digits : digits % decimal_chunk_digits;
+        while(pos != end){
+            Limb chunk_value = 0;
+            Limb chunk_base = 1;
+            for(std::size_t i = 0; i < chunk; ++i,++pos){
+                if(*pos < '0' || *pos > '9'){
+                    throw AntonaStandard::Globals::WrongArgument_Error("The string is not a decimal integer!");
+                }
+                chunk_value = chunk_value * 10 + static_cast<Limb>(*pos - '0');
+                chunk_base *= 10;
+            }
+            multiplyAddSmall(value,chunk_base,chunk_value);
+            chunk = decimal_chunk_digits;
+        }
+        *this = fromMagnitude(is_negative,std::move(value));
+    }
+
+    bool BigInteger::parse(const char*& pos,const char* end,BigInteger& value){
+        while(pos != end && (*pos == ' ' || *pos == '\t' || *pos == '\n' || *pos == '\v' || *pos == '\f' || *pos == '\r')){
+            ++pos;
+        }
+        const char* begin = pos;
+        if(pos != end && (*pos == '+' || *pos == '-')){
+            ++pos;
+        }
+        const char* digits = pos;
+        while(pos != end && *pos >= '0' && *pos <= '9'){
+            ++pos;
+        }
+        if(pos == digits){
+            value = BigInteger();
+            return false;
+        }
+        value = BigInteger(std::string_view(begin,static_cast<std::size_t>(pos - begin)));
+        return true;
+    }
+
+    long long BigInteger::toLongLong()const{
+        if(!this->limbs.empty()){
+            throw AntonaStandard::Globals::Overflow_Error("The big integer can not be represented by long long!");
+        }
+        return this->small;
+    }
+
+    double BigInteger::toDouble()const{
+        if(this->limbs.empty()){
+            return static_cast<double>(this->small);
+        }
+        double result = 0;
+        for(std::size_t i = this->limbs.size(); i > 0; --i){
+            result = result * static_cast<double>(limb_base) + this->limbs[i - 1];
+        }
+        return this->negative ? -result : result;
+    }
+
+    std::string BigInteger::toString()const{
+        if(this->limbs.empty()){
+            return std::to_string(this->small);
+        }
+        // 每次除以 10^9 得到低 9 位
+        std::vector<Limb> chunks;
+        Magnitude value = this->limbs;
+        Magnitude quotient;
+        while(!value.empty()){
+            chunks.push_back(divideSmall(value,decimal_chunk_base,quotient));
+            value.swap(quotient);
+        }
+        std::string result = this->negative ? "-" : "";
+        result += std::to_string(chunks.back());
+        for(std::size_t i = chunks.size() - 1; i > 0; --i){
+            std::string chunk = std::to_string(chunks[i - 1]);
+            result.append(decimal_chunk_digits - chunk.size(),'0');
+            result += chunk;
+        }
+        return result;
+    }
+
+    std::size_t BigInteger::bitLength()const{
+        if(this->limbs.empty()){
+            std::uint64_t value = absoluteOf(this->small);
+            return value == 0 ? 0 : 64 - __builtin_clzll(value);
+        }
+        return (this->limbs.size() - 1) * 32 + (32 - __builtin_clz(this->limbs.back()));
+    }
+
+    BigInteger BigInteger::abs()const{
+        return this->isNegative() ? -(*this) : *this;
+    }
+
+    BigInteger BigInteger::addSlow(const BigInteger& lhs,const BigInteger& rhs,bool subtract){
+        Magnitude lhs_buffer,rhs_buffer;
+        const Magnitude& lhs_mag = lhs.magnitude(lhs_buffer);
+        const Magnitude& rhs_mag = rhs.magnitude(rhs_buffer);
+        bool lhs_negative = lhs.isNegative();
+        bool rhs_negative = rhs.isNegative() != subtract;
+        if(lhs_negative == rhs_negative){
+            return fromMagnitude(lhs_negative,addMagnitude(lhs_mag.data(),lhs_mag.size(),rhs_mag.data(),rhs_mag.size()));
+        }
+        int order = compareMagnitude(lhs_mag,rhs_mag);
+        if(order == 0){
+            return BigInteger();
+        }
+        if(order > 0){
+            Magnitude result = lhs_mag;
+            subtractInPlace(result,rhs_mag.data(),rhs_mag.size());
+            return fromMagnitude(lhs_negative,std::move(result));
+        }
+        Magnitude result = rhs_mag;
+        subtractInPlace(result,lhs_mag.data(),lhs_mag.size());
+        return fromMagnitude(rhs_negative,std::move(result));
+    }
+
+    BigInteger BigInteger::mulSlow(const BigInteger& lhs,const BigInteger& rhs){
+        Magnitude lhs_buffer,rhs_buffer;
+        const Magnitude& lhs_mag = lhs.magnitude(lhs_buffer);
+        const Magnitude& rhs_mag = rhs.magnitude(rhs_buffer);
+        return fromMagnitude(lhs.isNegative() != rhs.isNegative(),
+            multiplyMagnitude(lhs_mag.data(),lhs_mag.size(),rhs_mag.data(),rhs_mag.size()));
+    }
+
+    void BigInteger::divModSlow(const BigInteger& lhs,const BigInteger& rhs,BigInteger* quotient,BigInteger* remainder){
+        Magnitude lhs_buffer,rhs_buffer;
+        const Magnitude& lhs_mag = lhs.magnitude(lhs_buffer);
+        const Magnitude& rhs_mag = rhs.magnitude(rhs_buffer);
+        bool lhs_negative = lhs.isNegative();
+        bool quotient_negative = lhs_negative != rhs.isNegative();
+        if(compareMagnitude(lhs_mag,rhs_mag) < 0){
+            if(remainder != nullptr){
+                *remainder = lhs;
+            }
+            if(quotient != nullptr){
+                *quotient = BigInteger();
+            }
+            return;
+        }
+        Magnitude quotient_mag,remainder_mag;
+        if(rhs_mag.size() == 1){
+            Limb rest = divideSmall(lhs_mag,rhs_mag[0],quotient_mag);
+            remainder_mag = magnitudeOf(rest);
+        }
+        else{
+            divideKnuth(lhs_mag,rhs_mag,quotient_mag,remainder_mag);
+        }
+        // 先计算余数，quotient 可能与 lhs 是同一个对象
+        if(remainder != nullptr){
+            *remainder = fromMagnitude(lhs_negative,std::move(remainder_mag));
+        }
+        if(quotient != nullptr){
+            *quotient = fromMagnitude(quotient_negative,std::move(quotient_mag));
+        }
+    }
+
+    void BigInteger::divMod(const BigInteger& lhs,const BigInteger& rhs,BigInteger& quotient,BigInteger& remainder){
+        if(rhs.isZero()){
+            throw AntonaStandard::Globals::UnlawfulOperation_Error("The big integer is divided by zero!");
+        }
+        if(lhs.isSmall() && rhs.isSmall() && !(lhs.small == std::numeric_limits<long long>::min() && rhs.small == -1)){
+            long long q = lhs.small / rhs.small;
+            long long r = lhs.small % rhs.small;
+            quotient = BigInteger(q);
+            remainder = BigInteger(r);
+            return;
+        }
+        BigInteger q,r;
+        divModSlow(lhs,rhs,&q,&r);
+        quotient = std::move(q);
+        remainder = std::move(r);
+    }
+
+    BigInteger BigInteger::gcd(const BigInteger& lhs,const BigInteger& rhs){
+        BigInteger a = lhs.abs();
+        BigInteger b = rhs.abs();
+        if(compare(a,b) < 0){
+            std::swap(a,b);
+        }
+        while(!b.isZero()){
+            if(b.isSmall()){
+                // b 能用 64 位表示后改用二进制 GCD
+                if(!a.isSmall()){
+                    a %= b;
+                }
+                return BigInteger(static_cast<long long>(binaryGcd<std::uint64_t>(static_cast<std::uint64_t>(a.small),static_cast<std::uint64_t>(b.small))));
+            }
+            // Lehmer 算法：用 a、b 最高的 32 位模拟欧几里得算法的若干步，累积成 2x2 的矩阵后一次作用到 a、b 上
+            std::size_t shift = a.bitLength() - 32;
+            std::int64_t a_hat = static_cast<std::int64_t>(extractBits(a.limbs,shift));
+            std::int64_t b_hat = static_cast<std::int64_t>(extractBits(b.limbs,shift));
+            std::int64_t A = 1,B = 0,C = 0,D = 1;
+            while(b_hat + C > 0 && b_hat + D > 0){
+                std::int64_t q = (a_hat + A) / (b_hat + C);
+                if(q != (a_hat + B) / (b_hat + D)){
+                    break;
+                }
+                std::int64_t temp = A - q * C;
+                A = C;
+                C = temp;
+                temp = B - q * D;
+                B = D;
+                D = temp;
+                temp = a_hat - q * b_hat;
+                a_hat = b_hat;
+                b_hat = temp;
+            }
+            if(B == 0){
+                // 最高位无法确定商，做一步完整的除法
+                BigInteger r = a % b;
+                a = std::move(b);
+                b = std::move(r);
+            }
+            else{
+                BigInteger next_a = a * BigInteger(A) + b * BigInteger(B);
+                BigInteger next_b = a * BigInteger(C) + b * BigInteger(D);
+                a = std::move(next_a);
+                b = std::move(next_b);
+            }
+        }
+        return a;
+    }
+
+    const BigInteger BigInteger::operator-()const{
+        if(this->limbs.empty()){
+            if(this->small != std::numeric_limits<long long>::min()){
+                return BigInteger(-this->small);
+            }
+            return fromMagnitude(false,magnitudeOf(absoluteOf(this->small)));
+        }
+        Magnitude value = this->limbs;
+        return fromMagnitude(!this->negative,std::move(value));
+    }
+
+    BigInteger& BigInteger::operator++(){
+        return (*this) += BigInteger(1);
+    }
+
+    BigInteger& BigInteger::operator--(){
+        return (*this) -= BigInteger(1);
+    }
+
+    BigInteger& BigInteger::operator+=(const BigInteger& rhs){
+        long long result = 0;
+        if(this->isSmall() && rhs.isSmall() && !__builtin_add_overflow(this->small,rhs.small,&result)){
+            this->small = result;
+            return *this;
+        }
+        *this = addSlow(*this,rhs,false);
+        return *this;
+    }
+
+    BigInteger& BigInteger::operator-=(const BigInteger& rhs){
+        long long result = 0;
+        if(this->isSmall() && rhs.isSmall() && !__builtin_sub_overflow(this->small,rhs.small,&result)){
+            this->small = result;
+            return *this;
+        }
+        *this = addSlow(*this,rhs,true);
+        return *this;
+    }
+
+    BigInteger& BigInteger::operator*=(const BigInteger& rhs){
+        long long result = 0;
+        if(this->isSmall() && rhs.isSmall() && !__builtin_mul_overflow(this->small,rhs.small,&result)){
+            this->small = result;
+            return *this;
+        }
+        *this = mulSlow(*this,rhs);
+        return *this;
+    }
+
+    BigInteger& BigInteger::operator/=(const BigInteger& rhs){
+        if(rhs.isZero()){
+            throw AntonaStandard::Globals::UnlawfulOperation_Error("The big integer is divided by zero!");
+        }
+        if(this->isSmall() && rhs.isSmall() && !(this->small == std::numeric_limits<long long>::min() && rhs.small == -1)){
+            this->small /= rhs.small;
+            return *this;
+        }
+        BigInteger quotient;
+        divModSlow(*this,rhs,&quotient,nullptr);
+        *this = std::move(quotient);
+        return *this;
+    }
+
+    BigInteger& BigInteger::operator%=(const BigInteger& rhs){
+        if(rhs.isZero()){
+            throw AntonaStandard::Globals::UnlawfulOperation_Error("The big integer is divided by zero!");
+        }
+        if(this->isSmall() && rhs.isSmall()){
+            // LLONG_MIN % -1 在硬件上会溢出，结果为 0
+            this->small = rhs.small == -1 ? 0 : this->small % rhs.small;
+            return *this;
+        }
+        BigInteger remainder;
+        divModSlow(*this,rhs,nullptr,&remainder);
+        *this = std::move(remainder);
+        return *this;
+    }
+
+    int BigInteger::compare(const BigInteger& lhs,const BigInteger& rhs){
+        if(lhs.isSmall() && rhs.isSmall()){
+            return (lhs.small > rhs.small) - (lhs.small < rhs.small);
+        }
+        // 数组形式的绝对值大于任何内部形式的值
+        if(lhs.isSmall()){
+            return rhs.negative ? 1 : -1;
+        }
+        if(rhs.isSmall()){
+            return lhs.negative ? -1 : 1;
+        }
+        if(lhs.negative != rhs.negative){
+            return lhs.negative ? -1 : 1;
+        }
+        int order = compareMagnitude(lhs.limbs,rhs.limbs);
+        return lhs.negative ? -order : order;
+    }
+
+    const BigInteger operator+(const BigInteger& lhs,const BigInteger& rhs){
+        BigInteger result(lhs);
+        result += rhs;
+        return result;
+    }
+
+    const BigInteger operator-(const BigInteger& lhs,const BigInteger& rhs){
+        BigInteger result(lhs);
+        result -= rhs;
+        return result;
+    }
+
+    const BigInteger operator*(const BigInteger& lhs,const BigInteger& rhs){
+        BigInteger result(lhs);
+        result *= rhs;
+        return result;
+    }
+
+    const BigInteger operator/(const BigInteger& lhs,const BigInteger& rhs){
+        BigInteger result(lhs);
+        result /= rhs;
+        return result;
+    }
+
+    const BigInteger operator%(const BigInteger& lhs,const BigInteger& rhs){
+        BigInteger result(lhs);
+        result %= rhs;
+        return result;
+    }
+
+    bool operator==(const BigInteger& lhs,const BigInteger& rhs){
+        return BigInteger::compare(lhs,rhs) == 0;
+    }
+
+    bool operator!=(const BigInteger& lhs,const BigInteger& rhs){
+        return BigInteger::compare(lhs,rhs) != 0;
+    }
+
+    bool operator>(const BigInteger& lhs,const BigInteger& rhs){
+        return BigInteger::compare(lhs,rhs) > 0;
+    }
+
+    bool operator>=(const BigInteger& lhs,const BigInteger& rhs){
+        return BigInteger::compare(lhs,rhs) >= 0;
+    }
+
+    bool operator<(const BigInteger& lhs,const BigInteger& rhs){
+        return BigInteger::compare(lhs,rhs) < 0;
+    }
+
+    bool operator<=(const BigInteger& lhs,const BigInteger& rhs){
+        return BigInteger::compare(lhs,rhs) <= 0;
+    }
+
+    std::istream& operator>>(std::istream& input,BigInteger& value){
+        std::string digits;
+        input>>std::ws;
+        int c = input.peek();
+        if(c == '+' || c == '-'){
+            digits.push_back(static_cast<char>(input.get()));
+            c = input.peek();
+        }
+        while(c != std::char_traits<char>::eof() && c >= '0' && c <= '9'){
+            digits.push_back(static_cast<char>(input.get()));
+            c = input.peek();
+        }
+        const char* pos = digits.data();
+        if(!BigInteger::parse(pos,digits.data() + digits.size(),value)){
+            input.setstate(std::ios_base::failbit);
+        }
+        return input;
+    }
+
+    std::ostream& operator<<(std::ostream& output,const BigInteger& value){
+        output<<value.toString();
+        return output;
+    }
+}
@@ -0,0 +1,97 @@
+#include <Math/CsrMatrix.h>
+#include <Math/NumericKernels.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace AntonaStandard::Math{
+    void CsrMatrix::checkColumns(std::size_t columns){
+        if(columns > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max())){
+            throw AntonaStandard::Globals::WrongArgument_Error("The columns of the sparse matrix are too many!");
+        }
+    }
+
+    CsrMatrix::CsrMatrix(std::size_t rows,std::size_t columns,std::vector<Entry> entries):row_count(rows),column_count(columns){
+        checkColumns(columns);
+        for(const auto& entry:entries){
+            if(entry.row >= rows || entry.column >= columns){
+                throw AntonaStandard::Globals::WrongArgument_Error("The index of the sparse matrix is out of range!");
+            }
+        }
+        std::sort(entries.begin(),entries.end(),[](const Entry& lhs,const Entry& rhs){
+            return lhs.row != rhs.row ? lhs.row < rhs.row : lhs.column < rhs.column;
+        });
+        this->row_offsets.assign(rows + 1,0);
+        this->column_indices.reserve(entries.size());
+        this->element_values.reserve(entries.size());
+        for(std::size_t i = 0; i < entries.size(); ++i){
+            const Entry& entry = entries[i];
+            if(i > 0 && entries[i - 1].row == entry.row && entries[i - 1].column == entry.column){
+                this->element_values.back() += entry.value;
+                continue;
+            }
+            this->column_indices.push_back(static_cast<std::uint32_t>(entry.column));
+            this->element_values.push_back(entry.value);
+            ++this->row_offsets[entry.row + 1];
+        }
+        for(std::size_t i = 0; i < rows; ++i){
+            this->row_offsets[i + 1] += this->row_offsets[i];
+        }
+    }
+
+    CsrMatrix CsrMatrix::fromDense(const Matrix<double>& dense,double tolerance){
+        checkColumns(dense.columns());
+        CsrMatrix result;
+        result.row_count = dense.rows();
+        result.column_count = dense.columns();
+        result.row_offsets.reserve(dense.rows() + 1);
+        for(std::size_t i = 0; i < dense.rows(); ++i){
+            const double* row = dense.rowData(i);
+            for(std::size_t j = 0; j < dense.columns(); ++j){
+                if(std::fabs(row[j]) > tolerance){
+                    result.column_indices.push_back(static_cast<std::uint32_t>(j));
+                    result.element_values.push_back(row[j]);
+                }
+            }
+            result.row_offsets.push_back(result.element_values.size());
+        }
+        return result;
+    }
+
+    double CsrMatrix::at(std::size_t row,std::size_t column)const{
+        if(row >= this->row_count || column >= this->column_count){
+            throw AntonaStandard::Globals::WrongArgument_Error("The index of the sparse matrix is out of range!");
+        }
+        auto begin = this->column_indices.begin() + this->row_offsets[row];
+        auto end = this->column_indices.begin() + this->row_offsets[row + 1];
+        auto pos = std::lower_bound(begin,end,static_cast<std::uint32_t>(column));
+        if(pos == end || *pos != column){
+            return 0.0;
+        }
+        return this->element_values[pos - this->column_indices.begin()];
+    }
+
+    Matrix<double> CsrMatrix::toDense()const{
+        Matrix<double> result(this->row_count,this->column_count);
+        for(std::size_t i = 0; i < this->row_count; ++i){
+            for(std::size_t p = this->row_offsets[i]; p < this->row_offsets[i + 1]; ++p){
+                result(i,this->column_indices[p]) = this->element_values[p];
+            }
+        }
+        return result;
+    }
+
+    void CsrMatrix::multiply(const double* x,double* y)const{
+        NumericKernels::spmv(this->row_count,this->row_offsets.data(),this->column_indices.data(),
+            this->element_values.data(),x,y);
+    }
+
+    std::vector<double> operator*(const CsrMatrix& lhs,const std::vector<double>& rhs){
+        if(lhs.columns() != rhs.size()){
+            throw AntonaStandard::Globals::WrongArgument_Error("The size of the vector is different from the columns of the matrix!");
+        }
+        std::vector<double> result(lhs.rows());
+        lhs.multiply(rhs.data(),result.data());
+        return result;
+    }
+}
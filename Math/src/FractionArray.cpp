@@ -0,0 +1,321 @@
+#include <Math/FractionArray.h>
+#include <atomic>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define MATH_FRACTIONARRAY_AVX2 1
+    #include <immintrin.h>
+#else
+    #define MATH_FRACTIONARRAY_AVX2 0
+#endif
+
+namespace AntonaStandard::Math{
+    namespace{
+        using Basic = BasicFraction<int>;
+        /// @brief 每批处理的元素个数
+        constexpr std::size_t batch_size = 8;
+
+        // 标量实现，处理 [begin,end) 范围内的元素
+        void addScalar(const int* an,const int* ad,const int* bn,const int* bd,int* on,int* od,std::size_t begin,std::size_t end){
+            for(std::size_t i = begin; i < end; ++i){
+                Basic result = Basic(an[i],ad[i]) + Basic(bn[i],bd[i]);
+                on[i] = result.getNumerator();
+                od[i] = result.getDenominator();
+            }
+        }
+        void mulScalar(const int* an,const int* ad,const int* bn,const int* bd,int* on,int* od,std::size_t begin,std::size_t end){
+            for(std::size_t i = begin; i < end; ++i){
+                Basic result = Basic(an[i],ad[i]) * Basic(bn[i],bd[i]);
+                on[i] = result.getNumerator();
+                od[i] = result.getDenominator();
+            }
+        }
+        void compareScalar(const int* an,const int* ad,const int* bn,const int* bd,signed char* out,std::size_t begin,std::size_t end){
+            for(std::size_t i = begin; i < end; ++i){
+                out[i] = static_cast<signed char>(compare(Basic(an[i],ad[i]),Basic(bn[i],bd[i])));
+            }
+        }
+        void normalizeScalar(int* num,int* den,std::size_t begin,std::size_t end){
+            for(std::size_t i = begin; i < end; ++i){
+                Basic result = Basic(num[i],den[i]).reduced();
+                num[i] = result.getNumerator();
+                den[i] = result.getDenominator();
+            }
+        }
+
+    #if MATH_FRACTIONARRAY_AVX2
+        #define MATH_AVX2_TARGET __attribute__((target("avx2")))
+
+        /// @brief 4 个 64 位通道的值是否都能用 int 表示
+        MATH_AVX2_TARGET inline bool fitsInt(__m256i value){
+            __m256i biased = _mm256_add_epi64(value,_mm256_set1_epi64x(0x80000000LL));
+            __m256i high = _mm256_srli_epi64(biased,32);
+            return _mm256_testz_si256(high,high);
+        }
+        /// @brief 把两个包含 4 个 64 位整数的向量截断为 8 个 32 位整数
+        MATH_AVX2_TARGET inline __m256i narrow(__m256i low,__m256i high){
+            const __m256i index = _mm256_setr_epi32(0,2,4,6,1,3,5,7);
+            __m128i low_half = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(low,index));
+            __m128i high_half = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(high,index));
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(low_half),high_half,1);
+        }
+        /// @brief 把 8 个 32 位整数分别符号扩展为两个包含 4 个 64 位整数的向量
+        MATH_AVX2_TARGET inline void widen(__m256i value,__m256i& low,__m256i& high){
+            low = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(value));
+            high = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(value,1));
+        }
+        /// @brief 计算每个 32 位通道末尾零的个数，value 为 0 的通道结果大于 31
+        MATH_AVX2_TARGET inline __m256i countTrailingZeros8(__m256i value){
+            // 最低位的 1 转换为浮点数后，指数即为末尾零的个数；0x80000000 转换为 -2^31，指数同样正确
+            __m256i lowest = _mm256_and_si256(value,_mm256_sub_epi32(_mm256_setzero_si256(),value));
+            __m256i bits = _mm256_castps_si256(_mm256_cvtepi32_ps(lowest));
+            __m256i exponent = _mm256_and_si256(_mm256_srli_epi32(bits,23),_mm256_set1_epi32(0xFF));
+            return _mm256_sub_epi32(exponent,_mm256_set1_epi32(127));
+        }
+        /// @brief 4 个 32 位整数的精确整除，商必须为整数
+        MATH_AVX2_TARGET inline __m128i exactDivide(__m128i dividend,__m128i divisor){
+            __m256d quotient = _mm256_div_pd(_mm256_cvtepi32_pd(dividend),_mm256_cvtepi32_pd(divisor));
+            return _mm256_cvttpd_epi32(quotient);
+        }
+
+        MATH_AVX2_TARGET void addAVX2(const int* an,const int* ad,const int* bn,const int* bd,int* on,int* od,std::size_t size){
+            std::size_t i = 0;
+            for(; i + batch_size <= size; i += batch_size){
+                __m256i a_num = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(an + i));
+                __m256i a_den = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ad + i));
+                __m256i b_num = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bn + i));
+                __m256i b_den = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bd + i));
+                __m256i an_lo,an_hi,ad_lo,ad_hi,bn_lo,bn_hi,bd_lo,bd_hi;
+                widen(a_num,an_lo,an_hi);
+                widen(b_num,bn_lo,bn_hi);
+                if(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a_den,b_den)) == -1){
+                    // 分母全部相同时直接合并分子
+                    __m256i num_lo = _mm256_add_epi64(an_lo,bn_lo);
+                    __m256i num_hi = _mm256_add_epi64(an_hi,bn_hi);
+                    if(fitsInt(num_lo) && fitsInt(num_hi)){
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(on + i),narrow(num_lo,num_hi));
+                        _mm256_storeu_si256(reinterpret_cast<__m256i*>(od + i),a_den);
+                        continue;
+                    }
+                    addScalar(an,ad,bn,bd,on,od,i,i + batch_size);
+                    continue;
+                }
+                widen(a_den,ad_lo,ad_hi);
+                widen(b_den,bd_lo,bd_hi);
+                __m256i num_lo = _mm256_add_epi64(_mm256_mul_epi32(an_lo,bd_lo),_mm256_mul_epi32(bn_lo,ad_lo));
+                __m256i num_hi = _mm256_add_epi64(_mm256_mul_epi32(an_hi,bd_hi),_mm256_mul_epi32(bn_hi,ad_hi));
+                __m256i den_lo = _mm256_mul_epi32(ad_lo,bd_lo);
+                __m256i den_hi = _mm256_mul_epi32(ad_hi,bd_hi);
+                if(fitsInt(num_lo) && fitsInt(num_hi) && fitsInt(den_lo) && fitsInt(den_hi)){
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(on + i),narrow(num_lo,num_hi));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(od + i),narrow(den_lo,den_hi));
+                    continue;
+                }
+                // 有结果放不下时这一批退回标量运算，由标量运算负责化简
+                addScalar(an,ad,bn,bd,on,od,i,i + batch_size);
+            }
+            addScalar(an,ad,bn,bd,on,od,i,size);
+        }
+
+        MATH_AVX2_TARGET void mulAVX2(const int* an,const int* ad,const int* bn,const int* bd,int* on,int* od,std::size_t size){
+            std::size_t i = 0;
+            for(; i + batch_size <= size; i += batch_size){
+                __m256i an_lo,an_hi,ad_lo,ad_hi,bn_lo,bn_hi,bd_lo,bd_hi;
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(an + i)),an_lo,an_hi);
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ad + i)),ad_lo,ad_hi);
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bn + i)),bn_lo,bn_hi);
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bd + i)),bd_lo,bd_hi);
+                __m256i num_lo = _mm256_mul_epi32(an_lo,bn_lo);
+                __m256i num_hi = _mm256_mul_epi32(an_hi,bn_hi);
+                __m256i den_lo = _mm256_mul_epi32(ad_lo,bd_lo);
+                __m256i den_hi = _mm256_mul_epi32(ad_hi,bd_hi);
+                if(fitsInt(num_lo) && fitsInt(num_hi) && fitsInt(den_lo) && fitsInt(den_hi)){
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(on + i),narrow(num_lo,num_hi));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(od + i),narrow(den_lo,den_hi));
+                    continue;
+                }
+                mulScalar(an,ad,bn,bd,on,od,i,i + batch_size);
+            }
+            mulScalar(an,ad,bn,bd,on,od,i,size);
+        }
+
+        MATH_AVX2_TARGET void compareAVX2(const int* an,const int* ad,const int* bn,const int* bd,signed char* out,std::size_t size){
+            std::size_t i = 0;
+            for(; i + batch_size <= size; i += batch_size){
+                __m256i an_lo,an_hi,ad_lo,ad_hi,bn_lo,bn_hi,bd_lo,bd_hi;
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(an + i)),an_lo,an_hi);
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(ad + i)),ad_lo,ad_hi);
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bn + i)),bn_lo,bn_hi);
+                widen(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(bd + i)),bd_lo,bd_hi);
+                __m256i left_lo = _mm256_mul_epi32(an_lo,bd_lo);
+                __m256i left_hi = _mm256_mul_epi32(an_hi,bd_hi);
+                __m256i right_lo = _mm256_mul_epi32(bn_lo,ad_lo);
+                __m256i right_hi = _mm256_mul_epi32(bn_hi,ad_hi);
+                // 比较为真的通道为 -1，(right > left) - (left > right) 即为比较结果
+                __m256i result_lo = _mm256_sub_epi64(_mm256_cmpgt_epi64(right_lo,left_lo),_mm256_cmpgt_epi64(left_lo,right_lo));
+                __m256i result_hi = _mm256_sub_epi64(_mm256_cmpgt_epi64(right_hi,left_hi),_mm256_cmpgt_epi64(left_hi,right_hi));
+                alignas(32) std::int32_t result[batch_size];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(result),narrow(result_lo,result_hi));
+                for(std::size_t j = 0; j < batch_size; ++j){
+                    out[i + j] = static_cast<signed char>(result[j]);
+                }
+            }
+            compareScalar(an,ad,bn,bd,out,i,size);
+        }
+
+        MATH_AVX2_TARGET void normalizeAVX2(int* num,int* den,std::size_t size){
+            const __m256i zero = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for(; i + batch_size <= size; i += batch_size){
+                __m256i n = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(num + i));
+                __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(den + i));
+                // 按照无符号数处理，|INT_MIN| 为 0x80000000
+                __m256i a = _mm256_abs_epi32(n);
+                __m256i b = d;
+                // gcd(0,b) = b
+                a = _mm256_blendv_epi8(a,b,_mm256_cmpeq_epi32(a,zero));
+                __m256i shift = countTrailingZeros8(_mm256_or_si256(a,b));
+                a = _mm256_srlv_epi32(a,countTrailingZeros8(a));
+                while(!_mm256_testz_si256(b,b)){
+                    b = _mm256_srlv_epi32(b,countTrailingZeros8(b));
+                    __m256i finished = _mm256_cmpeq_epi32(b,zero);
+                    __m256i minimum = _mm256_min_epu32(a,b);
+                    __m256i maximum = _mm256_max_epu32(a,b);
+                    a = _mm256_blendv_epi8(minimum,a,finished);
+                    b = _mm256_andnot_si256(finished,_mm256_sub_epi32(maximum,minimum));
+                }
+                __m256i ratio = _mm256_sllv_epi32(a,shift);
+                if(_mm256_movemask_epi8(_mm256_cmpeq_epi32(ratio,_mm256_set1_epi32(1))) == -1){
+                    // 全部已经是最简形式
+                    continue;
+                }
+                __m128i ratio_lo = _mm256_castsi256_si128(ratio);
+                __m128i ratio_hi = _mm256_extracti128_si256(ratio,1);
+                __m128i num_lo = exactDivide(_mm256_castsi256_si128(n),ratio_lo);
+                __m128i num_hi = exactDivide(_mm256_extracti128_si256(n,1),ratio_hi);
+                __m128i den_lo = exactDivide(_mm256_castsi256_si128(d),ratio_lo);
+                __m128i den_hi = exactDivide(_mm256_extracti128_si256(d,1),ratio_hi);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(num + i),_mm256_inserti128_si256(_mm256_castsi128_si256(num_lo),num_hi,1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(den + i),_mm256_inserti128_si256(_mm256_castsi128_si256(den_lo),den_hi,1));
+            }
+            normalizeScalar(num,den,i,size);
+        }
+
+        #undef MATH_AVX2_TARGET
+    #endif
+
+        SimdLevel detectSimdLevel(){
+        #if MATH_FRACTIONARRAY_AVX2
+            if(cpuSimdLevel() >= SimdLevel::AVX2){
+                return SimdLevel::AVX2;
+            }
+        #endif
+            return SimdLevel::Scalar;
+        }
+
+        std::atomic<SimdLevel>& currentSimdLevel(){
+            static std::atomic<SimdLevel> level(detectSimdLevel());
+            return level;
+        }
+    }
+
+    void FractionArray::checkSize(const FractionArray& lhs,const FractionArray& rhs){
+        if(lhs.size() != rhs.size()){
+            throw AntonaStandard::Globals::WrongArgument_Error("The sizes of the fraction arrays are different!");
+        }
+    }
+
+    FractionArray::FractionArray(std::initializer_list<Fraction> fractions){
+        this->reserve(fractions.size());
+        for(const auto& fraction:fractions){
+            this->push_back(fraction);
+        }
+    }
+
+    void FractionArray::push_back(int num,int den){
+        Basic fraction(num,den);
+        this->numerators.push_back(fraction.getNumerator());
+        this->denominators.push_back(fraction.getDenominator());
+    }
+
+    void FractionArray::add(const FractionArray& lhs,const FractionArray& rhs,FractionArray& out){
+        checkSize(lhs,rhs);
+        std::size_t size = lhs.size();
+        out.resize(size);
+        const int* an = lhs.numerators.data();
+        const int* ad = lhs.denominators.data();
+        const int* bn = rhs.numerators.data();
+        const int* bd = rhs.denominators.data();
+    #if MATH_FRACTIONARRAY_AVX2
+        if(simdLevel() == SimdLevel::AVX2){
+            addAVX2(an,ad,bn,bd,out.numerators.data(),out.denominators.data(),size);
+            return;
+        }
+    #endif
+        addScalar(an,ad,bn,bd,out.numerators.data(),out.denominators.data(),0,size);
+    }
+
+    void FractionArray::mul(const FractionArray& lhs,const FractionArray& rhs,FractionArray& out){
+        checkSize(lhs,rhs);
+        std::size_t size = lhs.size();
+        out.resize(size);
+        const int* an = lhs.numerators.data();
+        const int* ad = lhs.denominators.data();
+        const int* bn = rhs.numerators.data();
+        const int* bd = rhs.denominators.data();
+    #if MATH_FRACTIONARRAY_AVX2
+        if(simdLevel() == SimdLevel::AVX2){
+            mulAVX2(an,ad,bn,bd,out.numerators.data(),out.denominators.data(),size);
+            return;
+        }
+    #endif
+        mulScalar(an,ad,bn,bd,out.numerators.data(),out.denominators.data(),0,size);
+    }
+
+    void FractionArray::compare(const FractionArray& lhs,const FractionArray& rhs,std::vector<signed char>& out){
+        checkSize(lhs,rhs);
+        std::size_t size = lhs.size();
+        out.resize(size);
+        const int* an = lhs.numerators.data();
+        const int* ad = lhs.denominators.data();
+        const int* bn = rhs.numerators.data();
+        const int* bd = rhs.denominators.data();
+    #if MATH_FRACTIONARRAY_AVX2
+        if(simdLevel() == SimdLevel::AVX2){
+            compareAVX2(an,ad,bn,bd,out.data(),size);
+            return;
+        }
+    #endif
+        compareScalar(an,ad,bn,bd,out.data(),0,size);
+    }
+
+    void FractionArray::normalize(){
+    #if MATH_FRACTIONARRAY_AVX2
+        if(simdLevel() == SimdLevel::AVX2){
+            normalizeAVX2(this->numerators.data(),this->denominators.data(),this->size());
+            return;
+        }
+    #endif
+        normalizeScalar(this->numerators.data(),this->denominators.data(),0,this->size());
+    }
+
+    SimdLevel FractionArray::simdLevel(){
+        return currentSimdLevel().load(std::memory_order_relaxed);
+    }
+
+    SimdLevel FractionArray::setSimdLevel(SimdLevel level){
+        if(level == SimdLevel::SSE2){
+            level = SimdLevel::Scalar;
+        }
+        if(level > supportedSimdLevel()){
+            level = supportedSimdLevel();
+        }
+        currentSimdLevel().store(level,std::memory_order_relaxed);
+        return level;
+    }
+
+    SimdLevel FractionArray::supportedSimdLevel(){
+        static SimdLevel level = detectSimdLevel();
+        return level;
+    }
+}
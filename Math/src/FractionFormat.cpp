@@ -0,0 +1,137 @@
+#include <Math/FractionFormat.h>
+#include <string>
+
+namespace AntonaStandard::Math{
+    namespace{
+        inline bool isBlank(char c){
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        [[noreturn]] void throwCorrupted(const char* reason,std::size_t offset){
+            std::string msg = std::string(reason) + " at offset " + std::to_string(offset);
+            throw AntonaStandard::Globals::DataCorrupted_Error(msg.c_str());
+        }
+
+        /**
+         * @brief 解析分子和分母，不化简
+         * @details 规则见 from_chars，成功时 den 不为 0
+         */
+        std::from_chars_result parseTerms(const char* first,const char* last,int& num,int& den){
+            auto result = std::from_chars(first,last,num);
+            if(result.ec == std::errc::invalid_argument){
+                return {first,std::errc::invalid_argument};
+            }
+            if(result.ec != std::errc()){
+                return result;
+            }
+            den = 1;
+            if(result.ptr != last && *result.ptr == '/'){
+                auto den_result = std::from_chars(result.ptr + 1,last,den);
+                if(den_result.ec == std::errc::result_out_of_range){
+                    return den_result;
+                }
+                if(den_result.ec == std::errc()){
+                    if(den == 0){
+                        return {first,std::errc::invalid_argument};
+                    }
+                    return den_result;
+                }
+                // '/' 之后不是数字，只解析分子
+                den = 1;
+            }
+            return result;
+        }
+
+        /// @brief 解析文本中的每个字段，把分子和分母交给 sink 处理
+        template<typename type_SINK>
+        std::size_t parseColumns(std::string_view text,type_SINK&& sink){
+            const char* begin = text.data();
+            const char* pos = begin;
+            const char* end = begin + text.size();
+            std::size_t count = 0;
+            // 逗号之后必须还有一个字段
+            bool need_field = false;
+            while(true){
+                while(pos != end && isBlank(*pos)){
+                    ++pos;
+                }
+                if(pos == end || *pos == '\n' || *pos == ','){
+                    if(need_field || (pos != end && *pos == ',')){
+                        throwCorrupted("Missing fraction",static_cast<std::size_t>(pos - begin));
+                    }
+                    if(pos == end){
+                        break;
+                    }
+                    // 空行
+                    ++pos;
+                    continue;
+                }
+                const char* field = pos;
+                int num = 0;
+                int den = 1;
+                auto result = parseTerms(pos,end,num,den);
+                if(result.ec != std::errc()){
+                    throwCorrupted("Invalid fraction",static_cast<std::size_t>(field - begin));
+                }
+                pos = result.ptr;
+                while(pos != end && isBlank(*pos)){
+                    ++pos;
+                }
+                if(pos != end && *pos != '\n' && *pos != ','){
+                    throwCorrupted("Unexpected character",static_cast<std::size_t>(pos - begin));
+                }
+                try{
+                    sink(num,den);
+                }
+                catch(const AntonaStandard::Globals::Overflow_Error&){
+                    throwCorrupted("Fraction out of range",static_cast<std::size_t>(field - begin));
+                }
+                ++count;
+                need_field = (pos != end && *pos == ',');
+                if(pos != end){
+                    ++pos;
+                }
+            }
+            return count;
+        }
+    }
+
+    std::from_chars_result from_chars(const char* first,const char* last,Fraction& value){
+        int num = 0;
+        int den = 1;
+        auto result = parseTerms(first,last,num,den);
+        if(result.ec != std::errc()){
+            return result;
+        }
+        try{
+            value = Fraction::fromWide(num,den);
+        }
+        catch(const AntonaStandard::Globals::Overflow_Error&){
+            // 只有 INT_MIN 除以负数时才会发生
+            return {result.ptr,std::errc::result_out_of_range};
+        }
+        return result;
+    }
+
+    std::to_chars_result to_chars(char* first,char* last,const Fraction& value){
+        auto result = std::to_chars(first,last,value.getNumerator());
+        if(result.ec != std::errc() || result.ptr == last){
+            return {last,std::errc::value_too_large};
+        }
+        *result.ptr = '/';
+        return std::to_chars(result.ptr + 1,last,value.getDenominator());
+    }
+
+    std::size_t parseFractions(std::string_view text,std::vector<Fraction>& out){
+        return parseColumns(text,[&out](int num,int den){
+            out.push_back(Fraction::fromWide(num,den));
+        });
+    }
+
+    std::size_t parseFractions(std::string_view text,FractionArray& out){
+        // FractionArray 惰性化简，直接保存解析出的分子分母
+        return parseColumns(text,[&out](int num,int den){
+            out.push_back(num,den);
+        });
+    }
+}
@@ -0,0 +1,209 @@
+#include <Math/LinearAlgebra.h>
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <future>
+#include <thread>
+
+namespace AntonaStandard::Math{
+    namespace{
+        /**
+         * @brief 把 [first,last) 行分成若干段交给 task 处理
+         * @details 第一段由调用线程处理，其余提交给线程池，返回前等待所有段完成
+         */
+        void forEachRowRange(std::size_t first,std::size_t last,AntonaStandard::ThreadTools::ThreadsPool* pool,
+            const std::function<void(std::size_t,std::size_t)>& task){
+            std::size_t count = last - first;
+            if(pool == nullptr || pool->has_shutdown() || count < 2 * bareiss_rows_per_task){
+                task(first,last);
+                return;
+            }
+            std::size_t workers = std::max(1u,std::thread::hardware_concurrency());
+            std::size_t task_count = std::min(count / bareiss_rows_per_task,workers + 1);
+            std::size_t chunk = (count + task_count - 1) / task_count;
+            std::vector<std::future<void>> futures;
+            futures.reserve(task_count);
+            for(std::size_t begin = first + chunk;begin < last;begin += chunk){
+                std::size_t end = std::min(begin + chunk,last);
+                futures.push_back(pool->submit([&task,begin,end](){
+                    task(begin,end);
+                }));
+            }
+            // 任务引用了调用方的数据，即使本线程出错也要等所有任务结束
+            std::exception_ptr error;
+            try{
+                task(first,first + chunk);
+            }
+            catch(...){
+                error = std::current_exception();
+            }
+            for(auto& future:futures){
+                try{
+                    future.get();
+                }
+                catch(...){
+                    if(!error){
+                        error = std::current_exception();
+                    }
+                }
+            }
+            if(error){
+                std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief 每一行乘以该行分母的最小公倍数，转换为整数矩阵
+         * @param rhs 不为 nullptr 时作为增广的最后一列
+         * @param scale 返回所有行乘数的乘积
+         */
+        Matrix<BigInteger> toIntegerRows(const BigFractionMatrix& matrix,const std::vector<BigFraction>* rhs,BigInteger& scale){
+            std::size_t rows = matrix.rows();
+            std::size_t columns = matrix.columns();
+            Matrix<BigInteger> result(rows,rhs == nullptr ? columns : columns + 1);
+            scale = 1;
+            for(std::size_t i = 0;i < rows;++i){
+                BigInteger multiple(1);
+                auto include = [&multiple](const BigInteger& den){
+                    if(den != 1){
+                        multiple = multiple / BigInteger::gcd(multiple,den) * den;
+                    }
+                };
+                for(std::size_t j = 0;j < columns;++j){
+                    include(matrix(i,j).getDenominator());
+                }
+                if(rhs != nullptr){
+                    include((*rhs)[i].getDenominator());
+                }
+                auto convert = [&multiple](const BigFraction& value){
+                    if(value.getDenominator() == 1){
+                        return value.getNumerator() * multiple;
+                    }
+                    return value.getNumerator() * (multiple / value.getDenominator());
+                };
+                for(std::size_t j = 0;j < columns;++j){
+                    result(i,j) = convert(matrix(i,j));
+                }
+                if(rhs != nullptr){
+                    result(i,columns) = convert((*rhs)[i]);
+                }
+                scale *= multiple;
+            }
+            return result;
+        }
+
+        void checkSquare(const BigFractionMatrix& matrix){
+            if(!matrix.isSquare()){
+                throw AntonaStandard::Globals::WrongArgument_Error("The matrix is not square!");
+            }
+        }
+
+        std::vector<BigFraction> toBigFractions(const std::vector<Fraction>& values){
+            return std::vector<BigFraction>(values.begin(),values.end());
+        }
+    }
+
+    int bareissEliminate(Matrix<BigInteger>& matrix,std::size_t pivot_columns,AntonaStandard::ThreadTools::ThreadsPool* pool){
+        std::size_t rows = matrix.rows();
+        std::size_t columns = matrix.columns();
+        assert(pivot_columns <= rows && pivot_columns <= columns);
+        int sign = 1;
+        BigInteger previous(1);
+        for(std::size_t k = 0;k < pivot_columns;++k){
+            std::size_t pivot_row = k;
+            while(pivot_row < rows && matrix(pivot_row,k).isZero()){
+                ++pivot_row;
+            }
+            if(pivot_row == rows){
+                return 0;
+            }
+            if(pivot_row != k){
+                matrix.swapRows(pivot_row,k);
+                sign = -sign;
+            }
+            const BigInteger* pivot = matrix.rowData(k);
+            // 第 k 步只读取主元行和 previous，各行的更新互不影响
+            forEachRowRange(k + 1,rows,pool,[&matrix,&previous,pivot,k,columns](std::size_t first,std::size_t last){
+                for(std::size_t i = first;i < last;++i){
+                    BigInteger* row = matrix.rowData(i);
+                    const BigInteger factor = row[k];
+                    for(std::size_t j = k + 1;j < columns;++j){
+                        BigInteger value = row[j] * pivot[k];
+                        if(!factor.isZero()){
+                            value -= factor * pivot[j];
+                        }
+                        // Sylvester 恒等式保证整除
+                        row[j] = previous == 1 ? std::move(value) : value / previous;
+                    }
+                    row[k] = 0;
+                }
+            });
+            previous = pivot[k];
+        }
+        return sign;
+    }
+
+    BigFraction determinant(const BigFractionMatrix& matrix,AntonaStandard::ThreadTools::ThreadsPool* pool){
+        checkSquare(matrix);
+        std::size_t n = matrix.rows();
+        if(n == 0){
+            return BigFraction(1);
+        }
+        BigInteger scale;
+        Matrix<BigInteger> integers = toIntegerRows(matrix,nullptr,scale);
+        int sign = bareissEliminate(integers,n,pool);
+        if(sign == 0){
+            return BigFraction();
+        }
+        BigInteger result = integers(n - 1,n - 1);
+        if(sign < 0){
+            result = -result;
+        }
+        return BigFraction(result,scale);
+    }
+
+    BigFraction determinant(const FractionMatrix& matrix,AntonaStandard::ThreadTools::ThreadsPool* pool){
+        return determinant(BigFractionMatrix(matrix),pool);
+    }
+
+    std::vector<BigFraction> solve(const BigFractionMatrix& matrix,const std::vector<BigFraction>& rhs,
+        AntonaStandard::ThreadTools::ThreadsPool* pool){
+        checkSquare(matrix);
+        std::size_t n = matrix.rows();
+        if(rhs.size() != n){
+            throw AntonaStandard::Globals::WrongArgument_Error("The size of the vector is different from the rows of the matrix!");
+        }
+        if(n == 0){
+            return {};
+        }
+        BigInteger scale;
+        Matrix<BigInteger> augmented = toIntegerRows(matrix,&rhs,scale);
+        if(bareissEliminate(augmented,n,pool) == 0){
+            throw AntonaStandard::Globals::UnlawfulOperation_Error("The matrix is singular!");
+        }
+        // 由 Cramer 法则，x[i] = y[i] / det，其中 y[i] 都是整数，回代时只做整除
+        const BigInteger& det = augmented(n - 1,n - 1);
+        std::vector<BigInteger> numerators(n);
+        for(std::size_t i = n;i-- > 0;){
+            const BigInteger* row = augmented.rowData(i);
+            BigInteger sum = det * row[n];
+            for(std::size_t j = i + 1;j < n;++j){
+                if(!row[j].isZero()){
+                    sum -= row[j] * numerators[j];
+                }
+            }
+            numerators[i] = sum / row[i];
+        }
+        std::vector<BigFraction> result;
+        result.reserve(n);
+        for(std::size_t i = 0;i < n;++i){
+            result.emplace_back(numerators[i],det);
+        }
+        return result;
+    }
+
+    std::vector<BigFraction> solve(const FractionMatrix& matrix,const std::vector<Fraction>& rhs,
+        AntonaStandard::ThreadTools::ThreadsPool* pool){
+        return solve(BigFractionMatrix(matrix),toBigFractions(rhs),pool);
+    }
+}
@@ -0,0 +1,590 @@
+#include <Math/NumericKernels.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define MATH_NUMERICKERNELS_X86 1
+    #include <immintrin.h>
+#else
+    #define MATH_NUMERICKERNELS_X86 0
+#endif
+
+namespace AntonaStandard::Math{
+    namespace{
+        /// @brief gemm 寄存器分块的行数
+        constexpr std::size_t gemm_sliver_rows = 6;
+        /// @brief gemm 寄存器分块的最大列数（AVX-512 为 16）
+        constexpr std::size_t gemm_max_sliver_columns = 16;
+        /// @brief 打包的 A 子块行数，是 gemm_sliver_rows 的整数倍，A 子块留在 L2 中
+        constexpr std::size_t gemm_block_rows = 96;
+        /// @brief 打包的子块深度，B 的一个窄条留在 L1 中
+        constexpr std::size_t gemm_block_depth = 256;
+        /// @brief 打包的 B 子块列数
+        constexpr std::size_t gemm_block_columns = 2048;
+
+        /// @brief 寄存器分块内核：c 的 gemm_sliver_rows 行 sliver_columns 列加上 alpha 乘以两个打包窄条的乘积
+        using GemmMicroKernel = void(*)(std::size_t depth,const double* a,const double* b,double* c,std::size_t ldc,double alpha);
+
+        /// @brief 一种指令集的全部内核
+        struct Kernels{
+            double (*dot)(const double* x,const double* y,std::size_t n);
+            void (*axpy)(double alpha,const double* x,double* y,std::size_t n);
+            double (*sum)(const double* x,std::size_t n);
+            double (*maxAbs)(const double* x,std::size_t n);
+            /// @brief 稀疏行与稠密向量的内积
+            double (*sparseDot)(const std::uint32_t* indices,const double* values,std::size_t n,const double* x);
+            GemmMicroKernel gemmMicro;
+            std::size_t sliver_columns;
+        };
+
+        // 标量实现
+        double dotScalar(const double* x,const double* y,std::size_t n){
+            double result = 0;
+            for(std::size_t i = 0; i < n; ++i){
+                result += x[i] * y[i];
+            }
+            return result;
+        }
+        void axpyScalar(double alpha,const double* x,double* y,std::size_t n){
+            for(std::size_t i = 0; i < n; ++i){
+                y[i] += alpha * x[i];
+            }
+        }
+        double sumScalar(const double* x,std::size_t n){
+            double result = 0;
+            for(std::size_t i = 0; i < n; ++i){
+                result += x[i];
+            }
+            return result;
+        }
+        double maxAbsScalar(const double* x,std::size_t n){
+            double result = 0;
+            for(std::size_t i = 0; i < n; ++i){
+                result = std::max(result,std::fabs(x[i]));
+            }
+            return result;
+        }
+        double sparseDotScalar(const std::uint32_t* indices,const double* values,std::size_t n,const double* x){
+            double result = 0;
+            for(std::size_t i = 0; i < n; ++i){
+                result += values[i] * x[indices[i]];
+            }
+            return result;
+        }
+        void gemmMicroScalar(std::size_t depth,const double* a,const double* b,double* c,std::size_t ldc,double alpha){
+            constexpr std::size_t columns = 4;
+            double acc[gemm_sliver_rows][columns] = {};
+            for(std::size_t p = 0; p < depth; ++p){
+                for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                    for(std::size_t j = 0; j < columns; ++j){
+                        acc[r][j] += a[r] * b[j];
+                    }
+                }
+                a += gemm_sliver_rows;
+                b += columns;
+            }
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                for(std::size_t j = 0; j < columns; ++j){
+                    c[r * ldc + j] += alpha * acc[r][j];
+                }
+            }
+        }
+
+        constexpr Kernels scalar_kernels = {
+            dotScalar,axpyScalar,sumScalar,maxAbsScalar,sparseDotScalar,gemmMicroScalar,4
+        };
+
+    #if MATH_NUMERICKERNELS_X86
+        #define MATH_SSE2_TARGET __attribute__((target("sse2")))
+        #define MATH_AVX2_TARGET __attribute__((target("avx2,fma")))
+        #define MATH_AVX512_TARGET __attribute__((target("avx512f")))
+
+        MATH_SSE2_TARGET inline double horizontalSum(__m128d value){
+            return _mm_cvtsd_f64(_mm_add_sd(value,_mm_unpackhi_pd(value,value)));
+        }
+        MATH_SSE2_TARGET inline double horizontalMax(__m128d value){
+            return _mm_cvtsd_f64(_mm_max_sd(value,_mm_unpackhi_pd(value,value)));
+        }
+
+        // SSE2 实现，每次处理 2 个元素
+        MATH_SSE2_TARGET double dotSSE2(const double* x,const double* y,std::size_t n){
+            __m128d s0 = _mm_setzero_pd();
+            __m128d s1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                s0 = _mm_add_pd(s0,_mm_mul_pd(_mm_loadu_pd(x + i),_mm_loadu_pd(y + i)));
+                s1 = _mm_add_pd(s1,_mm_mul_pd(_mm_loadu_pd(x + i + 2),_mm_loadu_pd(y + i + 2)));
+            }
+            double result = horizontalSum(_mm_add_pd(s0,s1));
+            for(; i < n; ++i){
+                result += x[i] * y[i];
+            }
+            return result;
+        }
+        MATH_SSE2_TARGET void axpySSE2(double alpha,const double* x,double* y,std::size_t n){
+            __m128d factor = _mm_set1_pd(alpha);
+            std::size_t i = 0;
+            for(; i + 2 <= n; i += 2){
+                _mm_storeu_pd(y + i,_mm_add_pd(_mm_loadu_pd(y + i),_mm_mul_pd(factor,_mm_loadu_pd(x + i))));
+            }
+            for(; i < n; ++i){
+                y[i] += alpha * x[i];
+            }
+        }
+        MATH_SSE2_TARGET double sumSSE2(const double* x,std::size_t n){
+            __m128d s0 = _mm_setzero_pd();
+            __m128d s1 = _mm_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                s0 = _mm_add_pd(s0,_mm_loadu_pd(x + i));
+                s1 = _mm_add_pd(s1,_mm_loadu_pd(x + i + 2));
+            }
+            double result = horizontalSum(_mm_add_pd(s0,s1));
+            for(; i < n; ++i){
+                result += x[i];
+            }
+            return result;
+        }
+        MATH_SSE2_TARGET double maxAbsSSE2(const double* x,std::size_t n){
+            const __m128d mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+            __m128d m = _mm_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 2 <= n; i += 2){
+                m = _mm_max_pd(m,_mm_and_pd(mask,_mm_loadu_pd(x + i)));
+            }
+            double result = horizontalMax(m);
+            for(; i < n; ++i){
+                result = std::max(result,std::fabs(x[i]));
+            }
+            return result;
+        }
+        MATH_SSE2_TARGET double sparseDotSSE2(const std::uint32_t* indices,const double* values,std::size_t n,const double* x){
+            // SSE2 没有 gather，逐个读取后拼成向量
+            __m128d s = _mm_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 2 <= n; i += 2){
+                __m128d gathered = _mm_set_pd(x[indices[i + 1]],x[indices[i]]);
+                s = _mm_add_pd(s,_mm_mul_pd(_mm_loadu_pd(values + i),gathered));
+            }
+            double result = horizontalSum(s);
+            for(; i < n; ++i){
+                result += values[i] * x[indices[i]];
+            }
+            return result;
+        }
+        MATH_SSE2_TARGET void gemmMicroSSE2(std::size_t depth,const double* a,const double* b,double* c,std::size_t ldc,double alpha){
+            __m128d acc[gemm_sliver_rows][2];
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                acc[r][0] = _mm_setzero_pd();
+                acc[r][1] = _mm_setzero_pd();
+            }
+            for(std::size_t p = 0; p < depth; ++p){
+                __m128d b0 = _mm_loadu_pd(b);
+                __m128d b1 = _mm_loadu_pd(b + 2);
+                for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                    __m128d ar = _mm_set1_pd(a[r]);
+                    acc[r][0] = _mm_add_pd(acc[r][0],_mm_mul_pd(ar,b0));
+                    acc[r][1] = _mm_add_pd(acc[r][1],_mm_mul_pd(ar,b1));
+                }
+                a += gemm_sliver_rows;
+                b += 4;
+            }
+            __m128d factor = _mm_set1_pd(alpha);
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                double* row = c + r * ldc;
+                _mm_storeu_pd(row,_mm_add_pd(_mm_loadu_pd(row),_mm_mul_pd(factor,acc[r][0])));
+                _mm_storeu_pd(row + 2,_mm_add_pd(_mm_loadu_pd(row + 2),_mm_mul_pd(factor,acc[r][1])));
+            }
+        }
+
+        // AVX2 + FMA 实现，每次处理 4 个元素
+        MATH_AVX2_TARGET inline double horizontalSum(__m256d value){
+            return horizontalSum(_mm_add_pd(_mm256_castpd256_pd128(value),_mm256_extractf128_pd(value,1)));
+        }
+        MATH_AVX2_TARGET double dotAVX2(const double* x,const double* y,std::size_t n){
+            __m256d s0 = _mm256_setzero_pd();
+            __m256d s1 = _mm256_setzero_pd();
+            __m256d s2 = _mm256_setzero_pd();
+            __m256d s3 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 16 <= n; i += 16){
+                s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i),_mm256_loadu_pd(y + i),s0);
+                s1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4),_mm256_loadu_pd(y + i + 4),s1);
+                s2 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 8),_mm256_loadu_pd(y + i + 8),s2);
+                s3 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 12),_mm256_loadu_pd(y + i + 12),s3);
+            }
+            for(; i + 4 <= n; i += 4){
+                s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i),_mm256_loadu_pd(y + i),s0);
+            }
+            double result = horizontalSum(_mm256_add_pd(_mm256_add_pd(s0,s1),_mm256_add_pd(s2,s3)));
+            for(; i < n; ++i){
+                result += x[i] * y[i];
+            }
+            return result;
+        }
+        MATH_AVX2_TARGET void axpyAVX2(double alpha,const double* x,double* y,std::size_t n){
+            __m256d factor = _mm256_set1_pd(alpha);
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                _mm256_storeu_pd(y + i,_mm256_fmadd_pd(factor,_mm256_loadu_pd(x + i),_mm256_loadu_pd(y + i)));
+                _mm256_storeu_pd(y + i + 4,_mm256_fmadd_pd(factor,_mm256_loadu_pd(x + i + 4),_mm256_loadu_pd(y + i + 4)));
+            }
+            for(; i < n; ++i){
+                y[i] += alpha * x[i];
+            }
+        }
+        MATH_AVX2_TARGET double sumAVX2(const double* x,std::size_t n){
+            __m256d s0 = _mm256_setzero_pd();
+            __m256d s1 = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                s0 = _mm256_add_pd(s0,_mm256_loadu_pd(x + i));
+                s1 = _mm256_add_pd(s1,_mm256_loadu_pd(x + i + 4));
+            }
+            double result = horizontalSum(_mm256_add_pd(s0,s1));
+            for(; i < n; ++i){
+                result += x[i];
+            }
+            return result;
+        }
+        MATH_AVX2_TARGET double maxAbsAVX2(const double* x,std::size_t n){
+            const __m256d mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFLL));
+            __m256d m = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                m = _mm256_max_pd(m,_mm256_and_pd(mask,_mm256_loadu_pd(x + i)));
+            }
+            double result = horizontalMax(_mm_max_pd(_mm256_castpd256_pd128(m),_mm256_extractf128_pd(m,1)));
+            for(; i < n; ++i){
+                result = std::max(result,std::fabs(x[i]));
+            }
+            return result;
+        }
+        MATH_AVX2_TARGET double sparseDotAVX2(const std::uint32_t* indices,const double* values,std::size_t n,const double* x){
+            __m256d s = _mm256_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 4 <= n; i += 4){
+                __m128i index = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+                s = _mm256_fmadd_pd(_mm256_loadu_pd(values + i),_mm256_i32gather_pd(x,index,8),s);
+            }
+            double result = horizontalSum(s);
+            for(; i < n; ++i){
+                result += values[i] * x[indices[i]];
+            }
+            return result;
+        }
+        MATH_AVX2_TARGET void gemmMicroAVX2(std::size_t depth,const double* a,const double* b,double* c,std::size_t ldc,double alpha){
+            __m256d acc[gemm_sliver_rows][2];
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                acc[r][0] = _mm256_setzero_pd();
+                acc[r][1] = _mm256_setzero_pd();
+            }
+            for(std::size_t p = 0; p < depth; ++p){
+                __m256d b0 = _mm256_loadu_pd(b);
+                __m256d b1 = _mm256_loadu_pd(b + 4);
+                for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                    __m256d ar = _mm256_broadcast_sd(a + r);
+                    acc[r][0] = _mm256_fmadd_pd(ar,b0,acc[r][0]);
+                    acc[r][1] = _mm256_fmadd_pd(ar,b1,acc[r][1]);
+                }
+                a += gemm_sliver_rows;
+                b += 8;
+            }
+            __m256d factor = _mm256_set1_pd(alpha);
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                double* row = c + r * ldc;
+                _mm256_storeu_pd(row,_mm256_fmadd_pd(factor,acc[r][0],_mm256_loadu_pd(row)));
+                _mm256_storeu_pd(row + 4,_mm256_fmadd_pd(factor,acc[r][1],_mm256_loadu_pd(row + 4)));
+            }
+        }
+
+        // AVX-512F 实现，每次处理 8 个元素，尾部使用掩码
+        MATH_AVX512_TARGET inline __mmask8 tailMask(std::size_t rest){
+            return static_cast<__mmask8>((1u << rest) - 1);
+        }
+        MATH_AVX512_TARGET double dotAVX512(const double* x,const double* y,std::size_t n){
+            __m512d s0 = _mm512_setzero_pd();
+            __m512d s1 = _mm512_setzero_pd();
+            __m512d s2 = _mm512_setzero_pd();
+            __m512d s3 = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 32 <= n; i += 32){
+                s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i),_mm512_loadu_pd(y + i),s0);
+                s1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8),_mm512_loadu_pd(y + i + 8),s1);
+                s2 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 16),_mm512_loadu_pd(y + i + 16),s2);
+                s3 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 24),_mm512_loadu_pd(y + i + 24),s3);
+            }
+            for(; i + 8 <= n; i += 8){
+                s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i),_mm512_loadu_pd(y + i),s0);
+            }
+            if(i < n){
+                __mmask8 mask = tailMask(n - i);
+                s1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask,x + i),_mm512_maskz_loadu_pd(mask,y + i),s1);
+            }
+            return _mm512_reduce_add_pd(_mm512_add_pd(_mm512_add_pd(s0,s1),_mm512_add_pd(s2,s3)));
+        }
+        MATH_AVX512_TARGET void axpyAVX512(double alpha,const double* x,double* y,std::size_t n){
+            __m512d factor = _mm512_set1_pd(alpha);
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                _mm512_storeu_pd(y + i,_mm512_fmadd_pd(factor,_mm512_loadu_pd(x + i),_mm512_loadu_pd(y + i)));
+            }
+            if(i < n){
+                __mmask8 mask = tailMask(n - i);
+                __m512d result = _mm512_fmadd_pd(factor,_mm512_maskz_loadu_pd(mask,x + i),_mm512_maskz_loadu_pd(mask,y + i));
+                _mm512_mask_storeu_pd(y + i,mask,result);
+            }
+        }
+        MATH_AVX512_TARGET double sumAVX512(const double* x,std::size_t n){
+            __m512d s0 = _mm512_setzero_pd();
+            __m512d s1 = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 16 <= n; i += 16){
+                s0 = _mm512_add_pd(s0,_mm512_loadu_pd(x + i));
+                s1 = _mm512_add_pd(s1,_mm512_loadu_pd(x + i + 8));
+            }
+            for(; i + 8 <= n; i += 8){
+                s0 = _mm512_add_pd(s0,_mm512_loadu_pd(x + i));
+            }
+            if(i < n){
+                s1 = _mm512_add_pd(s1,_mm512_maskz_loadu_pd(tailMask(n - i),x + i));
+            }
+            return _mm512_reduce_add_pd(_mm512_add_pd(s0,s1));
+        }
+        MATH_AVX512_TARGET double maxAbsAVX512(const double* x,std::size_t n){
+            __m512d m = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                m = _mm512_max_pd(m,_mm512_abs_pd(_mm512_loadu_pd(x + i)));
+            }
+            if(i < n){
+                // 掩码外的通道为 0，不影响最大值
+                m = _mm512_max_pd(m,_mm512_abs_pd(_mm512_maskz_loadu_pd(tailMask(n - i),x + i)));
+            }
+            return _mm512_reduce_max_pd(m);
+        }
+        MATH_AVX512_TARGET double sparseDotAVX512(const std::uint32_t* indices,const double* values,std::size_t n,const double* x){
+            __m512d s = _mm512_setzero_pd();
+            std::size_t i = 0;
+            for(; i + 8 <= n; i += 8){
+                __m256i index = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices + i));
+                s = _mm512_fmadd_pd(_mm512_loadu_pd(values + i),_mm512_i32gather_pd(index,x,8),s);
+            }
+            double result = _mm512_reduce_add_pd(s);
+            for(; i < n; ++i){
+                result += values[i] * x[indices[i]];
+            }
+            return result;
+        }
+        MATH_AVX512_TARGET void gemmMicroAVX512(std::size_t depth,const double* a,const double* b,double* c,std::size_t ldc,double alpha){
+            __m512d acc[gemm_sliver_rows][2];
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                acc[r][0] = _mm512_setzero_pd();
+                acc[r][1] = _mm512_setzero_pd();
+            }
+            for(std::size_t p = 0; p < depth; ++p){
+                __m512d b0 = _mm512_loadu_pd(b);
+                __m512d b1 = _mm512_loadu_pd(b + 8);
+                for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                    __m512d ar = _mm512_set1_pd(a[r]);
+                    acc[r][0] = _mm512_fmadd_pd(ar,b0,acc[r][0]);
+                    acc[r][1] = _mm512_fmadd_pd(ar,b1,acc[r][1]);
+                }
+                a += gemm_sliver_rows;
+                b += 16;
+            }
+            __m512d factor = _mm512_set1_pd(alpha);
+            for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                double* row = c + r * ldc;
+                _mm512_storeu_pd(row,_mm512_fmadd_pd(factor,acc[r][0],_mm512_loadu_pd(row)));
+                _mm512_storeu_pd(row + 8,_mm512_fmadd_pd(factor,acc[r][1],_mm512_loadu_pd(row + 8)));
+            }
+        }
+
+        #undef MATH_SSE2_TARGET
+        #undef MATH_AVX2_TARGET
+        #undef MATH_AVX512_TARGET
+
+        constexpr Kernels sse2_kernels = {
+            dotSSE2,axpySSE2,sumSSE2,maxAbsSSE2,sparseDotSSE2,gemmMicroSSE2,4
+        };
+        constexpr Kernels avx2_kernels = {
+            dotAVX2,axpyAVX2,sumAVX2,maxAbsAVX2,sparseDotAVX2,gemmMicroAVX2,8
+        };
+        constexpr Kernels avx512_kernels = {
+            dotAVX512,axpyAVX512,sumAVX512,maxAbsAVX512,sparseDotAVX512,gemmMicroAVX512,16
+        };
+    #endif
+
+        SimdLevel detectSimdLevel(){
+        #if MATH_NUMERICKERNELS_X86
+            return cpuSimdLevel();
+        #else
+            return SimdLevel::Scalar;
+        #endif
+        }
+
+        std::atomic<SimdLevel>& currentSimdLevel(){
+            static std::atomic<SimdLevel> level(detectSimdLevel());
+            return level;
+        }
+
+        const Kernels& currentKernels(){
+        #if MATH_NUMERICKERNELS_X86
+            switch(currentSimdLevel().load(std::memory_order_relaxed)){
+                case SimdLevel::AVX512:
+                    return avx512_kernels;
+                case SimdLevel::AVX2:
+                    return avx2_kernels;
+                case SimdLevel::SSE2:
+                    return sse2_kernels;
+                default:
+                    break;
+            }
+        #endif
+            return scalar_kernels;
+        }
+
+        /// @brief 把 A 的 rows×depth 子块按 gemm_sliver_rows 行一组打包，每组内按列连续存放，不足的行补 0
+        void packA(const double* a,std::size_t lda,std::size_t rows,std::size_t depth,double* packed){
+            for(std::size_t i = 0; i < rows; i += gemm_sliver_rows){
+                std::size_t valid = std::min(gemm_sliver_rows,rows - i);
+                for(std::size_t p = 0; p < depth; ++p){
+                    for(std::size_t r = 0; r < gemm_sliver_rows; ++r){
+                        *packed++ = r < valid ? a[(i + r) * lda + p] : 0.0;
+                    }
+                }
+            }
+        }
+
+        /// @brief 把 B 的 depth×columns 子块按 sliver_columns 列一组打包，每组内按行连续存放，不足的列补 0
+        void packB(const double* b,std::size_t ldb,std::size_t depth,std::size_t columns,std::size_t sliver_columns,double* packed){
+            for(std::size_t j = 0; j < columns; j += sliver_columns){
+                std::size_t valid = std::min(sliver_columns,columns - j);
+                for(std::size_t p = 0; p < depth; ++p){
+                    const double* row = b + p * ldb + j;
+                    for(std::size_t c = 0; c < sliver_columns; ++c){
+                        *packed++ = c < valid ? row[c] : 0.0;
+                    }
+                }
+            }
+        }
+    }
+
+    double NumericKernels::dot(const double* x,const double* y,std::size_t n){
+        return currentKernels().dot(x,y,n);
+    }
+
+    void NumericKernels::axpy(double alpha,const double* x,double* y,std::size_t n){
+        currentKernels().axpy(alpha,x,y,n);
+    }
+
+    double NumericKernels::sum(const double* x,std::size_t n){
+        return currentKernels().sum(x,n);
+    }
+
+    double NumericKernels::maxAbs(const double* x,std::size_t n){
+        return currentKernels().maxAbs(x,n);
+    }
+
+    double NumericKernels::norm2(const double* x,std::size_t n){
+        return std::sqrt(currentKernels().dot(x,x,n));
+    }
+
+    void NumericKernels::gemv(std::size_t rows,std::size_t columns,double alpha,const double* a,std::size_t lda,
+        const double* x,double beta,double* y){
+        const Kernels& kernels = currentKernels();
+        for(std::size_t i = 0; i < rows; ++i){
+            double value = alpha * kernels.dot(a + i * lda,x,columns);
+            y[i] = beta == 0.0 ? value : value + beta * y[i];
+        }
+    }
+
+    void NumericKernels::gemm(std::size_t m,std::size_t n,std::size_t k,double alpha,const double* a,std::size_t lda,
+        const double* b,std::size_t ldb,double beta,double* c,std::size_t ldc){
+        if(beta != 1.0){
+            for(std::size_t i = 0; i < m; ++i){
+                double* row = c + i * ldc;
+                if(beta == 0.0){
+                    std::fill(row,row + n,0.0);
+                }
+                else{
+                    for(std::size_t j = 0; j < n; ++j){
+                        row[j] *= beta;
+                    }
+                }
+            }
+        }
+        if(m == 0 || n == 0 || k == 0 || alpha == 0.0){
+            return;
+        }
+        const Kernels& kernels = currentKernels();
+        const std::size_t sliver_columns = kernels.sliver_columns;
+        std::size_t block_columns = std::min(gemm_block_columns,n);
+        block_columns = (block_columns + sliver_columns - 1) / sliver_columns * sliver_columns;
+        std::vector<double> packed_a(gemm_block_rows * gemm_block_depth);
+        std::vector<double> packed_b(block_columns * gemm_block_depth);
+        double tile[gemm_sliver_rows * gemm_max_sliver_columns];
+
+        for(std::size_t jj = 0; jj < n; jj += gemm_block_columns){
+            std::size_t nc = std::min(gemm_block_columns,n - jj);
+            for(std::size_t kk = 0; kk < k; kk += gemm_block_depth){
+                std::size_t kc = std::min(gemm_block_depth,k - kk);
+                packB(b + kk * ldb + jj,ldb,kc,nc,sliver_columns,packed_b.data());
+                for(std::size_t ii = 0; ii < m; ii += gemm_block_rows){
+                    std::size_t mc = std::min(gemm_block_rows,m - ii);
+                    packA(a + ii * lda + kk,lda,mc,kc,packed_a.data());
+                    for(std::size_t j = 0; j < nc; j += sliver_columns){
+                        const double* b_sliver = packed_b.data() + (j / sliver_columns) * kc * sliver_columns;
+                        std::size_t valid_columns = std::min(sliver_columns,nc - j);
+                        for(std::size_t i = 0; i < mc; i += gemm_sliver_rows){
+                            const double* a_sliver = packed_a.data() + (i / gemm_sliver_rows) * kc * gemm_sliver_rows;
+                            std::size_t valid_rows = std::min(gemm_sliver_rows,mc - i);
+                            double* target = c + (ii + i) * ldc + jj + j;
+                            if(valid_rows == gemm_sliver_rows && valid_columns == sliver_columns){
+                                kernels.gemmMicro(kc,a_sliver,b_sliver,target,ldc,alpha);
+                                continue;
+                            }
+                            // 边缘的分块先写入临时区域，再把有效部分累加到 C
+                            std::fill(tile,tile + gemm_sliver_rows * sliver_columns,0.0);
+                            kernels.gemmMicro(kc,a_sliver,b_sliver,tile,sliver_columns,alpha);
+                            for(std::size_t r = 0; r < valid_rows; ++r){
+                                for(std::size_t col = 0; col < valid_columns; ++col){
+                                    target[r * ldc + col] += tile[r * sliver_columns + col];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void NumericKernels::spmv(std::size_t rows,const std::size_t* row_offsets,const std::uint32_t* column_indices,
+        const double* values,const double* x,double* y){
+        const Kernels& kernels = currentKernels();
+        for(std::size_t i = 0; i < rows; ++i){
+            std::size_t begin = row_offsets[i];
+            y[i] = kernels.sparseDot(column_indices + begin,values + begin,row_offsets[i + 1] - begin,x);
+        }
+    }
+
+    SimdLevel NumericKernels::simdLevel(){
+        return currentSimdLevel().load(std::memory_order_relaxed);
+    }
+
+    SimdLevel NumericKernels::setSimdLevel(SimdLevel level){
+        if(level > supportedSimdLevel()){
+            level = supportedSimdLevel();
+        }
+        currentSimdLevel().store(level,std::memory_order_relaxed);
+        return level;
+    }
+
+    SimdLevel NumericKernels::supportedSimdLevel(){
+        static SimdLevel level = detectSimdLevel();
+        return level;
+    }
+}
@@ -0,0 +1,40 @@
+#include <Math/SimdLevel.h>
+
+namespace AntonaStandard::Math{
+    namespace{
+        SimdLevel detectCpuSimdLevel(){
+        #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+            __builtin_cpu_init();
+            // __builtin_cpu_supports 同时检查操作系统是否保存了对应的寄存器状态
+            if(__builtin_cpu_supports("avx512f")){
+                return SimdLevel::AVX512;
+            }
+            if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")){
+                return SimdLevel::AVX2;
+            }
+            if(__builtin_cpu_supports("sse2")){
+                return SimdLevel::SSE2;
+            }
+        #endif
+            return SimdLevel::Scalar;
+        }
+    }
+
+    SimdLevel cpuSimdLevel(){
+        static SimdLevel level = detectCpuSimdLevel();
+        return level;
+    }
+
+    const char* simdLevelName(SimdLevel level){
+        switch(level){
+            case SimdLevel::SSE2:
+                return "SSE2";
+            case SimdLevel::AVX2:
+                return "AVX2";
+            case SimdLevel::AVX512:
+                return "AVX-512";
+            default:
+                return "Scalar";
+        }
+    }
+}
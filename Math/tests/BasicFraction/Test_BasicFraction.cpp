@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <Math/BasicFraction.h>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+
+TEST(Test_BasicFraction, BinaryGcd){
+    using AntonaStandard::Math::binaryGcd;
+    EXPECT_EQ(6u, binaryGcd(48u, 18u));
+    EXPECT_EQ(7u, binaryGcd(0u, 7u));
+    EXPECT_EQ(7u, binaryGcd(7u, 0u));
+    EXPECT_EQ(1u, binaryGcd(17u, 31u));
+    EXPECT_EQ(1024ull, binaryGcd(1024ull * 3, 1024ull * 5));
+    static_assert(binaryGcd(12u, 8u) == 4u);
+
+    using AntonaStandard::Math::uint128_t;
+    uint128_t big = uint128_t(1) << 100;
+    EXPECT_TRUE(binaryGcd<uint128_t>(big * 3, big * 9) == big * 3);
+}
+
+TEST(Test_BasicFraction, Constructor){
+    using AntonaStandard::Math::Fraction32;
+    Fraction32 fraction(2, -4);
+    EXPECT_EQ(-2, fraction.getNumerator());
+    EXPECT_EQ(4, fraction.getDenominator());
+    EXPECT_FALSE(fraction.isReduced());
+    fraction.normalize();
+    EXPECT_EQ(-1, fraction.getNumerator());
+    EXPECT_EQ(2, fraction.getDenominator());
+    EXPECT_TRUE(fraction.isReduced());
+    EXPECT_DEATH(Fraction32(1, 0), ".*");
+    EXPECT_THROW(Fraction32(std::numeric_limits<std::int32_t>::min(), -1), AntonaStandard::Globals::Overflow_Error);
+
+    constexpr Fraction32 half(3, 6);
+    static_assert(half.reduced().getNumerator() == 1 && half.reduced().getDenominator() == 2);
+}
+
+TEST(Test_BasicFraction, Arithmetic){
+    using AntonaStandard::Math::Fraction32;
+    EXPECT_EQ(Fraction32(5, 6), Fraction32(1, 2) + Fraction32(1, 3));
+    EXPECT_EQ(Fraction32(1, 6), Fraction32(1, 2) - Fraction32(1, 3));
+    EXPECT_EQ(Fraction32(1, 6), Fraction32(1, 2) * Fraction32(1, 3));
+    EXPECT_EQ(Fraction32(3, 2), Fraction32(1, 2) / Fraction32(1, 3));
+    EXPECT_EQ(Fraction32(-3, 2), Fraction32(1, 2) / Fraction32(-1, 3));
+    EXPECT_EQ(Fraction32(-1, 2), -Fraction32(1, 2));
+
+    // 分母相同时直接合并分子，不化简
+    Fraction32 sum = Fraction32(1, 4) + Fraction32(1, 4);
+    EXPECT_EQ(2, sum.getNumerator());
+    EXPECT_EQ(4, sum.getDenominator());
+
+    Fraction32 value(1, 2);
+    EXPECT_EQ(Fraction32(1, 2), value++);
+    EXPECT_EQ(Fraction32(5, 2), ++value);
+    EXPECT_EQ(Fraction32(3, 2), --value);
+    EXPECT_DOUBLE_EQ(1.5, value.toFloating());
+
+    EXPECT_DEATH(Fraction32(1) / Fraction32(0), ".*");
+
+    static_assert(Fraction32(1, 2) + Fraction32(1, 3) == Fraction32(5, 6));
+    static_assert(Fraction32(1, 3) < Fraction32(1, 2));
+}
+
+TEST(Test_BasicFraction, LazyReduction){
+    using AntonaStandard::Math::Fraction32;
+    // 中间结果超出 int 范围时化简
+    Fraction32 fraction1(1, 65536);
+    Fraction32 fraction2(1, 65537);
+    Fraction32 product = Fraction32(1 << 20, 1 << 12) * Fraction32(1 << 12, 1 << 20);
+    EXPECT_EQ(Fraction32(1), product);
+    EXPECT_EQ(1, product.getNumerator());
+    EXPECT_EQ(1, product.getDenominator());
+    EXPECT_THROW(fraction1 * fraction2, AntonaStandard::Globals::Overflow_Error);
+
+    // 累加调和级数的前 20 项，结果与逐项化简相同
+    Fraction32 harmonic;
+    for(int i = 1; i <= 20; ++i){
+        harmonic += Fraction32(1, i);
+    }
+    harmonic.normalize();
+    EXPECT_EQ(55835135, harmonic.getNumerator());
+    EXPECT_EQ(15519504, harmonic.getDenominator());
+}
+
+TEST(Test_BasicFraction, Compare){
+    using AntonaStandard::Math::Fraction32;
+    using AntonaStandard::Math::Fraction64;
+    constexpr std::int32_t max32 = std::numeric_limits<std::int32_t>::max();
+    EXPECT_FALSE(Fraction32(max32, max32 - 1) > Fraction32(max32 - 1, max32 - 2));
+    EXPECT_TRUE(Fraction32(max32 - 1, max32) < Fraction32(max32, max32 - 1));
+    EXPECT_TRUE(Fraction32(2, 4) == Fraction32(1, 2));
+    EXPECT_TRUE(Fraction32(2, 4) <= Fraction32(1, 2));
+    EXPECT_TRUE(Fraction32(2, 4) >= Fraction32(1, 2));
+    EXPECT_TRUE(Fraction32(-1, 2) != Fraction32(1, 2));
+
+    constexpr std::int64_t max64 = std::numeric_limits<std::int64_t>::max();
+    EXPECT_TRUE(Fraction64(max64 - 1, max64) < Fraction64(max64, max64 - 1));
+    EXPECT_EQ(Fraction64(1), Fraction64(max64, 3) * Fraction64(3, max64));
+}
+
+TEST(Test_BasicFraction, Stream){
+    using AntonaStandard::Math::Fraction64;
+    std::stringstream ss;
+    ss<<Fraction64(2, 4)<<" "<<Fraction64(-6, 3);
+    EXPECT_EQ("1/2 -2/1", ss.str());
+}
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <Math/BigFraction.h>
+#include <limits>
+#include <random>
+#include <sstream>
+
+using AntonaStandard::Math::BigFraction;
+using AntonaStandard::Math::BigInteger;
+using AntonaStandard::Math::Fraction;
+
+TEST(Test_BigFraction, Constructor){
+    BigFraction fraction(2, -4);
+    EXPECT_EQ(-1, fraction.getNumerator());
+    EXPECT_EQ(2, fraction.getDenominator());
+    EXPECT_EQ(BigFraction(0), BigFraction());
+    EXPECT_EQ(BigFraction(3, 1), BigFraction(3));
+    EXPECT_EQ(BigFraction(1, 3), BigFraction(Fraction(2, 6)));
+    EXPECT_EQ(BigFraction(BigInteger("200000000000000000000"), BigInteger("-400000000000000000000")), BigFraction(-1, 2));
+    EXPECT_DEATH(BigFraction(1, 0), ".*");
+
+    // 字符串的解析规则与 Fraction 相同
+    const char* inputs[] = {"1/2", "1A/2", "1//2", "1/2A", "1/2//", "A/0", "-1/B", "1/-2", "  7", "", "子/母"};
+    for(const char* input:inputs){
+        EXPECT_EQ(BigFraction(Fraction(input)), BigFraction(input))<<input;
+    }
+    EXPECT_EQ(BigFraction(BigInteger("100000000000000000000"), 3), BigFraction("100000000000000000000/3"));
+
+    // 超出 long long 的无符号整数保留完整的值
+    const unsigned long long max = std::numeric_limits<unsigned long long>::max();
+    EXPECT_EQ(BigInteger("18446744073709551615"), BigFraction(max).getNumerator());
+    EXPECT_EQ(BigFraction("18446744073709551615/9223372036854775808"), BigFraction(max, 1ULL << 63));
+    EXPECT_EQ(BigFraction(1), BigFraction(max, max));
+    EXPECT_EQ(BigInteger(42), BigInteger::fromUnsigned(42));
+}
+
+TEST(Test_BigFraction, MatchFraction){
+    std::mt19937 engine(17);
+    std::uniform_int_distribution<int> num_dist(-1000, 1000);
+    std::uniform_int_distribution<int> den_dist(1, 1000);
+    for(int i = 0; i < 1000; ++i){
+        Fraction a(num_dist(engine), den_dist(engine));
+        Fraction b(num_dist(engine), den_dist(engine));
+        BigFraction big_a(a), big_b(b);
+        EXPECT_EQ(BigFraction(a + b), big_a + big_b);
+        EXPECT_EQ(BigFraction(a - b), big_a - big_b);
+        EXPECT_EQ(BigFraction(a * b), big_a * big_b);
+        if(b != 0){
+            EXPECT_EQ(BigFraction(a / b), big_a / big_b);
+        }
+        EXPECT_EQ(a < b, big_a < big_b);
+        EXPECT_EQ(a >= b, big_a >= big_b);
+        EXPECT_EQ(a == b, big_a == big_b);
+        EXPECT_EQ(a + b, (big_a + big_b).toFraction());
+    }
+}
+
+TEST(Test_BigFraction, Operators){
+    BigFraction value(1, 2);
+    EXPECT_EQ(BigFraction(1, 2), value++);
+    EXPECT_EQ(BigFraction(5, 2), ++value);
+    EXPECT_EQ(BigFraction(3, 2), --value);
+    EXPECT_EQ(BigFraction(-3, 2), -value);
+    EXPECT_EQ(BigFraction(2), value + "1/2");
+    EXPECT_EQ(BigFraction(1), value - Fraction(1, 2));
+    EXPECT_EQ(BigFraction(3), value * 2);
+    EXPECT_EQ(BigFraction(3, 4), value / 2);
+    EXPECT_TRUE(value > 1);
+    EXPECT_TRUE(value != 1);
+    EXPECT_TRUE(value <= "3/2");
+    EXPECT_EQ(BigFraction(0), value * 0);
+    EXPECT_DEATH(value / 0, ".*");
+
+    std::stringstream ss("-6/4 5");
+    BigFraction first, second;
+    ss>>first>>second;
+    EXPECT_EQ(BigFraction(-3, 2), first);
+    EXPECT_EQ(BigFraction(5), second);
+    std::stringstream out;
+    out<<first<<" "<<second;
+    EXPECT_EQ("-3/2 5/1", out.str());
+}
+
+TEST(Test_BigFraction, Overflow){
+    constexpr int max = std::numeric_limits<int>::max();
+    EXPECT_THROW(Fraction(max) + 1, AntonaStandard::Globals::Overflow_Error);
+    BigFraction sum = BigFraction(Fraction(max)) + 1;
+    EXPECT_EQ("2147483648", sum.getNumerator().toString());
+    EXPECT_THROW(sum.toFraction(), AntonaStandard::Globals::Overflow_Error);
+    EXPECT_EQ(Fraction(max), (sum - 1).toFraction());
+
+    // 调和级数
+    BigFraction harmonic;
+    for(int i = 1; i <= 20; ++i){
+        harmonic += BigFraction(1, i);
+    }
+    EXPECT_EQ(BigFraction(55835135, 15519504), harmonic);
+    for(int i = 21; i <= 200; ++i){
+        harmonic += BigFraction(1, i);
+    }
+    BigFraction reversed;
+    for(int i = 200; i >= 1; --i){
+        reversed += BigFraction(1, i);
+    }
+    EXPECT_EQ(harmonic, reversed);
+    EXPECT_EQ(BigFraction(1, 200), harmonic - (reversed - BigFraction(1, 200)));
+    EXPECT_NEAR(5.878030948121446, harmonic.toDouble(), 1e-12);
+
+    BigFraction power(1);
+    for(int i = 0; i < 100; ++i){
+        power *= BigFraction(2, 3);
+    }
+    EXPECT_FALSE(power.getDenominator().isSmall());
+    for(int i = 0; i < 100; ++i){
+        power /= BigFraction(2, 3);
+    }
+    EXPECT_EQ(BigFraction(1), power);
+}
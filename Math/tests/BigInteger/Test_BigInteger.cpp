@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <Math/BigInteger.h>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+
+using AntonaStandard::Math::BigInteger;
+
+namespace{
+    __extension__ typedef __int128 int128;
+
+    std::string toString(int128 value){
+        if(value == 0){
+            return "0";
+        }
+        bool negative = value < 0;
+        unsigned __int128 magnitude = negative ? -static_cast<unsigned __int128>(value) : value;
+        std::string result;
+        while(magnitude != 0){
+            result.insert(result.begin(), char('0' + int(magnitude % 10)));
+            magnitude /= 10;
+        }
+        return negative ? "-" + result : result;
+    }
+
+    int128 randomInt128(std::mt19937_64& engine, int bits){
+        int128 value = (static_cast<int128>(engine()) << 64) | engine();
+        value &= (static_cast<int128>(1) << bits) - 1;
+        return (engine() & 1) ? -value : value;
+    }
+
+    BigInteger randomBig(std::mt19937_64& engine, std::size_t digits){
+        std::string str = (engine() & 1) ? "-" : "";
+        str.push_back(char('1' + engine() % 9));
+        for(std::size_t i = 1; i < digits; ++i){
+            str.push_back(char('0' + engine() % 10));
+        }
+        return BigInteger(str);
+    }
+
+    // 用取模的欧几里得算法计算最大公约数，作为 Lehmer 算法的对照
+    BigInteger euclid(BigInteger a, BigInteger b){
+        a = a.abs();
+        b = b.abs();
+        while(!b.isZero()){
+            BigInteger r = a % b;
+            a = b;
+            b = r;
+        }
+        return a;
+    }
+}
+
+TEST(Test_BigInteger, SmallFastPath){
+    constexpr long long max = std::numeric_limits<long long>::max();
+    constexpr long long min = std::numeric_limits<long long>::min();
+    BigInteger value(max);
+    EXPECT_TRUE(value.isSmall());
+    ++value;
+    EXPECT_FALSE(value.isSmall());
+    EXPECT_EQ("9223372036854775808", value.toString());
+    EXPECT_THROW(value.toLongLong(), AntonaStandard::Globals::Overflow_Error);
+    --value;
+    EXPECT_TRUE(value.isSmall());
+    EXPECT_EQ(max, value.toLongLong());
+
+    BigInteger minimum(min);
+    EXPECT_EQ("9223372036854775808", (-minimum).toString());
+    EXPECT_FALSE((-minimum).isSmall());
+    EXPECT_TRUE((-(-minimum)).isSmall());
+    EXPECT_EQ("-9223372036854775808", (minimum / -1 * -1).toString());
+    EXPECT_EQ(0, (minimum % -1).toLongLong());
+    EXPECT_EQ(BigInteger(min), BigInteger(max) * -1 - 1);
+    EXPECT_EQ(64u, BigInteger(min).bitLength());
+    EXPECT_EQ(0u, BigInteger(0).bitLength());
+}
+
+TEST(Test_BigInteger, UnsignedConstruction){
+    // 超出 long long 的无符号值保留完整的值，不会变成负数
+    constexpr unsigned long long umax = std::numeric_limits<unsigned long long>::max();
+    BigInteger value(umax);
+    EXPECT_FALSE(value.isSmall());
+    EXPECT_FALSE(value.isNegative());
+    EXPECT_EQ("18446744073709551615", value.toString());
+    EXPECT_EQ(BigInteger::fromUnsigned(umax), value);
+    EXPECT_EQ("9223372036854775808", BigInteger(1ULL << 63).toString());
+    EXPECT_EQ(value + 1, BigInteger(1ULL << 63) * 4 / 2);
+
+    // 各种整数类型都可以隐式转换，不会产生二义性
+    EXPECT_TRUE(BigInteger(5u).isSmall());
+    EXPECT_EQ(BigInteger(5), BigInteger(5u));
+    EXPECT_EQ(BigInteger(5), BigInteger(5ul));
+    EXPECT_EQ(BigInteger(-5), BigInteger(-5l));
+    EXPECT_EQ(BigInteger(static_cast<short>(-5)), BigInteger(-5LL));
+    EXPECT_EQ(BigInteger(255), BigInteger(static_cast<unsigned char>(255)));
+    EXPECT_EQ(BigInteger(10), BigInteger(5) + 5u);
+}
+
+TEST(Test_BigInteger, String){
+    const char* values[] = {
+        "0", "-1", "123456789", "1000000000", "-1000000000000000000000",
+        "340282366920938463463374607431768211456", "-99999999999999999999999999999999999999999999"
+    };
+    for(const char* value:values){
+        EXPECT_EQ(value, BigInteger(value).toString());
+    }
+    EXPECT_EQ("42", BigInteger("+42").toString());
+    EXPECT_EQ("7", BigInteger("0007").toString());
+    EXPECT_THROW(BigInteger(""), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(BigInteger("-"), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(BigInteger("12a"), AntonaStandard::Globals::WrongArgument_Error);
+
+    std::stringstream ss("  -123456789012345678901234567890 42 x");
+    BigInteger first, second, third;
+    ss>>first>>second;
+    EXPECT_EQ(BigInteger("-123456789012345678901234567890"), first);
+    EXPECT_EQ(42, second);
+    ss>>third;
+    EXPECT_TRUE(ss.fail());
+    std::stringstream out;
+    out<<first;
+    EXPECT_EQ("-123456789012345678901234567890", out.str());
+}
+
+TEST(Test_BigInteger, MatchInt128){
+    std::mt19937_64 engine(2024);
+    for(int i = 0; i < 2000; ++i){
+        int bits = 1 + int(engine() % 120);
+        int128 a = randomInt128(engine, bits);
+        int128 b = randomInt128(engine, 1 + int(engine() % 120));
+        BigInteger big_a(toString(a));
+        BigInteger big_b(toString(b));
+        EXPECT_EQ(toString(a + b), (big_a + big_b).toString());
+        EXPECT_EQ(toString(a - b), (big_a - big_b).toString());
+        if(b != 0){
+            EXPECT_EQ(toString(a / b), (big_a / big_b).toString())<<toString(a)<<" / "<<toString(b);
+            EXPECT_EQ(toString(a % b), (big_a % big_b).toString())<<toString(a)<<" % "<<toString(b);
+        }
+        int128 c = randomInt128(engine, 60);
+        int128 d = randomInt128(engine, 60);
+        EXPECT_EQ(toString(c * d), (BigInteger(toString(c)) * BigInteger(toString(d))).toString());
+        EXPECT_EQ(a < b, big_a < big_b);
+        EXPECT_EQ(a == b, big_a == big_b);
+    }
+}
+
+TEST(Test_BigInteger, Factorial){
+    BigInteger factorial(1);
+    for(int i = 2; i <= 50; ++i){
+        factorial *= i;
+    }
+    EXPECT_EQ("30414093201713378043612608166064768844377641568960512000000000000", factorial.toString());
+    for(int i = 50; i >= 2; --i){
+        factorial /= i;
+    }
+    EXPECT_EQ(1, factorial);
+}
+
+TEST(Test_BigInteger, Karatsuba){
+    std::mt19937_64 engine(7);
+    // 平衡与不平衡的操作数，节数均超过 karatsuba_threshold
+    const std::size_t sizes[][2] = {{400, 400}, {1000, 700}, {3000, 400}, {2000, 2000}};
+    for(auto& size:sizes){
+        BigInteger a = randomBig(engine, size[0]);
+        BigInteger b = randomBig(engine, size[1]);
+        BigInteger c = randomBig(engine, size[1]);
+        ASSERT_GE(b.limbCount(), BigInteger::karatsuba_threshold);
+        BigInteger product = a * b;
+        EXPECT_EQ(a, product / b);
+        EXPECT_EQ(0, product % b);
+        EXPECT_EQ(a * (b + c), product + a * c);
+        EXPECT_EQ((a + 1) * (a - 1), a * a - 1);
+        EXPECT_EQ(product.isNegative(), a.isNegative() != b.isNegative());
+    }
+}
+
+TEST(Test_BigInteger, Division){
+    std::mt19937_64 engine(11);
+    for(int i = 0; i < 200; ++i){
+        BigInteger a = randomBig(engine, 1 + engine() % 300);
+        BigInteger b = randomBig(engine, 1 + engine() % 150);
+        BigInteger quotient, remainder;
+        BigInteger::divMod(a, b, quotient, remainder);
+        EXPECT_EQ(a, quotient * b + remainder);
+        EXPECT_LT(remainder.abs(), b.abs());
+        EXPECT_TRUE(remainder.isZero() || remainder.isNegative() == a.isNegative());
+    }
+    // 触发加回步骤的经典用例
+    BigInteger dividend("340282366920938463444927863358058659840");
+    BigInteger divisor("18446744073709551615");
+    EXPECT_EQ(dividend, dividend / divisor * divisor + dividend % divisor);
+    EXPECT_THROW(BigInteger(1) / 0, AntonaStandard::Globals::UnlawfulOperation_Error);
+    EXPECT_THROW(BigInteger(1) % 0, AntonaStandard::Globals::UnlawfulOperation_Error);
+}
+
+TEST(Test_BigInteger, Gcd){
+    EXPECT_EQ(6, BigInteger::gcd(48, -18));
+    EXPECT_EQ(7, BigInteger::gcd(0, 7));
+    EXPECT_EQ(0, BigInteger::gcd(0, 0));
+
+    std::mt19937_64 engine(13);
+    for(int i = 0; i < 50; ++i){
+        BigInteger a = randomBig(engine, 20 + engine() % 200);
+        BigInteger b = randomBig(engine, 20 + engine() % 200);
+        BigInteger g = randomBig(engine, 1 + engine() % 60).abs();
+        BigInteger expected = euclid(a, b) * g;
+        EXPECT_EQ(expected, BigInteger::gcd(a * g, b * g));
+        EXPECT_EQ(euclid(a, b), BigInteger::gcd(a, b));
+    }
+    // 相邻的斐波那契数互素，是欧几里得算法步数最多的情况
+    BigInteger prev(1), curr(1);
+    for(int i = 0; i < 1000; ++i){
+        BigInteger next = prev + curr;
+        prev = curr;
+        curr = next;
+    }
+    EXPECT_EQ(1, BigInteger::gcd(curr, prev));
+    EXPECT_EQ(prev, BigInteger::gcd(curr * prev, prev * prev));
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+#include <Math/CsrMatrix.h>
+#include <Math/NumericKernels.h>
+#include <random>
+
+using AntonaStandard::Math::CsrMatrix;
+using AntonaStandard::Math::Matrix;
+using AntonaStandard::Math::NumericKernels;
+using AntonaStandard::Math::SimdLevel;
+
+TEST(Test_CsrMatrix, Construct){
+    CsrMatrix matrix(3, 4, {{2, 1, 5.0}, {0, 3, 1.0}, {0, 0, 2.0}, {2, 1, -1.0}});
+    EXPECT_EQ(3u, matrix.rows());
+    EXPECT_EQ(4u, matrix.columns());
+    EXPECT_EQ(3u, matrix.nonZeros());
+    EXPECT_EQ((std::vector<std::size_t>{0, 2, 2, 3}), matrix.rowOffsets());
+    EXPECT_EQ((std::vector<std::uint32_t>{0, 3, 1}), matrix.columnIndices());
+    EXPECT_EQ(2.0, matrix.at(0, 0));
+    EXPECT_EQ(4.0, matrix.at(2, 1));
+    EXPECT_EQ(0.0, matrix.at(1, 1));
+    EXPECT_THROW(matrix.at(3, 0), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(CsrMatrix(2, 2, {{2, 0, 1.0}}), AntonaStandard::Globals::WrongArgument_Error);
+
+    Matrix<double> dense{{0, 1.5, 0}, {0, 0, 0}, {-2, 0, 1e-9}};
+    CsrMatrix sparse = CsrMatrix::fromDense(dense, 1e-6);
+    EXPECT_EQ(2u, sparse.nonZeros());
+    dense(2, 2) = 0;
+    EXPECT_EQ(dense, sparse.toDense());
+}
+
+TEST(Test_CsrMatrix, Multiply){
+    std::mt19937 engine(11);
+    std::uniform_real_distribution<double> value_dist(-1.0, 1.0);
+    std::uniform_int_distribution<std::size_t> column_dist(0, 299);
+    const std::size_t rows = 200, columns = 300;
+    std::vector<CsrMatrix::Entry> entries;
+    for(std::size_t i = 0; i < rows; ++i){
+        // 每行的非零元素个数不同，覆盖 gather 的尾部
+        for(std::size_t p = 0; p < i % 23; ++p){
+            entries.push_back({i, column_dist(engine), value_dist(engine)});
+        }
+    }
+    CsrMatrix sparse(rows, columns, entries);
+    Matrix<double> dense = sparse.toDense();
+    std::vector<double> x(columns);
+    for(auto& value:x){
+        value = value_dist(engine);
+    }
+    std::vector<double> expected = dense * x;
+
+    SimdLevel origin = NumericKernels::simdLevel();
+    for(SimdLevel level:{SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512}){
+        if(NumericKernels::setSimdLevel(level) != level){
+            continue;
+        }
+        std::vector<double> result = sparse * x;
+        for(std::size_t i = 0; i < rows; ++i){
+            EXPECT_NEAR(expected[i], result[i], 1e-12)<<static_cast<int>(level)<<" i="<<i;
+        }
+    }
+    NumericKernels::setSimdLevel(origin);
+    EXPECT_THROW(sparse * std::vector<double>(3), AntonaStandard::Globals::WrongArgument_Error);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <Math/Fraction.h>
 #include <sstream>
+#include <ratio>
 
 // 构造方法单元测试
 TEST(Test_Fraction, ConstructorTest){
@@ -335,5 +336,59 @@ TEST(Test_Fraction, Operator_Stream){
     EXPECT_EQ("1/2 1/3 1/4",ss.str());
 }
 
+TEST(Test_Fraction, Operator_WideIntermediate){
+    using AntonaStandard::Math::Fraction;
+    // 交叉相乘超出 int 范围，但是化简后可以表示
+    Fraction fraction1(1, 65536);
+    Fraction fraction2(1, 65536);
+    EXPECT_EQ(Fraction(1, 32768), fraction1 + fraction2);
+    EXPECT_EQ(Fraction(1, 65536 * 2) , Fraction(1, 65536 * 4) * Fraction(2, 1));
+    EXPECT_TRUE(Fraction(46341, 46340) < Fraction(46340, 46339));
+    EXPECT_TRUE(Fraction(-2147483647, 2) < Fraction(2147483647, 3));
+    EXPECT_EQ(Fraction(2147483647, 2147483646), Fraction(2147483647, 2147483646));
+    // 化简后仍然无法表示
+    EXPECT_THROW(Fraction(2147483647, 1) + Fraction(1, 1), AntonaStandard::Globals::Overflow_Error);
+    EXPECT_THROW(Fraction(1, 46341) * Fraction(1, 46343), AntonaStandard::Globals::Overflow_Error);
+}
+
+TEST(Test_Fraction, Constexpr){
+    using AntonaStandard::Math::Fraction;
+    using AntonaStandard::Math::ratio_v;
+    using namespace AntonaStandard::Math::literals;
+
+    static_assert(Fraction::Euclid(12, 18) == 6);
+    static_assert(Fraction(2, -4).getNumerator() == -1 && Fraction(2, -4).getDenominator() == 2);
+    static_assert(Fraction(1, 2) + Fraction(1, 3) == Fraction(5, 6));
+    static_assert(Fraction(1, 2) - Fraction(1, 3) == Fraction(1, 6));
+    static_assert(Fraction(1, 2) * Fraction(2, 3) == Fraction(1, 3));
+    static_assert(Fraction(1, 2) / Fraction(1, 4) == 2);
+    static_assert(-Fraction(1, 2) < Fraction(1, 3));
+    static_assert(Fraction("24/5") == Fraction(24, 5));
+    static_assert(Fraction(" -3/ 6") == Fraction(-1, 2));
+
+    constexpr Fraction rate = 3_fr/4;
+    static_assert(rate.getNumerator() == 3 && rate.getDenominator() == 4);
+    static_assert("13/100"_fr == Fraction(13, 100));
+    static_assert(ratio_v<std::ratio<2, 6>> == Fraction(1, 3));
+    static_assert(ratio_v<std::milli> * 1000 == 1);
+    EXPECT_EQ(Fraction(3, 4), rate);
+}
+
+TEST(Test_Fraction, ConstexprParse){
+    using AntonaStandard::Math::Fraction;
+    // 编译期解析与 operator>> 的结果一致
+    const char* inputs[] = {
+        "1/2", "1A/2", "1//2", "1/2A", "1/2//", "A/0", "-1/B", "-1/2", "1/-2", "+3/+6",
+        " 7", "7 /2", "7/ 2", "", "-", "2147483647/1", "2147483648/1", "-2147483648/2", "1/0", "子/母"
+    };
+    for(const char* input:inputs){
+        std::stringstream ss(input);
+        Fraction expected;
+        ss>>expected;
+        Fraction actual(input);
+        EXPECT_EQ(expected.getNumerator(), actual.getNumerator())<<input;
+        EXPECT_EQ(expected.getDenominator(), actual.getDenominator())<<input;
+    }
+}
 
 
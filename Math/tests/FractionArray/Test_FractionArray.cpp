@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <Math/FractionArray.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+using AntonaStandard::Math::Fraction;
+using AntonaStandard::Math::FractionArray;
+using AntonaStandard::Math::SimdLevel;
+
+namespace{
+    FractionArray randomArray(std::size_t size,int limit,unsigned seed){
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution<int> num_dist(-limit,limit);
+        std::uniform_int_distribution<int> den_dist(1,limit);
+        FractionArray array;
+        for(std::size_t i = 0; i < size; ++i){
+            array.push_back(num_dist(engine),den_dist(engine));
+        }
+        return array;
+    }
+
+    // 对每种支持的指令集执行一次 func
+    template<typename type_FUNC>
+    void forEachSimdLevel(type_FUNC&& func){
+        SimdLevel origin = FractionArray::simdLevel();
+        for(SimdLevel level:{SimdLevel::Scalar,SimdLevel::AVX2}){
+            if(FractionArray::setSimdLevel(level) != level){
+                continue;
+            }
+            func(level);
+        }
+        FractionArray::setSimdLevel(origin);
+    }
+}
+
+TEST(Test_FractionArray, Construct){
+    FractionArray array{Fraction(1, 2), Fraction(2, -4), "3/9"};
+    ASSERT_EQ(3u, array.size());
+    EXPECT_EQ(Fraction(1, 2), array.get(0));
+    EXPECT_EQ(Fraction(-1, 2), array.get(1));
+    EXPECT_EQ(Fraction(1, 3), array.get(2));
+
+    array.push_back(2, -6);
+    EXPECT_EQ(-2, array.numeratorData()[3]);
+    EXPECT_EQ(6, array.denominatorData()[3]);
+
+    FractionArray zeros(5);
+    EXPECT_EQ(5u, zeros.size());
+    EXPECT_EQ(Fraction(0), zeros.get(4));
+    EXPECT_THROW(FractionArray::add(array, zeros, zeros), AntonaStandard::Globals::WrongArgument_Error);
+}
+
+TEST(Test_FractionArray, AddMulMatchScalar){
+    // 长度不是 8 的倍数，覆盖尾部的标量处理
+    const std::size_t size = 1003;
+    FractionArray lhs = randomArray(size, 1000, 1);
+    FractionArray rhs = randomArray(size, 1000, 2);
+    forEachSimdLevel([&](SimdLevel level){
+        FractionArray sum = lhs + rhs;
+        FractionArray product = lhs * rhs;
+        for(std::size_t i = 0; i < size; ++i){
+            EXPECT_EQ(lhs.get(i) + rhs.get(i), sum.get(i))<<"level "<<int(level)<<" index "<<i;
+            EXPECT_EQ(lhs.get(i) * rhs.get(i), product.get(i))<<"level "<<int(level)<<" index "<<i;
+            EXPECT_GT(sum.denominatorData()[i], 0);
+        }
+    });
+}
+
+TEST(Test_FractionArray, SameDenominator){
+    forEachSimdLevel([](SimdLevel level){
+        FractionArray lhs;
+        FractionArray rhs;
+        for(int i = 0; i < 16; ++i){
+            lhs.push_back(i, 16);
+            rhs.push_back(1, 16);
+        }
+        lhs += rhs;
+        for(int i = 0; i < 16; ++i){
+            // 分母相同时不化简
+            EXPECT_EQ(i + 1, lhs.numeratorData()[i])<<"level "<<int(level);
+            EXPECT_EQ(16, lhs.denominatorData()[i])<<"level "<<int(level);
+        }
+    });
+}
+
+TEST(Test_FractionArray, OverflowFallback){
+    constexpr int max = std::numeric_limits<int>::max();
+    forEachSimdLevel([](SimdLevel level){
+        FractionArray lhs;
+        FractionArray rhs;
+        for(int i = 0; i < 8; ++i){
+            lhs.push_back(1 << 20, 1 << 12);
+            rhs.push_back(1 << 12, 1 << 20);
+        }
+        // 中间结果超出 int 范围，化简后可以表示
+        FractionArray product = lhs * rhs;
+        for(int i = 0; i < 8; ++i){
+            EXPECT_EQ(1, product.numeratorData()[i])<<"level "<<int(level);
+            EXPECT_EQ(1, product.denominatorData()[i])<<"level "<<int(level);
+        }
+        FractionArray big{Fraction(max), Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1)};
+        FractionArray one{Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1), Fraction(1)};
+        EXPECT_THROW(big + one, AntonaStandard::Globals::Overflow_Error)<<"level "<<int(level);
+    });
+}
+
+TEST(Test_FractionArray, Compare){
+    const std::size_t size = 517;
+    FractionArray lhs = randomArray(size, 50000, 3);
+    FractionArray rhs = randomArray(size, 50000, 4);
+    rhs.set(0, lhs.get(0));
+    forEachSimdLevel([&](SimdLevel level){
+        std::vector<signed char> result;
+        FractionArray::compare(lhs, rhs, result);
+        ASSERT_EQ(size, result.size());
+        for(std::size_t i = 0; i < size; ++i){
+            int expected = (lhs.get(i) > rhs.get(i)) - (lhs.get(i) < rhs.get(i));
+            EXPECT_EQ(expected, result[i])<<"level "<<int(level)<<" index "<<i;
+        }
+    });
+}
+
+TEST(Test_FractionArray, Normalize){
+    constexpr int min = std::numeric_limits<int>::min();
+    constexpr int max = std::numeric_limits<int>::max();
+    forEachSimdLevel([&](SimdLevel level){
+        FractionArray array;
+        const int values[][2] = {
+            {0, 5}, {6, 4}, {-6, 4}, {min, 2}, {min, 1}, {max, max}, {1 << 30, 1 << 20}, {35, 49},
+            {17, 31}, {-48, 18}, {0, 1}, {1024 * 3, 1024 * 5}
+        };
+        for(auto& value:values){
+            array.push_back(value[0], value[1]);
+        }
+        array.normalize();
+        for(std::size_t i = 0; i < array.size(); ++i){
+            Fraction expected = Fraction::fromWide(values[i][0], values[i][1]);
+            EXPECT_EQ(expected.getNumerator(), array.numeratorData()[i])<<"level "<<int(level)<<" index "<<i;
+            EXPECT_EQ(expected.getDenominator(), array.denominatorData()[i])<<"level "<<int(level)<<" index "<<i;
+        }
+
+        FractionArray random = randomArray(1000, 1 << 15, 5);
+        FractionArray reduced = random;
+        reduced.normalize();
+        for(std::size_t i = 0; i < random.size(); ++i){
+            Fraction expected = random.get(i);
+            EXPECT_EQ(expected.getNumerator(), reduced.numeratorData()[i])<<"level "<<int(level)<<" index "<<i;
+            EXPECT_EQ(expected.getDenominator(), reduced.denominatorData()[i])<<"level "<<int(level)<<" index "<<i;
+        }
+    });
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include <Math/FractionFormat.h>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using AntonaStandard::Math::Fraction;
+using AntonaStandard::Math::FractionArray;
+
+TEST(Test_FractionFormat, FromChars){
+    using AntonaStandard::Math::from_chars;
+    struct Case{
+        const char* input;
+        std::errc ec;
+        std::size_t consumed;
+        Fraction value;
+    };
+    const Case cases[] = {
+        {"1/2", std::errc(), 3, Fraction(1, 2)},
+        {"-6/4,", std::errc(), 4, Fraction(-3, 2)},
+        {"6/-4", std::errc(), 4, Fraction(-3, 2)},
+        {"42", std::errc(), 2, Fraction(42)},
+        {"7/x", std::errc(), 1, Fraction(7)},
+        {"7/ 2", std::errc(), 1, Fraction(7)},
+        {"1/0", std::errc::invalid_argument, 0, Fraction(9)},
+        {"", std::errc::invalid_argument, 0, Fraction(9)},
+        {" 1/2", std::errc::invalid_argument, 0, Fraction(9)},
+        {"+1/2", std::errc::invalid_argument, 0, Fraction(9)},
+        {"2147483648/1", std::errc::result_out_of_range, 10, Fraction(9)},
+        {"1/2147483648", std::errc::result_out_of_range, 12, Fraction(9)},
+        {"-2147483648/-1", std::errc::result_out_of_range, 14, Fraction(9)},
+        {"-2147483648/2", std::errc(), 13, Fraction(-1073741824)},
+    };
+    for(const auto& item:cases){
+        Fraction value(9);
+        const char* end = item.input + std::strlen(item.input);
+        auto result = from_chars(item.input, end, value);
+        EXPECT_EQ(item.ec, result.ec)<<item.input;
+        EXPECT_EQ(item.consumed, static_cast<std::size_t>(result.ptr - item.input))<<item.input;
+        EXPECT_EQ(item.value, value)<<item.input;
+    }
+    Fraction value;
+    EXPECT_EQ(std::errc(), from_chars(std::string_view("3/9"), value).ec);
+    EXPECT_EQ(Fraction(1, 3), value);
+}
+
+TEST(Test_FractionFormat, ToChars){
+    using AntonaStandard::Math::to_chars;
+    using AntonaStandard::Math::fraction_chars_max;
+    char buffer[fraction_chars_max];
+    const Fraction values[] = {
+        Fraction(1, 2), Fraction(-3, 4), Fraction(5), Fraction(0),
+        Fraction(std::numeric_limits<int>::min(), std::numeric_limits<int>::max())
+    };
+    for(const auto& value:values){
+        auto result = to_chars(buffer, buffer + sizeof(buffer), value);
+        ASSERT_EQ(std::errc(), result.ec);
+        std::stringstream ss;
+        ss<<value.getNumerator()<<"/"<<value.getDenominator();
+        EXPECT_EQ(ss.str(), std::string(buffer, result.ptr));
+    }
+    EXPECT_EQ(fraction_chars_max, static_cast<std::size_t>(to_chars(buffer, buffer + sizeof(buffer), values[4]).ptr - buffer));
+    auto result = to_chars(buffer, buffer + 3, Fraction(1, 10));
+    EXPECT_EQ(std::errc::value_too_large, result.ec);
+    EXPECT_EQ(buffer + 3, result.ptr);
+
+    // operator<< 使用 to_chars 输出
+    std::stringstream ss;
+    ss<<Fraction(1, 2)<<" "<<Fraction(-7, 3);
+    EXPECT_EQ("1/2 -7/3", ss.str());
+}
+
+TEST(Test_FractionFormat, ParseColumns){
+    using AntonaStandard::Math::parseFractions;
+    std::vector<Fraction> values;
+    EXPECT_EQ(7u, parseFractions("1/2, 3/4 ,5\r\n-1/3\n\n 6/8,7/-14\n9", values));
+    std::vector<Fraction> expected{Fraction(1, 2), Fraction(3, 4), Fraction(5), Fraction(-1, 3), Fraction(3, 4), Fraction(-1, 2), Fraction(9)};
+    EXPECT_EQ(expected, values);
+
+    FractionArray array;
+    EXPECT_EQ(3u, parseFractions("1/2\n2/4\n3/6\n", array));
+    ASSERT_EQ(3u, array.size());
+    EXPECT_EQ(Fraction(1, 2), array.get(2));
+
+    EXPECT_EQ(0u, parseFractions("", values));
+    EXPECT_EQ(0u, parseFractions("\n \n", values));
+
+    using AntonaStandard::Globals::DataCorrupted_Error;
+    const char* invalid[] = {"1/2,,3", "1/2,", "1/2 3/4", "1/0", "abc", "1/2;3", ",1"};
+    for(const char* text:invalid){
+        std::vector<Fraction> out;
+        EXPECT_THROW(parseFractions(text, out), DataCorrupted_Error)<<text;
+    }
+    // 出错之前解析的分数保留在结果中
+    std::vector<Fraction> partial;
+    try{
+        parseFractions("1/2\n3/4\nx", partial);
+        FAIL();
+    }
+    catch(const DataCorrupted_Error& error){
+        EXPECT_NE(std::string::npos, std::string(error.what()).find("offset 8"));
+    }
+    EXPECT_EQ(2u, partial.size());
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <Math/LinearAlgebra.h>
+#include <random>
+
+using AntonaStandard::Math::BigFraction;
+using AntonaStandard::Math::BigFractionMatrix;
+using AntonaStandard::Math::BigInteger;
+using AntonaStandard::Math::Fraction;
+using AntonaStandard::Math::FractionMatrix;
+using AntonaStandard::Math::Matrix;
+
+namespace{
+    BigFractionMatrix hilbert(std::size_t n){
+        BigFractionMatrix result(n, n);
+        for(std::size_t i = 0; i < n; ++i){
+            for(std::size_t j = 0; j < n; ++j){
+                result(i, j) = BigFraction(1, static_cast<int>(i + j + 1));
+            }
+        }
+        return result;
+    }
+
+    BigFractionMatrix randomMatrix(std::size_t n, unsigned seed){
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution<int> num(-20, 20);
+        std::uniform_int_distribution<int> den(1, 12);
+        BigFractionMatrix result(n, n);
+        for(std::size_t i = 0; i < n; ++i){
+            for(std::size_t j = 0; j < n; ++j){
+                result(i, j) = BigFraction(num(engine), den(engine));
+            }
+        }
+        return result;
+    }
+}
+
+TEST(Test_LinearAlgebra, Determinant){
+    FractionMatrix matrix{{Fraction(1, 2), Fraction(1, 3)}, {Fraction(1, 4), Fraction(1, 5)}};
+    EXPECT_EQ(BigFraction(1, 60), AntonaStandard::Math::determinant(matrix));
+    // 主元为 0 时需要交换行
+    EXPECT_EQ(BigFraction(-1), AntonaStandard::Math::determinant(FractionMatrix{{0, 1}, {1, 0}}));
+    EXPECT_EQ(BigFraction(-6), AntonaStandard::Math::determinant(FractionMatrix{{0, 0, 1}, {0, 2, 0}, {3, 0, 0}}));
+    EXPECT_EQ(BigFraction(0), AntonaStandard::Math::determinant(FractionMatrix{{1, 2}, {2, 4}}));
+    EXPECT_EQ(BigFraction(1), AntonaStandard::Math::determinant(FractionMatrix()));
+    EXPECT_THROW(AntonaStandard::Math::determinant(FractionMatrix(2, 3)), AntonaStandard::Globals::WrongArgument_Error);
+
+    // Hilbert 矩阵的行列式为 1/6048000（4 阶）和 1/266716800000（5 阶）
+    EXPECT_EQ(BigFraction(1, 6048000), AntonaStandard::Math::determinant(hilbert(4)));
+    EXPECT_EQ(BigFraction(BigInteger(1), BigInteger("266716800000")), AntonaStandard::Math::determinant(hilbert(5)));
+}
+
+TEST(Test_LinearAlgebra, DeterminantMultiplicative){
+    BigFractionMatrix lhs = randomMatrix(12, 1);
+    BigFractionMatrix rhs = randomMatrix(12, 2);
+    EXPECT_EQ(AntonaStandard::Math::determinant(lhs) * AntonaStandard::Math::determinant(rhs),
+        AntonaStandard::Math::determinant(lhs * rhs));
+}
+
+TEST(Test_LinearAlgebra, Solve){
+    FractionMatrix matrix{{2, 1}, {1, 3}};
+    std::vector<BigFraction> x = AntonaStandard::Math::solve(matrix, std::vector<Fraction>{3, 5});
+    EXPECT_EQ((std::vector<BigFraction>{BigFraction(4, 5), BigFraction(7, 5)}), x);
+
+    EXPECT_THROW(AntonaStandard::Math::solve(FractionMatrix{{1, 2}, {2, 4}}, std::vector<Fraction>{1, 2}),
+        AntonaStandard::Globals::UnlawfulOperation_Error);
+    EXPECT_THROW(AntonaStandard::Math::solve(matrix, std::vector<Fraction>{1}), AntonaStandard::Globals::WrongArgument_Error);
+
+    // Hilbert 矩阵非常病态，精确求解仍然能还原出解
+    const std::size_t n = 10;
+    BigFractionMatrix h = hilbert(n);
+    std::vector<BigFraction> expected;
+    for(std::size_t i = 0; i < n; ++i){
+        expected.emplace_back(static_cast<int>(i) - 4, 3);
+    }
+    EXPECT_EQ(expected, AntonaStandard::Math::solve(h, h * expected));
+
+    BigFractionMatrix random = randomMatrix(24, 3);
+    std::vector<BigFraction> rhs(random.rows());
+    for(std::size_t i = 0; i < rhs.size(); ++i){
+        rhs[i] = BigFraction(static_cast<int>(i * i) - 50, static_cast<int>(i % 4 + 1));
+    }
+    EXPECT_EQ(rhs, random * AntonaStandard::Math::solve(random, rhs));
+}
+
+TEST(Test_LinearAlgebra, ThreadsPool){
+    AntonaStandard::ThreadTools::ThreadsPool pool(2, 4);
+    pool.lauch();
+    BigFractionMatrix matrix = randomMatrix(40, 4);
+    std::vector<BigFraction> rhs(matrix.rows(), BigFraction(1));
+    EXPECT_EQ(AntonaStandard::Math::determinant(matrix), AntonaStandard::Math::determinant(matrix, &pool));
+    std::vector<BigFraction> x = AntonaStandard::Math::solve(matrix, rhs, &pool);
+    EXPECT_EQ(AntonaStandard::Math::solve(matrix, rhs), x);
+    EXPECT_EQ(rhs, matrix * x);
+    pool.shutdown();
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <Math/BigFraction.h>
+#include <Math/Matrix.h>
+#include <random>
+#include <sstream>
+
+using AntonaStandard::Math::BigFraction;
+using AntonaStandard::Math::Fraction;
+using AntonaStandard::Math::Matrix;
+
+TEST(Test_Matrix, Constructor){
+    Matrix<Fraction> zero(2, 3);
+    EXPECT_EQ(2u, zero.rows());
+    EXPECT_EQ(3u, zero.columns());
+    EXPECT_FALSE(zero.isSquare());
+    EXPECT_EQ(Fraction(0), zero(1, 2));
+
+    Matrix<Fraction> matrix{{1, Fraction(1, 2)}, {Fraction(-1, 3), 4}};
+    EXPECT_EQ(Fraction(1, 2), matrix(0, 1));
+    EXPECT_EQ(Fraction(-1, 3), matrix.at(1, 0));
+    EXPECT_THROW(matrix.at(2, 0), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW((Matrix<Fraction>{{1, 2}, {3}}), AntonaStandard::Globals::WrongArgument_Error);
+
+    Matrix<BigFraction> converted(matrix);
+    EXPECT_EQ(BigFraction(-1, 3), converted(1, 0));
+    EXPECT_EQ((Matrix<Fraction>{{1, 0}, {0, 1}}), Matrix<Fraction>::identity(2));
+
+    matrix.swapRows(0, 1);
+    EXPECT_EQ((Matrix<Fraction>{{Fraction(-1, 3), 4}, {1, Fraction(1, 2)}}), matrix);
+    EXPECT_EQ((Matrix<Fraction>{{Fraction(-1, 3), 1}, {4, Fraction(1, 2)}}), matrix.transpose());
+
+    std::stringstream ss;
+    ss<<matrix;
+    EXPECT_EQ("-1/3 4/1\n1/1 1/2\n", ss.str());
+}
+
+TEST(Test_Matrix, Arithmetic){
+    Matrix<Fraction> lhs{{1, 2}, {3, 4}};
+    Matrix<Fraction> rhs{{Fraction(1, 2), 0}, {0, Fraction(1, 4)}};
+    EXPECT_EQ((Matrix<Fraction>{{Fraction(3, 2), 2}, {3, Fraction(17, 4)}}), lhs + rhs);
+    EXPECT_EQ((Matrix<Fraction>{{Fraction(1, 2), 2}, {3, Fraction(15, 4)}}), lhs - rhs);
+    EXPECT_EQ((Matrix<Fraction>{{Fraction(1, 2), Fraction(1, 2)}, {Fraction(3, 2), 1}}), lhs * rhs);
+    EXPECT_EQ((Matrix<Fraction>{{2, 4}, {6, 8}}), lhs * Fraction(2));
+    EXPECT_EQ((std::vector<Fraction>{Fraction(5), Fraction(11)}), (lhs * std::vector<Fraction>{1, 2}));
+    EXPECT_EQ(lhs, lhs * Matrix<Fraction>::identity(2));
+
+    EXPECT_THROW(lhs + Matrix<Fraction>(2, 3), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(lhs * Matrix<Fraction>(3, 2), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(lhs * std::vector<Fraction>(3), AntonaStandard::Globals::WrongArgument_Error);
+}
+
+TEST(Test_Matrix, BlockedMultiply){
+    // 尺寸不是分块边长的整数倍，结果与朴素的三重循环相同
+    std::mt19937 engine(5);
+    std::uniform_int_distribution<int> dist(-9, 9);
+    const std::size_t n = 37, m = 45, p = 70;
+    Matrix<BigFraction> lhs(n, m);
+    Matrix<BigFraction> rhs(m, p);
+    for(std::size_t i = 0; i < n; ++i){
+        for(std::size_t k = 0; k < m; ++k){
+            lhs(i, k) = BigFraction(dist(engine), 1 + (i + k) % 5);
+        }
+    }
+    for(std::size_t k = 0; k < m; ++k){
+        for(std::size_t j = 0; j < p; ++j){
+            rhs(k, j) = BigFraction(dist(engine), 1 + (k * j) % 7);
+        }
+    }
+    Matrix<BigFraction> result = lhs * rhs;
+    ASSERT_EQ(n, result.rows());
+    ASSERT_EQ(p, result.columns());
+    for(std::size_t i = 0; i < n; ++i){
+        for(std::size_t j = 0; j < p; ++j){
+            BigFraction expected;
+            for(std::size_t k = 0; k < m; ++k){
+                expected += lhs(i, k) * rhs(k, j);
+            }
+            EXPECT_EQ(expected, result(i, j))<<i<<","<<j;
+        }
+    }
+}
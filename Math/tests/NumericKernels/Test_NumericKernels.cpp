@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <Math/NumericKernels.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using AntonaStandard::Math::NumericKernels;
+using AntonaStandard::Math::SimdLevel;
+
+namespace{
+    std::vector<double> randomVector(std::size_t size,unsigned seed){
+        std::mt19937 engine(seed);
+        std::uniform_real_distribution<double> dist(-1.0,1.0);
+        std::vector<double> result(size);
+        for(auto& value:result){
+            value = dist(engine);
+        }
+        return result;
+    }
+
+    // 对每种支持的指令集执行一次 func
+    template<typename type_FUNC>
+    void forEachSimdLevel(type_FUNC&& func){
+        SimdLevel origin = NumericKernels::simdLevel();
+        for(SimdLevel level:{SimdLevel::Scalar,SimdLevel::SSE2,SimdLevel::AVX2,SimdLevel::AVX512}){
+            if(NumericKernels::setSimdLevel(level) != level){
+                continue;
+            }
+            func(level);
+        }
+        NumericKernels::setSimdLevel(origin);
+    }
+
+    // 朴素的三重循环，作为对照
+    void naiveGemm(std::size_t m,std::size_t n,std::size_t k,double alpha,const double* a,const double* b,double beta,double* c){
+        for(std::size_t i = 0; i < m; ++i){
+            for(std::size_t j = 0; j < n; ++j){
+                double value = 0;
+                for(std::size_t p = 0; p < k; ++p){
+                    value += a[i * k + p] * b[p * n + j];
+                }
+                c[i * n + j] = alpha * value + beta * c[i * n + j];
+            }
+        }
+    }
+}
+
+TEST(Test_NumericKernels, SimdLevel){
+    SimdLevel origin = NumericKernels::simdLevel();
+    EXPECT_EQ(SimdLevel::Scalar, NumericKernels::setSimdLevel(SimdLevel::Scalar));
+    EXPECT_EQ(SimdLevel::Scalar, NumericKernels::simdLevel());
+    EXPECT_EQ(NumericKernels::supportedSimdLevel(), NumericKernels::setSimdLevel(SimdLevel::AVX512));
+    NumericKernels::setSimdLevel(origin);
+}
+
+TEST(Test_NumericKernels, Level1){
+    // 长度覆盖各种尾部情况
+    for(std::size_t n:{0u, 1u, 3u, 7u, 8u, 17u, 33u, 1000u}){
+        std::vector<double> x = randomVector(n, 1);
+        std::vector<double> y = randomVector(n, 2);
+        double dot = 0, sum = 0, max_abs = 0;
+        for(std::size_t i = 0; i < n; ++i){
+            dot += x[i] * y[i];
+            sum += x[i];
+            max_abs = std::max(max_abs, std::fabs(x[i]));
+        }
+        forEachSimdLevel([&](SimdLevel level){
+            EXPECT_NEAR(dot, NumericKernels::dot(x.data(), y.data(), n), 1e-12)<<static_cast<int>(level)<<" n="<<n;
+            EXPECT_NEAR(sum, NumericKernels::sum(x.data(), n), 1e-12)<<static_cast<int>(level)<<" n="<<n;
+            EXPECT_EQ(max_abs, NumericKernels::maxAbs(x.data(), n))<<static_cast<int>(level)<<" n="<<n;
+            EXPECT_NEAR(std::sqrt(NumericKernels::dot(x.data(), x.data(), n)), NumericKernels::norm2(x.data(), n), 1e-12);
+
+            std::vector<double> result = y;
+            NumericKernels::axpy(0.5, x.data(), result.data(), n);
+            for(std::size_t i = 0; i < n; ++i){
+                EXPECT_NEAR(y[i] + 0.5 * x[i], result[i], 1e-15)<<static_cast<int>(level)<<" i="<<i;
+            }
+        });
+    }
+}
+
+TEST(Test_NumericKernels, Gemv){
+    const std::size_t rows = 13, columns = 37, lda = 40;
+    std::vector<double> a = randomVector(rows * lda, 3);
+    std::vector<double> x = randomVector(columns, 4);
+    std::vector<double> y = randomVector(rows, 5);
+    std::vector<double> expected(rows);
+    for(std::size_t i = 0; i < rows; ++i){
+        double value = 0;
+        for(std::size_t j = 0; j < columns; ++j){
+            value += a[i * lda + j] * x[j];
+        }
+        expected[i] = 2.0 * value - y[i];
+    }
+    forEachSimdLevel([&](SimdLevel level){
+        std::vector<double> result = y;
+        NumericKernels::gemv(rows, columns, 2.0, a.data(), lda, x.data(), -1.0, result.data());
+        for(std::size_t i = 0; i < rows; ++i){
+            EXPECT_NEAR(expected[i], result[i], 1e-12)<<static_cast<int>(level)<<" i="<<i;
+        }
+    });
+}
+
+TEST(Test_NumericKernels, Gemm){
+    // 尺寸跨过分块边界，且不是寄存器分块的整数倍
+    struct Shape{
+        std::size_t m, n, k;
+    };
+    for(Shape shape:{Shape{1, 1, 1}, Shape{7, 5, 3}, Shape{100, 33, 270}, Shape{97, 130, 19}}){
+        std::vector<double> a = randomVector(shape.m * shape.k, 6);
+        std::vector<double> b = randomVector(shape.k * shape.n, 7);
+        std::vector<double> c = randomVector(shape.m * shape.n, 8);
+        std::vector<double> expected = c;
+        naiveGemm(shape.m, shape.n, shape.k, 1.5, a.data(), b.data(), 0.5, expected.data());
+        forEachSimdLevel([&](SimdLevel level){
+            std::vector<double> result = c;
+            NumericKernels::gemm(shape.m, shape.n, shape.k, 1.5, a.data(), shape.k, b.data(), shape.n, 0.5, result.data(), shape.n);
+            for(std::size_t i = 0; i < result.size(); ++i){
+                ASSERT_NEAR(expected[i], result[i], 1e-10)<<static_cast<int>(level)<<" m="<<shape.m<<" i="<<i;
+            }
+        });
+    }
+
+    // beta 为 0 时不读取 C 原来的值
+    std::vector<double> a{1, 2, 3, 4};
+    std::vector<double> c(4, std::nan(""));
+    NumericKernels::gemm(2, 2, 2, 1.0, a.data(), 2, a.data(), 2, 0.0, c.data(), 2);
+    EXPECT_EQ((std::vector<double>{7, 10, 15, 22}), c);
+}
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <CPS/Socket.h>
+#include <Network/ConnectionPool.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 向环回地址上的回声服务器发送大量短请求，比较每个请求新建连接和使用连接池的耗时
+
+const int requests = 5000;
+
+unsigned short local_port(Network::Socket& sock){
+    return CPS::SocketLibraryManager::manager().getLocalAddress(sock.getManager()->getSocketFd()).getPort();
+}
+
+// 依次处理每个连接，把收到的数据原样发回，直到对端关闭连接
+void serve(Network::TCPListenSocket& listener){
+    while(true){
+        optional<Network::TCPSocket> server;
+        try{
+            server.emplace(listener.accept());
+        }
+        catch(exception&){
+            // 监听套接字被关闭
+            return;
+        }
+        Network::SocketChannel channel = server->getChannel();
+        while(channel.read() != 0){
+            auto& in = channel.getInBuffer();
+            channel.getOutBuffer().append(in.readingPos(),in.getReadableSize());
+            in.clear();
+            channel.write();
+        }
+        server->close();
+    }
+}
+
+// 发送一个请求并等待完整的回声
+void round_trip(Network::SocketChannel channel,const string& message){
+    channel.getOutBuffer().append(message.data(),message.size());
+    channel.write();
+    auto& in = channel.getInBuffer();
+    while(in.getReadableSize() < message.size() && channel.read() != 0){}
+    in.clear();
+}
+
+template<typename type_FUNC>
+double measure(type_FUNC&& func){
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double,milli>(end - start).count();
+}
+
+int main(){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    CPS::SocketAddress address = CPS::SocketAddress::loopBackAddress(local_port(listener));
+    thread server([&](){ serve(listener); });
+    string message = "GET /status";
+
+    // 每个请求新建连接：每次都要握手，主动关闭的一端留下 TIME_WAIT 状态的端口
+    double fresh = measure([&](){
+        for(int i = 0; i < requests; ++i){
+            Network::TCPSocket client(address);
+            client.launch();
+            round_trip(client.getChannel(),message);
+            client.close();
+        }
+    });
+
+    double pooled = 0;
+    {
+        Network::ConnectionPool pool;
+        pooled = measure([&](){
+            for(int i = 0; i < requests; ++i){
+                auto connection = pool.acquire(address);
+                round_trip(connection.getChannel(),message);
+            }
+        });
+        cout<<"connections created by the pool: "<<pool.getCreatedCount()<<", reused: "<<pool.getReusedCount()<<endl;
+    }
+
+    listener.getManager()->shutdown(CPS::ShutdownOptions::Read);
+    server.join();
+    cout<<requests<<" requests, new connection each time: "<<fresh<<" ms, connection pool: "<<pooled<<" ms"<<endl;
+    return 0;
+}
@@ -0,0 +1,91 @@
+#include <chrono>
+#include <iostream>
+#include <istream>
+#include <string>
+#include <thread>
+#include <CPS/Socket.h>
+#include <Network/FrameCodec.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 通过环回地址发送大量文本行，比较用 std::istream 提取和用 FrameReader 分帧的耗时
+
+const int lines = 1000000;
+
+unsigned short local_port(Network::Socket& sock){
+    return CPS::SocketLibraryManager::manager().getLocalAddress(sock.getManager()->getSocketFd()).getPort();
+}
+
+// 发送 lines 行文本后关闭连接
+void send_lines(Network::TCPSocket& server){
+    Network::SocketChannel channel = server.getChannel();
+    Network::LineCodec codec(true);
+    string line = "GET /index.html HTTP/1.1 with some headers";
+    for(int i = 0; i < lines; ++i){
+        codec.encode(channel.getOutBuffer(),line);
+        if(channel.getOutBuffer().getSendableSize() > (64 << 10)){
+            channel.write();
+        }
+    }
+    channel.write();
+    server.close();
+}
+
+// 返回耗时（毫秒）和读到的总长度
+template<typename type_FUNC>
+pair<double,size_t> run(type_FUNC&& parse){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(local_port(listener)));
+    client.launch();
+    Network::TCPSocket server = listener.accept();
+
+    auto start = chrono::steady_clock::now();
+    thread writer([&](){ send_lines(server); });
+    size_t total = parse(client.getChannel());
+    writer.join();
+    auto end = chrono::steady_clock::now();
+    return {chrono::duration<double,milli>(end - start).count(),total};
+}
+
+int main(){
+    // 常见的写法：每次读取之后用 std::istream 提取完整的行，不完整的行拷贝出来拼到下一次读取的数据前面
+    auto by_istream = run([](Network::SocketChannel channel){
+        size_t total = 0;
+        string carry,line;
+        while(true){
+            CPS::SocketDataBuffer& buffer = channel.getInBuffer();
+            buffer.clear();
+            buffer.append(carry.data(),carry.size());
+            buffer.ensureReceivableSize(64 << 10);
+            if(channel.read() == 0){
+                break;
+            }
+            istream in(&buffer);
+            carry.clear();
+            while(getline(in,line)){
+                if(in.eof()){
+                    carry = line;
+                    break;
+                }
+                total += line.size() - 1;       // 去掉 \r
+            }
+        }
+        return total;
+    });
+
+    auto by_reader = run([](Network::SocketChannel channel){
+        size_t total = 0;
+        Network::LineCodec codec;
+        Network::FrameReader reader(channel,codec);
+        string_view line;
+        while(reader.next(line)){
+            total += line.size();
+        }
+        return total;
+    });
+    cout<<lines<<" lines"<<endl;
+    cout<<"std::istream: "<<by_istream.first<<" ms, "<<by_istream.second<<" bytes"<<endl;
+    cout<<"FrameReader:  "<<by_reader.first<<" ms, "<<by_reader.second<<" bytes"<<endl;
+    return 0;
+}
@@ -0,0 +1,44 @@
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <Network/TCPListenerGroup.h>
+using namespace std;
+using namespace AntonaStandard;
+
+int main(){
+    // 每个核心一个监听套接字，绑定同一个端口
+    Network::TCPListenerGroup group(CPS::SocketAddress::loopBackAddress(0));
+    atomic<size_t> handled{0};
+    group.launch([&handled](Network::TCPSocket connection){
+        // 回应一行数据后连接随 connection 析构而关闭
+        Network::SocketChannel channel = connection.getChannel();
+        ostream outs(&channel.getOutBuffer());
+        outs<<"Server: hello"<<endl;
+        channel.write();
+        handled.fetch_add(1);
+    });
+    cout<<"listening on "<<group.getAddress().getIP()<<":"<<group.getAddress().getPort()
+        <<" with "<<group.size()<<" listeners"<<endl;
+
+    // 模拟连接风暴
+    const size_t connections = 1000;
+    auto start = chrono::steady_clock::now();
+    for(size_t i = 0; i < connections; ++i){
+        Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(group.getAddress().getPort()));
+        client.launch();
+        client.getChannel().read();
+        client.close();
+    }
+    while(handled.load() < connections){
+        this_thread::yield();
+    }
+    auto end = chrono::steady_clock::now();
+    cout<<connections<<" connections in "<<chrono::duration<double,milli>(end - start).count()<<" ms"<<endl;
+    for(size_t i = 0; i < group.size(); ++i){
+        cout<<"listener "<<i<<" accepted "<<group.getAcceptedCount(i)<<endl;
+    }
+    group.stop();
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <CPS/Socket.h>
+#include <Network/Socket.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 通过环回地址发送一个临时文件，比较 read + write 和 sendFile 的吞吐量（仅 Linux）
+
+const size_t file_size = 256 << 20;
+const size_t buffer_size = 64 << 10;
+
+// 读取并丢弃 size 个字节
+void drain(Network::SocketChannel channel,size_t size){
+    size_t received = 0;
+    while(received < size){
+        channel.getInBuffer().clear();
+        channel.getInBuffer().ensureReceivableSize(buffer_size);
+        size_t n = channel.read();
+        if(n == 0){
+            throw runtime_error("connection closed");
+        }
+        received += n;
+    }
+}
+
+// 经过用户态缓冲区：pread 读入文件，再写到套接字
+void copy_through_buffer(Network::SocketChannel channel,int fd){
+    string buffer(buffer_size,'\0');
+    size_t offset = 0;
+    while(offset < file_size){
+        ssize_t n = ::pread(fd,&buffer[0],buffer.size(),offset);
+        if(n <= 0){
+            throw runtime_error("read file failed");
+        }
+        channel.getOutBuffer().clear();
+        channel.getOutBuffer().append(buffer.data(),n);
+        size_t sent = channel.write();
+        if(sent != static_cast<size_t>(n)){
+            throw runtime_error("partial write");
+        }
+        offset += n;
+    }
+}
+
+// 返回吞吐量（MiB/s）
+template<typename type_FUNC>
+double run(type_FUNC&& send){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    unsigned short port = CPS::SocketLibraryManager::manager().getLocalAddress(listener.getManager()->getSocketFd()).getPort();
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(port));
+    client.launch();
+    Network::TCPSocket server = listener.accept();
+
+    auto start = chrono::steady_clock::now();
+    thread reader([&](){ drain(server.getChannel(),file_size); });
+    send(client.getChannel());
+    reader.join();
+    auto end = chrono::steady_clock::now();
+    return file_size / 1048576.0 / chrono::duration<double>(end - start).count();
+}
+
+int main(){
+#ifdef AntonaStandard_PLATFORM_LINUX
+    FILE* file = tmpfile();
+    string block(buffer_size,'a');
+    for(size_t written = 0; written < file_size; written += block.size()){
+        fwrite(block.data(),1,block.size(),file);
+    }
+    fflush(file);
+    int fd = fileno(file);
+
+    double buffered = run([&](Network::SocketChannel channel){ copy_through_buffer(channel,fd); });
+    size_t reports = 0;
+    double zero_copy = run([&](Network::SocketChannel channel){
+        channel.sendFile(fd,0,file_size,[&](size_t,size_t){ ++reports; });
+    });
+    cout<<"file size: "<<(file_size >> 20)<<" MiB"<<endl;
+    cout<<"read + write: "<<buffered<<" MiB/s"<<endl;
+    cout<<"sendFile:     "<<zero_copy<<" MiB/s ("<<reports<<" progress reports)"<<endl;
+    fclose(file);
+#else
+    cout<<"sendFile is only supported on Linux"<<endl;
+#endif
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <CPS/Socket.h>
+#include <Network/Socket.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 环回地址上的延迟测试，展示各个套接字选项的影响（仅 Linux）
+
+using Tuner = function<void(Network::TCPSocket&)>;
+
+// 一个场景：客户端把一次请求分成头部和正文两次写出，等待服务端的应答
+struct Scenario{
+    string name;
+    size_t header_size;
+    size_t body_size;
+    size_t response_size;
+    int rounds;
+    Tuner client_tuner;
+    Tuner server_tuner;
+    bool write_more = false;        // 头部是否以 MSG_MORE 写出
+    bool quick_ack = false;         // 服务端每次读取之后是否重新开启 TCP_QUICKACK
+    bool cork = false;              // 客户端是否在写出头部之前开启 TCP_CORK，写出正文之后取消
+};
+
+// 读取恰好 size 个字节
+void read_exactly(Network::TCPSocket& sock,Network::SocketChannel& channel,size_t size,bool quick_ack){
+    channel.getInBuffer().clear();
+    while(channel.getInBuffer().getSendableSize() < size){
+        channel.getInBuffer().ensureReceivableSize(size - channel.getInBuffer().getSendableSize());
+        if(channel.read() == 0){
+            throw runtime_error("connection closed");
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        if(quick_ack){
+            sock.setQuickAck(true);
+        }
+    #endif
+    }
+}
+
+void write_bytes(Network::SocketChannel& channel,size_t size,bool more){
+    channel.getOutBuffer().clear();
+    string data(size,'x');
+    channel.getOutBuffer().append(data.data(),data.size());
+#ifdef AntonaStandard_PLATFORM_LINUX
+    if(more){
+        channel.writeMore();
+        return;
+    }
+#endif
+    channel.write();
+}
+
+// 返回每轮请求应答的平均耗时（微秒）
+double run(const Scenario& scenario){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    unsigned short port = CPS::SocketLibraryManager::manager().getLocalAddress(listener.getManager()->getSocketFd()).getPort();
+
+    thread server([&](){
+        Network::TCPSocket sock = listener.accept();
+        if(scenario.server_tuner){
+            scenario.server_tuner(sock);
+        }
+        Network::SocketChannel channel = sock.getChannel();
+        for(int i = 0; i < scenario.rounds; ++i){
+            read_exactly(sock,channel,scenario.header_size + scenario.body_size,scenario.quick_ack);
+            write_bytes(channel,scenario.response_size,false);
+        }
+    });
+
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(port));
+    if(scenario.client_tuner){
+        scenario.client_tuner(client);
+    }
+    client.launch();
+    Network::SocketChannel channel = client.getChannel();
+    auto start = chrono::steady_clock::now();
+    for(int i = 0; i < scenario.rounds; ++i){
+        if(scenario.body_size > 0){
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            if(scenario.cork){
+                client.setCork(true);
+            }
+        #endif
+            write_bytes(channel,scenario.header_size,scenario.write_more);
+            write_bytes(channel,scenario.body_size,false);
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            if(scenario.cork){
+                // 取消时立即发出积攒的数据
+                client.setCork(false);
+            }
+        #endif
+        }
+        else{
+            write_bytes(channel,scenario.header_size,false);
+        }
+        read_exactly(client,channel,scenario.response_size,false);
+    }
+    auto end = chrono::steady_clock::now();
+    server.join();
+    client.close();
+    listener.close();
+    return chrono::duration<double,micro>(end - start).count() / scenario.rounds;
+}
+
+// 单向传输 total 字节，返回吞吐量（MiB/s）
+double throughput(int buffer_size,size_t total){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    if(buffer_size > 0){
+        // 接收缓冲区需要在监听套接字上设置，接受的连接会继承，窗口大小在握手时确定
+        listener.setReceiveBufferSize(buffer_size);
+    }
+    listener.launch();
+    unsigned short port = CPS::SocketLibraryManager::manager().getLocalAddress(listener.getManager()->getSocketFd()).getPort();
+    thread server([&](){
+        Network::TCPSocket sock = listener.accept();
+        Network::SocketChannel channel = sock.getChannel();
+        size_t received = 0;
+        while(received < total){
+            channel.getInBuffer().clear();
+            channel.getInBuffer().ensureReceivableSize(256 * 1024);
+            size_t size = channel.read();
+            if(size == 0){
+                break;
+            }
+            received += size;
+        }
+    });
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(port));
+    if(buffer_size > 0){
+        client.setSendBufferSize(buffer_size);
+    }
+    client.launch();
+    Network::SocketChannel channel = client.getChannel();
+    string chunk(256 * 1024,'x');
+    auto start = chrono::steady_clock::now();
+    for(size_t sent = 0; sent < total;){
+        channel.getOutBuffer().clear();
+        size_t size = min(chunk.size(),total - sent);
+        channel.getOutBuffer().append(chunk.data(),size);
+        // write 会清空写缓冲区，未发出的部分需要重新写入
+        sent += channel.write();
+    }
+    server.join();
+    auto end = chrono::steady_clock::now();
+    client.close();
+    listener.close();
+    return total / 1048576.0 / chrono::duration<double>(end - start).count();
+}
+
+int main(){
+#ifdef AntonaStandard_PLATFORM_LINUX
+    auto no_delay = [](Network::TCPSocket& sock){ sock.setNoDelay(true); };
+    auto busy_poll = [](Network::TCPSocket& sock){
+        try{
+            sock.setBusyPoll(50);
+        }
+        catch(std::exception& e){
+            cout<<"  (SO_BUSY_POLL not permitted: "<<e.what()<<")"<<endl;
+        }
+    };
+
+    cout<<"== small ping-pong, 1 byte each way (us per round trip) =="<<endl;
+    cout<<"default          : "<<run({"default",1,0,1,5000,nullptr,nullptr})<<endl;
+    cout<<"TCP_NODELAY      : "<<run({"nodelay",1,0,1,5000,no_delay,no_delay})<<endl;
+    cout<<"SO_BUSY_POLL 50us: "<<run({"busy poll",1,0,1,5000,busy_poll,busy_poll})<<endl;
+
+    // 头部和正文分两次写出时，Nagle 算法等待头部的确认，而服务端收到完整请求之前会延迟确认，每轮多出约 40ms
+    cout<<"== request written as 16 byte header + 200 byte body (us per request) =="<<endl;
+    cout<<"default (Nagle + delayed ACK): "<<run({"default",16,200,16,20,nullptr,nullptr})<<endl;
+    cout<<"TCP_QUICKACK on server       : "<<run({"quickack",16,200,16,20,nullptr,nullptr,false,true})<<endl;
+    cout<<"TCP_NODELAY                  : "<<run({"nodelay",16,200,16,2000,no_delay,nullptr})<<endl;
+    cout<<"MSG_MORE on header           : "<<run({"more",16,200,16,2000,nullptr,nullptr,true})<<endl;
+    cout<<"TCP_CORK around the request  : "<<run({"cork",16,200,16,2000,nullptr,nullptr,false,false,true})<<endl;
+
+    cout<<"== bulk transfer of 256 MiB (MiB/s) =="<<endl;
+    cout<<"SO_SNDBUF/SO_RCVBUF 16 KiB : "<<throughput(16 * 1024,256u << 20)<<endl;
+    cout<<"default (autotuning)       : "<<throughput(0,256u << 20)<<endl;
+    cout<<"SO_SNDBUF/SO_RCVBUF 4 MiB  : "<<throughput(4 << 20,256u << 20)<<endl;
+
+    // TCP Fast Open 和 SO_INCOMING_CPU 的效果依赖系统配置和多队列网卡，这里只展示设置方式
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.setFastOpen(64);
+    listener.setIncomingCpu(0);
+    listener.launch();
+    ifstream fastopen("/proc/sys/net/ipv4/tcp_fastopen");
+    int fastopen_mode = 0;
+    fastopen>>fastopen_mode;
+    cout<<"TCP_FASTOPEN queue: "<<listener.getFastOpen()<<", net.ipv4.tcp_fastopen = "<<fastopen_mode
+        <<((fastopen_mode & 2) ? "" : " (server side disabled, set bit 2 to accept data in SYN)")<<endl;
+    cout<<"SO_INCOMING_CPU: "<<listener.getIncomingCpu()<<endl;
+    listener.close();
+#else
+    cout<<"This benchmark needs Linux socket options"<<endl;
+#endif
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Network/FrameCodec.h>
+#include <Network/TCPServer.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 多 Reactor 服务端：每行请求在事件循环中分帧，计算交给线程池，结果投递回连接所属的事件循环发送。
+// 多个客户端线程各自保持一个连接，依次发送请求并等待应答
+
+const int clients = 16;
+const int requests = 2000;
+
+// 模拟耗时的计算
+string compute(const string& request){
+    size_t value = hash<string>()(request);
+    for(int i = 0; i < 2000; ++i){
+        value = value * 6364136223846793005ULL + 1442695040888963407ULL;
+    }
+    return to_string(value);
+}
+
+double run(ThreadTools::ThreadsPool& pool,size_t loops,bool offload){
+    Network::TCPServerOptions options;
+    options.loops = loops;
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(0),options);
+    server.setMessageHandler([&](const Network::TCPConnectionPtr& connection,CPS::SocketDataBuffer& buffer){
+        Network::LineCodec codec;
+        string_view frame;
+        size_t consumed = 0;
+        while(codec.decode(buffer.readingPos(),buffer.getReadableSize(),frame,consumed)){
+            string request(frame);
+            buffer.moveGetPos(consumed);
+            if(!offload){
+                connection->send(compute(request) + "\n");
+                continue;
+            }
+            connection->offload(pool,[request](){
+                return compute(request);
+            },[](const Network::TCPConnectionPtr& connection,string result){
+                if(connection->isConnected()){
+                    connection->send(result + "\n");
+                }
+            });
+        }
+    });
+    server.launch();
+
+    auto start = chrono::steady_clock::now();
+    vector<thread> threads;
+    for(int c = 0; c < clients; ++c){
+        threads.emplace_back([&,c](){
+            Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(server.getAddress().getPort()));
+            client.launch();
+            Network::LineCodec codec;
+            Network::FrameReader reader(client.getChannel(),codec);
+            Network::SocketChannel channel = client.getChannel();
+            string_view reply;
+            for(int i = 0; i < requests; ++i){
+                codec.encode(channel.getOutBuffer(),"client " + to_string(c) + " request " + to_string(i));
+                channel.write();
+                if(!reader.next(reply)){
+                    return;
+                }
+            }
+            client.close();
+        });
+    }
+    for(auto& t:threads){
+        t.join();
+    }
+    auto end = chrono::steady_clock::now();
+    server.stop();
+    return clients * requests / chrono::duration<double>(end - start).count();
+}
+
+int main(){
+    size_t loops = max(2u,thread::hardware_concurrency());
+    ThreadTools::ThreadsPool pool(2,4);
+    pool.lauch();
+    cout<<clients<<" clients x "<<requests<<" requests"<<endl;
+    cout<<"1 loop, compute in loop:        "<<run(pool,1,false)<<" requests/s"<<endl;
+    cout<<loops<<" loops, compute in loop:       "<<run(pool,loops,false)<<" requests/s"<<endl;
+    cout<<loops<<" loops, compute in ThreadsPool: "<<run(pool,loops,true)<<" requests/s"<<endl;
+    pool.shutdown();
+    return 0;
+}
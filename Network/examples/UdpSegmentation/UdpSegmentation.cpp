@@ -0,0 +1,85 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <CPS/Socket.h>
+#include <Network/Socket.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 在环回地址上比较逐个发送数据报和 UDP 分段卸载（GSO）批量发送的耗时，
+// 以及接收端开启 GRO 之后每次读取合并的数据报个数（仅 Linux）
+
+const size_t datagram_size = 1200;
+const size_t datagrams_per_batch = 40;
+const int batches = 2000;
+
+unsigned short local_port(Network::Socket& sock){
+    return CPS::SocketLibraryManager::manager().getLocalAddress(sock.getManager()->getSocketFd()).getPort();
+}
+
+struct Result{
+    double send_ms;
+    size_t reads;
+    size_t received;
+};
+
+Result run(bool segmented,bool gro){
+    Network::UDPSocket receiver(CPS::SocketAddress::loopBackAddress(0));
+    Network::UDPSocket sender(CPS::SocketAddress::loopBackAddress(0));
+    receiver.setReceiveBufferSize(32 << 20);
+    if(gro){
+        receiver.setUdpGro(true);
+    }
+    receiver.launch();
+    sender.launch();
+    Network::SocketChannel sending = sender.getChannel();
+    sending.setAddress(CPS::SocketAddress::loopBackAddress(local_port(receiver)));
+    Network::SocketChannel receiving = receiver.getChannel();
+    string batch(datagram_size * datagrams_per_batch,'q');
+
+    Result result{0,0,0};
+    // 每批发送之后立即读完，避免接收缓冲区溢出丢包
+    for(int i = 0; i < batches; ++i){
+        auto start = chrono::steady_clock::now();
+        if(segmented){
+            sending.getOutBuffer().append(batch.data(),batch.size());
+            sending.writeSegments(datagram_size);
+        }
+        else{
+            for(size_t j = 0; j < datagrams_per_batch; ++j){
+                sending.getOutBuffer().append(batch.data(),datagram_size);
+                sending.write();
+            }
+        }
+        result.send_ms += chrono::duration<double,milli>(chrono::steady_clock::now() - start).count();
+
+        size_t batch_received = 0;
+        while(batch_received < batch.size()){
+            size_t segment_size = 0;
+            receiving.getInBuffer().clear();
+            receiving.getInBuffer().ensureReceivableSize(64 << 10);
+            batch_received += receiving.readSegments(segment_size);
+            ++result.reads;
+        }
+        result.received += batch_received;
+    }
+    return result;
+}
+
+int main(){
+#ifdef AntonaStandard_PLATFORM_LINUX
+    cout<<batches<<" batches of "<<datagrams_per_batch<<" datagrams, "<<datagram_size<<" bytes each"<<endl;
+    for(bool segmented:{false,true}){
+        for(bool gro:{false,true}){
+            Result result = run(segmented,gro);
+            cout<<(segmented ? "writeSegments" : "write        ")<<(gro ? " + GRO" : "      ")
+                <<"  send: "<<result.send_ms<<" ms, reads: "<<result.reads
+                <<" ("<<double(batches * datagrams_per_batch) / result.reads<<" datagrams per read)"<<endl;
+        }
+    }
+#else
+    cout<<"UDP segmentation offload is only supported on Linux"<<endl;
+#endif
+    return 0;
+}
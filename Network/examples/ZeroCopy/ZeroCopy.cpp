@@ -0,0 +1,81 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <CPS/Socket.h>
+#include <Network/Socket.h>
+using namespace std;
+using namespace AntonaStandard;
+
+// 比较普通发送和 MSG_ZEROCOPY 发送大块数据的吞吐量（仅 Linux）
+// 环回地址上内核总是退化为拷贝，零拷贝的收益需要在支持的网卡上测量
+
+const size_t block_size = 4 << 20;
+const int rounds = 64;
+
+// 读取并丢弃 size 个字节
+void drain(Network::SocketChannel channel,size_t size){
+    size_t received = 0;
+    while(received < size){
+        channel.getInBuffer().clear();
+        channel.getInBuffer().ensureReceivableSize(64 << 10);
+        size_t n = channel.read();
+        if(n == 0){
+            throw runtime_error("connection closed");
+        }
+        received += n;
+    }
+}
+
+// 返回吞吐量（MiB/s）
+template<typename type_FUNC>
+double run(type_FUNC&& send){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    unsigned short port = CPS::SocketLibraryManager::manager().getLocalAddress(listener.getManager()->getSocketFd()).getPort();
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(port));
+    client.launch();
+    Network::TCPSocket server = listener.accept();
+
+    auto start = chrono::steady_clock::now();
+    thread reader([&](){ drain(server.getChannel(),block_size * rounds); });
+    send(client.getChannel());
+    reader.join();
+    auto end = chrono::steady_clock::now();
+    return block_size * rounds / 1048576.0 / chrono::duration<double>(end - start).count();
+}
+
+int main(){
+#ifdef AntonaStandard_PLATFORM_LINUX
+    string block(block_size,'z');
+    double copied = run([&](Network::SocketChannel channel){
+        for(int i = 0; i < rounds; ++i){
+            channel.getOutBuffer().clear();
+            channel.getOutBuffer().append(block.data(),block.size());
+            channel.write();
+        }
+    });
+
+    size_t released = 0,fallbacks = 0;
+    double zero_copy = run([&](Network::SocketChannel channel){
+        for(int i = 0; i < rounds; ++i){
+            size_t sent = 0;
+            while(sent < block.size()){
+                sent += channel.sendZeroCopy(block.data() + sent,block.size() - sent,[&](bool copied){
+                    ++released;
+                    fallbacks += copied;
+                });
+            }
+        }
+        while(channel.getPendingZeroCopyCount() > 0){
+            channel.waitZeroCopy();
+        }
+    });
+    cout<<"send "<<rounds<<" blocks of "<<(block_size >> 20)<<" MiB"<<endl;
+    cout<<"write:        "<<copied<<" MiB/s"<<endl;
+    cout<<"sendZeroCopy: "<<zero_copy<<" MiB/s ("<<released<<" released, "<<fallbacks<<" copied by the kernel)"<<endl;
+#else
+    cout<<"sendZeroCopy is only supported on Linux"<<endl;
+#endif
+    return 0;
+}
@@ -0,0 +1,184 @@
+#ifndef NETWORK_CONNECTIONPOOL_H
+#define NETWORK_CONNECTIONPOOL_H
+
+/**
+ * @file ConnectionPool.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 客户端 TCP 连接池
+ * @details
+ *      请求应答式的通信如果每次都新建 TCPSocket，就要为每个请求付出一次握手（以及 TIME_WAIT 状态的端口占用）。
+ *      ConnectionPool 按远端地址缓存用完的连接，下次向同一地址发起请求时直接复用。
+ *
+ *      连接池分为若干个分片，地址按哈希值落到某个分片上，每个分片有独立的互斥锁，不同地址的借还互不竞争；
+ *      锁内只做链表和哈希表的操作，建立连接和探测连接都在锁外进行。
+ *      每个分片用一个 LRU 链表记录所有空闲连接，空闲连接超过上限时关闭最久没有使用的连接；
+ *      同一地址优先复用最近归还的连接。借出空闲连接之前会检查它是否已经被对端关闭或者空闲过久
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <Network/Socket.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace AntonaStandard::Network{
+    class ConnectionPool;
+
+    /**
+     * @brief 连接池的配置
+     */
+    struct ConnectionPoolOptions{
+        std::size_t max_per_host = 64;                      ///< 每个地址最多同时存在的连接数（借出的和空闲的）
+        std::size_t max_idle_per_host = 16;                 ///< 每个地址最多保留的空闲连接数
+        std::size_t max_idle = 1024;                        ///< 整个连接池最多保留的空闲连接数，平均分配到各个分片
+        std::size_t shards = 16;                            ///< 分片数，会向上取整为 2 的幂
+        std::chrono::milliseconds idle_timeout{60000};      ///< 空闲超过该时间的连接不再复用
+        std::chrono::milliseconds acquire_timeout{5000};    ///< 地址的连接数达到上限时等待归还的最长时间
+        /// @brief 新建连接在 launch 之前的回调，可以设置 NoDelay 等选项
+        std::function<void(TCPSocket&)> configure;
+    };
+
+    /**
+     * @brief 从连接池借出的连接
+     * @details
+     *      析构时自动归还连接池，归还时会清空通道的读写缓冲区。如果通信过程中出现了错误，或者连接上还有没有读完的应答，
+     *      应当调用 markBroken，连接会被关闭而不是复用。连接池必须比借出的连接活得更久
+     */
+    class PooledConnection{
+    private:
+        ConnectionPool* pool;
+        std::optional<TCPSocket> socket;
+        bool reused;
+        bool broken;
+    public:
+        PooledConnection(ConnectionPool* pool,TCPSocket socket,bool reused)
+            :pool(pool),socket(std::in_place,socket),reused(reused),broken(false){};
+        PooledConnection(const PooledConnection&) = delete;
+        PooledConnection& operator=(const PooledConnection&) = delete;
+        PooledConnection(PooledConnection&& other);
+        ~PooledConnection();
+
+        /// @brief 是否还持有连接，release 之后为 false
+        inline bool isValid()const{
+            return this->socket.has_value();
+        }
+        /// @brief 是否是复用的空闲连接，否则为新建的连接
+        inline bool isReused()const{
+            return this->reused;
+        }
+        /// @throw AntonaStandard::Globals::NullPointer_Error 连接已经归还
+        TCPSocket& getSocket();
+        inline SocketChannel getChannel(){
+            return this->getSocket().getChannel();
+        }
+        /// @brief 标记连接不可复用，归还时会被关闭
+        inline void markBroken(){
+            this->broken = true;
+        }
+        /// @brief 提前归还连接
+        void release();
+    };
+
+    /**
+     * @brief 按远端地址缓存 TCP 连接的连接池，线程安全
+     */
+    class ConnectionPool{
+        friend class PooledConnection;
+    private:
+        struct IdleConnection{
+            CPS::SocketAddress address;
+            TCPSocket socket;
+            std::chrono::steady_clock::time_point since;    ///< 归还的时间
+        };
+        using IdleList = std::list<IdleConnection>;
+        struct Host{
+            std::deque<IdleList::iterator> idle;            ///< 该地址的空闲连接，末尾是最近归还的
+            std::size_t leased = 0;                         ///< 借出的连接数
+        };
+        struct Shard{
+            std::mutex mtx;
+            std::condition_variable cv;                     ///< 通知等待连接数上限的线程
+            std::size_t waiters = 0;
+            IdleList lru;                                   ///< 分片内所有的空闲连接，开头是最近归还的
+            std::unordered_map<CPS::SocketAddress,Host> hosts;
+        };
+
+        ConnectionPoolOptions options;
+        std::unique_ptr<Shard[]> shards;
+        std::size_t shard_mask;
+        std::size_t max_idle_per_shard;
+        std::atomic<std::size_t> created{0};
+        std::atomic<std::size_t> reused{0};
+        std::atomic<std::size_t> discarded{0};
+
+        inline Shard& shard_of(const CPS::SocketAddress& addr){
+            return this->shards[addr.hash() & this->shard_mask];
+        }
+        /// @brief 空闲连接能否复用：没有超时，也没有被对端关闭或者残留未读的数据
+        bool is_reusable(TCPSocket& socket,std::chrono::steady_clock::time_point since);
+        /// @brief 关闭不再使用的连接，忽略关闭时的异常
+        void discard(TCPSocket& socket);
+        /// @brief 把空闲连接从分片中移出，调用方持有分片的锁
+        TCPSocket take_idle(Shard& shard,Host& host,IdleList::iterator it);
+        /// @brief 连接数和空闲连接都为 0 时删除地址的记录，调用方持有分片的锁
+        void erase_if_unused(Shard& shard,const CPS::SocketAddress& addr);
+        void give_back(TCPSocket socket,bool reusable);
+    public:
+        ConnectionPool(ConnectionPoolOptions options = ConnectionPoolOptions());
+        ConnectionPool(const ConnectionPool&) = delete;
+        ConnectionPool& operator=(const ConnectionPool&) = delete;
+        ~ConnectionPool();
+
+        /**
+         * @brief 借出一个连接到 addr 的连接
+         * @details
+         *      优先复用最近归还的空闲连接；没有可用的空闲连接时新建连接。
+         *      该地址的连接数达到 max_per_host 时最多等待 acquire_timeout
+         * @throw
+         *      std::runtime_error 建立连接失败，或者等待超时
+         */
+        PooledConnection acquire(const CPS::SocketAddress& addr);
+        /**
+         * @brief 关闭所有空闲超时或者已经失效的空闲连接，可以定期调用
+         * @return std::size_t 关闭的连接数
+         */
+        std::size_t prune();
+        /// @brief 关闭所有空闲连接
+        void clear();
+
+        /// @brief 到 addr 的空闲连接数
+        std::size_t getIdleCount(const CPS::SocketAddress& addr);
+        /// @brief 到 addr 的借出连接数
+        std::size_t getLeasedCount(const CPS::SocketAddress& addr);
+        /// @brief 整个连接池的空闲连接数
+        std::size_t getIdleCount();
+        /// @brief 新建的连接总数
+        inline std::size_t getCreatedCount()const{
+            return this->created.load(std::memory_order_relaxed);
+        }
+        /// @brief 复用空闲连接的次数
+        inline std::size_t getReusedCount()const{
+            return this->reused.load(std::memory_order_relaxed);
+        }
+        /// @brief 因为失效、超时或者超过空闲上限而关闭的连接总数
+        inline std::size_t getDiscardedCount()const{
+            return this->discarded.load(std::memory_order_relaxed);
+        }
+        inline const ConnectionPoolOptions& getOptions()const{
+            return this->options;
+        }
+    };
+}
+
+#endif
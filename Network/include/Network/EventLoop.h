@@ -0,0 +1,139 @@
+#ifndef NETWORK_EVENTLOOP_H
+#define NETWORK_EVENTLOOP_H
+
+/**
+ * @file EventLoop.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 基于 epoll 的单线程事件循环
+ * @details
+ *      一个 EventLoop 由一个线程调用 run 驱动，在该线程中等待并分发文件描述符上的就绪事件，以及执行其它线程投递的任务。
+ *      文件描述符的注册、修改和注销只能在循环线程中进行，因此不需要加锁；其它线程通过 post 把操作投递到循环线程。
+ *      投递任务时通过 eventfd 唤醒阻塞在 epoll_wait 上的循环线程。
+ *      定时器由 ThreadTools::TimerWheel 管理，epoll_wait 的超时时间就是最近的定时器到期时间，不需要额外的线程。
+ *
+ *      目前只在 Linux 平台上实现，其它平台上构造 EventLoop 会抛出异常
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <Network/Socket.h>
+#include <ThreadTools/TimerWheel.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace AntonaStandard::Network{
+    /**
+     * @brief 事件循环关注的事件，可以按位组合
+     */
+    enum IOEvents:std::uint32_t{
+        NoEvents = 0,
+        Readable = 1 << 0,      ///< 可读，或者对端关闭了写通道
+        Writable = 1 << 1,      ///< 可写
+        Hangup = 1 << 2,        ///< 连接出错或者被关闭，总是会被通知，不需要关注
+    };
+
+    /**
+     * @brief 单线程事件循环
+     * @details
+     *      事件为水平触发。回调和任务抛出的异常会被捕获并输出到 std::cerr，不会终止事件循环
+     */
+    class EventLoop{
+    public:
+        using Task = std::function<void()>;
+        /// @brief 文件描述符就绪时的回调，参数为发生的 IOEvents
+        using IOHandler = std::function<void(std::uint32_t)>;
+        using Clock = ThreadTools::TimerWheel::Clock;
+        using TimerId = ThreadTools::TimerWheel::TimerId;
+    private:
+        struct Watch{
+            std::uint32_t generation;       ///< 注册序号，过滤同一批事件中已经注销的文件描述符被复用后的旧事件
+            IOHandler handler;
+        };
+        int epoll_fd;
+        int wakeup_fd;
+        std::atomic<bool> quit;
+        std::atomic<std::thread::id> owner;             ///< 正在执行 run 的线程
+        std::unordered_map<int,std::shared_ptr<Watch>> watches;
+        std::uint32_t next_generation;
+        std::mutex mtx_tasks;
+        std::vector<Task> tasks;
+        std::vector<Task> running_tasks;                ///< 只在循环线程中使用，与 tasks 交换以减少加锁时间
+        ThreadTools::TimerWheel timers;                 ///< 只在循环线程中使用
+
+        /// @brief 距离最近的定时器到期的毫秒数，作为 epoll_wait 的超时时间
+        int get_wait_timeout()const;
+        void run_timers();
+
+        void wakeup();
+        void run_tasks();
+        void control(int operation,int fd,std::uint32_t events,std::uint32_t generation);
+    public:
+        /// @throw AntonaStandard::Globals::UnlawfulOperation_Error 当前平台不支持；std::runtime_error 创建 epoll 或 eventfd 失败
+        EventLoop();
+        EventLoop(const EventLoop&) = delete;
+        EventLoop& operator=(const EventLoop&) = delete;
+        ~EventLoop();
+
+        /**
+         * @brief 在当前线程中运行事件循环，直到调用 stop
+         * @details 退出之前会执行完已经投递的任务
+         * @throw AntonaStandard::Globals::UnlawfulOperation_Error 事件循环已经在其它线程中运行
+         */
+        void run();
+        /// @brief 请求事件循环退出，线程安全
+        void stop();
+        /// @brief 把任务投递到循环线程执行，线程安全
+        void post(Task task);
+        /// @brief 在循环线程中调用时立即执行任务，否则投递到循环线程
+        void dispatch(Task task);
+        /// @brief 当前线程是否是循环线程
+        inline bool isInLoopThread()const{
+            return this->owner.load(std::memory_order_acquire) == std::this_thread::get_id();
+        }
+
+        /**
+         * @brief 关注文件描述符上的事件，只能在循环线程中调用
+         * @param fd        文件描述符，同一时间只能注册一次
+         * @param events    关注的 IOEvents
+         * @param handler   就绪时在循环线程中调用
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 文件描述符已经注册
+         *      std::runtime_error epoll_ctl 失败
+         */
+        void watch(int fd,std::uint32_t events,IOHandler handler);
+        /// @brief 修改关注的事件，只能在循环线程中调用
+        void modify(int fd,std::uint32_t events);
+        /// @brief 取消关注，应当在关闭文件描述符之前调用，只能在循环线程中调用。可以在回调中注销自己
+        void unwatch(int fd);
+        /// @brief 注册的文件描述符个数，只能在循环线程中调用
+        inline std::size_t getWatchedCount()const{
+            return this->watches.size();
+        }
+
+        /**
+         * @brief 添加一个在 delay 之后于循环线程中执行的定时器，只能在循环线程中调用
+         * @details 定时器的精度为 1 毫秒，适合连接的空闲、读写超时
+         * @return TimerId 用于取消或者重新计时
+         */
+        TimerId runAfter(Clock::duration delay,Task task);
+        /// @brief 取消定时器，已经触发或者已经取消时返回 false，只能在循环线程中调用
+        bool cancelTimer(TimerId id);
+        /// @brief 把尚未触发的定时器推迟到 delay 之后，只能在循环线程中调用
+        bool restartTimer(TimerId id,Clock::duration delay);
+        /// @brief 尚未触发的定时器个数，只能在循环线程中调用
+        inline std::size_t getTimerCount()const{
+            return this->timers.size();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,208 @@
+#ifndef NETWORK_FRAMECODEC_H
+#define NETWORK_FRAMECODEC_H
+
+/**
+ * @file FrameCodec.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 消息分帧的编解码器
+ * @details
+ *      TCP 是字节流，一次 read 可能读到半个消息，也可能读到多个消息。本文件提供常用的分帧方式：
+ *      - LengthPrefixCodec 长度前缀，长度为变长整数（varint）或者定长的大端整数
+ *      - DelimiterCodec    分隔符结尾，LineCodec 是以 LF 或 CRLF 结尾的文本行
+ *      - FixedSizeCodec    定长记录
+ *
+ *      解码直接在读缓冲区上进行，得到的帧是指向读缓冲区的 std::string_view，不拷贝数据。
+ *      FrameReader 把编解码器和 SocketChannel 结合起来：读缓冲区中的完整帧依次取出，
+ *      剩下不完整的帧在下次读取之前移动到缓冲区开头，和新数据拼接后继续解析
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <Network/Socket.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace AntonaStandard::Network{
+    /**
+     * @brief 分帧编解码器的接口
+     * @details
+     *      解码器可以保存跨读取的扫描状态（例如分隔符已经查找过的位置），因此每个连接应当使用独立的编解码器实例，
+     *      并且 decode 的 data 总是从当前帧的第一个字节开始。data 不是从帧首开始时（例如丢弃了缓冲区）应当先调用 reset
+     */
+    class FrameCodec{
+    public:
+        virtual ~FrameCodec() = default;
+        /**
+         * @brief 从 data 的开头解析一帧
+         * @param data      尚未解析的数据，从帧首开始
+         * @param size      数据长度
+         * @param frame     解析成功时指向 data 中帧的内容（不包括长度前缀、分隔符）
+         * @param consumed  解析成功时为整个帧在 data 中占用的字节数
+         * @return true     解析出了一帧
+         * @return false    数据还不足一帧
+         * @throw
+         *      AntonaStandard::Globals::Overflow_Error 帧长度超过上限
+         *      AntonaStandard::Globals::DataCorrupted_Error 数据格式错误
+         */
+        virtual bool decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed) = 0;
+        /**
+         * @brief 把 payload 编码为一帧追加到 buffer 的写入位点之后
+         * @throw
+         *      AntonaStandard::Globals::Overflow_Error payload 无法用该格式编码
+         */
+        virtual void encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size) = 0;
+        inline void encode(CPS::SocketDataBuffer& buffer,std::string_view payload){
+            this->encode(buffer,payload.data(),payload.size());
+        }
+        /// @brief 丢弃跨读取的扫描状态
+        virtual void reset(){}
+    };
+
+    /**
+     * @brief 长度前缀的格式
+     */
+    enum class LengthPrefix{
+        Varint,         ///< 无符号 LEB128 变长整数，与 protobuf 相同，每字节 7 位，最多 10 字节
+        Fixed8,         ///< 1 字节
+        Fixed16,        ///< 2 字节大端
+        Fixed32,        ///< 4 字节大端
+        Fixed64,        ///< 8 字节大端
+    };
+
+    /**
+     * @brief 长度前缀分帧：长度 + 内容
+     */
+    class LengthPrefixCodec:public FrameCodec{
+    private:
+        LengthPrefix prefix;
+        std::size_t max_frame_size;
+    public:
+        /**
+         * @param prefix            长度前缀的格式
+         * @param max_frame_size    允许的最大帧长度，防止错误的长度导致读缓冲区无限扩容
+         */
+        LengthPrefixCodec(LengthPrefix prefix = LengthPrefix::Varint,std::size_t max_frame_size = 16 << 20)
+            :prefix(prefix),max_frame_size(max_frame_size){};
+        virtual bool decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed)override;
+        using FrameCodec::encode;
+        virtual void encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size)override;
+        inline LengthPrefix getPrefix()const{
+            return this->prefix;
+        }
+    };
+
+    /**
+     * @brief 分隔符分帧：内容 + 分隔符
+     * @details
+     *      数据不足一帧时记录已经查找过的长度，下次从该位置继续查找，不完整的长帧在多次读取中只扫描一遍
+     */
+    class DelimiterCodec:public FrameCodec{
+    private:
+        std::string delimiter;
+        std::size_t max_frame_size;
+        std::size_t scanned = 0;        ///< 当前帧中已经确认不包含分隔符的长度
+    public:
+        /**
+         * @param delimiter         分隔符，不能为空
+         * @param max_frame_size    允许的最大帧长度（不包括分隔符）
+         * @throw
+         *      AntonaStandard::Globals::WrongArgument_Error 分隔符为空
+         */
+        DelimiterCodec(std::string delimiter,std::size_t max_frame_size = 1 << 20);
+        virtual bool decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed)override;
+        using FrameCodec::encode;
+        virtual void encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size)override;
+        virtual void reset()override{
+            this->scanned = 0;
+        }
+        inline const std::string& getDelimiter()const{
+            return this->delimiter;
+        }
+    };
+
+    /**
+     * @brief 文本行分帧
+     * @details 解码时以 LF 结尾，行尾的 CR 会被去掉，因此同时接受 LF 和 CRLF；编码时使用构造时指定的行尾
+     */
+    class LineCodec:public DelimiterCodec{
+    private:
+        bool crlf;
+    public:
+        /**
+         * @param crlf              编码时是否以 CRLF 结尾，否则以 LF 结尾
+         * @param max_frame_size    允许的最大行长度
+         */
+        LineCodec(bool crlf = false,std::size_t max_frame_size = 1 << 20):DelimiterCodec("\n",max_frame_size),crlf(crlf){};
+        virtual bool decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed)override;
+        using FrameCodec::encode;
+        virtual void encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size)override;
+    };
+
+    /**
+     * @brief 定长记录分帧
+     */
+    class FixedSizeCodec:public FrameCodec{
+    private:
+        std::size_t record_size;
+    public:
+        /**
+         * @throw
+         *      AntonaStandard::Globals::WrongArgument_Error record_size 为 0
+         */
+        FixedSizeCodec(std::size_t record_size);
+        virtual bool decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed)override;
+        using FrameCodec::encode;
+        /// @throw AntonaStandard::Globals::WrongArgument_Error payload 的长度不等于记录长度
+        virtual void encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size)override;
+        inline std::size_t getRecordSize()const{
+            return this->record_size;
+        }
+    };
+
+    /**
+     * @brief 从套接字通道中按帧读取
+     * @details
+     *      帧直接解析自通道的读缓冲区，next 返回的视图在下一次调用 next 之前有效。
+     *      读缓冲区由 FrameReader 管理，使用期间不应当再直接读取通道
+     */
+    class FrameReader{
+    private:
+        SocketChannel channel;
+        CPS::SocketDataBuffer& buffer;      ///< 通道的读缓冲区，避免每一帧都经过 SocketChannel 的空指针检查
+        FrameCodec& codec;
+        std::size_t read_size;
+    public:
+        /**
+         * @param channel   读取的套接字通道
+         * @param codec     编解码器，生命周期应当长于 FrameReader
+         * @param read_size 每次读取前保证读缓冲区至少有这么多的空闲空间
+         */
+        FrameReader(SocketChannel channel,FrameCodec& codec,std::size_t read_size = 64 << 10);
+        /**
+         * @brief 取出下一帧，读缓冲区中没有完整的帧时从通道读取
+         * @return true 取到了一帧
+         * @return false 对端关闭了连接
+         * @throw
+         *      参考 FrameCodec::decode 和 SocketChannel::read
+         */
+        bool next(std::string_view& frame);
+        /**
+         * @brief 只从读缓冲区中已有的数据取出下一帧，不读取通道
+         * @return false 读缓冲区中没有完整的帧
+         */
+        bool tryNext(std::string_view& frame);
+        /// @brief 读缓冲区中尚未解析的字节数，连接关闭后非 0 说明最后一帧不完整
+        inline std::size_t getBufferedSize(){
+            return this->buffer.getReadableSize();
+        }
+        inline SocketChannel& getChannel(){
+            return this->channel;
+        }
+    };
+}
+
+#endif
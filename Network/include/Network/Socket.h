@@ -19,9 +19,16 @@
 #include <mutex>
 #include <atomic>
 #include <cstdlib>
+#include <cstddef>
 #include <cstring>
+#include <algorithm>
 #include <memory>
 #include <iostream>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <type_traits>
+#include <vector>
 
 namespace AntonaStandard{
     /**
@@ -44,6 +51,19 @@ namespace AntonaStandard{
 }
 
 namespace AntonaStandard::Network{
+    /**
+     * @brief 文件发送进度的回调
+     * @details 两个参数分别为本次调用已经发送的字节数和需要发送的总字节数
+     * @see SocketChannel::sendFile
+     */
+    using SendFileProgress = std::function<void(size_t sent,size_t total)>;
+    /**
+     * @brief 零拷贝发送的数据不再被内核引用时的回调
+     * @details 参数为 true 表示内核退化为拷贝发送（例如环回地址、网卡不支持），这种情况下零拷贝没有收益
+     * @see SocketChannel::sendZeroCopy
+     */
+    using ZeroCopyRelease = std::function<void(bool copied)>;
+
     /**
      * @brief 用于管理套接字文件描述符
      * @details
@@ -70,6 +90,13 @@ namespace AntonaStandard::Network{
          * 
          */
         void close();
+        /**
+         * @brief 有选择地关闭读写通道，不释放套接字文件描述符
+         * @details 
+         *      对监听套接字关闭读通道可以唤醒阻塞在 accept 上的线程
+         * @param how 
+         */
+        void shutdown(CPS::ShutdownOptions how);
         ~SocketManager();
     };
     /**
@@ -115,6 +142,19 @@ namespace AntonaStandard::Network{
          *      void launch()
          */
         std::shared_ptr<std::once_flag> flag;
+        /// @brief 启动之前设置的整数选项
+        struct PendingOption{
+            CPS::SocketLevel level;
+            CPS::SocketOptions option;
+            int value;
+        };
+        /**
+         * @brief 启动之前设置的选项
+         * @details 
+         *      端口复用、TCP Fast Open 等选项必须在绑定或连接之前设置，而 launch 会一次完成创建、绑定或连接，
+         *      所以启动之前设置的选项先记录在这里，由 apply_pending_options 在创建套接字文件描述符之后设置
+         */
+        std::vector<PendingOption> pending_options;
     protected:
         /**
          * @brief 完成启动套接字的一系列操作，由 launch 函数调用
@@ -169,6 +209,30 @@ namespace AntonaStandard::Network{
          *      std::runtine_error
          */
         virtual SocketOptionValue getOption(CPS::SocketOptions option);
+        /**
+         * @brief 设置值为 int 的套接字选项，不分配内存
+         * @details 
+         *      已经启动的套接字会立即设置，否则记录下来，在 launch 时绑定或连接之前设置
+         * @param level     选项作用的层
+         * @param option 
+         * @param value 
+         * @throw
+         *      std::runtime_error 设置失败时抛出，异常消息中包含平台相关的错误码
+         */
+        void setIntOption(CPS::SocketLevel level,CPS::SocketOptions option,int value);
+        /**
+         * @brief 读取值为 int 的套接字选项，不分配内存
+         * @throw
+         *      AntonaStandard::Globals::NullPointer_Error 套接字尚未启动
+         *      std::runtime_error 读取失败时抛出
+         */
+        int getIntOption(CPS::SocketLevel level,CPS::SocketOptions option);
+        /**
+         * @brief 设置启动之前记录的选项，由派生类的 launch_stuff 在安装 SocketManager 之后、绑定或连接之前调用
+         * @throw
+         *      std::runtime_error 设置失败时抛出
+         */
+        void apply_pending_options();
 
 
     public:
@@ -243,10 +307,14 @@ namespace AntonaStandard::Network{
         inline CPS::SocketAddress& get_bind_or_remote_addr(){
             return this->bind_or_remote_addr;
         }
+        /*
+         * 以下是常用选项的类型化接口，都是对 setIntOption 和 getIntOption 的封装：
+         * 设置接口可以在启动之前调用，读取接口要求套接字已经启动。选项的含义见 AntonaStandard::CPS::SocketOptions
+         */
         /**
-         * @brief 设置地址复用，是对setOption 函数的封装
+         * @brief 设置地址复用
          * @throw
-         *          参考 virtual void setOption(CPS::SocketOptions option,SocketOptionValue value);
+         *          参考 void setIntOption(CPS::SocketLevel,CPS::SocketOptions,int)
          */
         void setReuseAddress(bool);
         /**
@@ -255,10 +323,125 @@ namespace AntonaStandard::Network{
          * @return true 
          * @return false 
          * @throw
-         *          参考 virtual SocketOptionValue Socket::getOption(CPS::SoketOptions)
+         *          参考 int getIntOption(CPS::SocketLevel,CPS::SocketOptions)
          */
         bool isReuseAddress();
-
+        /// @brief 设置保持连接
+        inline void setKeepAlive(bool option){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::KeepAlive,option);
+        }
+        inline bool isKeepAlive(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::KeepAlive) != 0;
+        }
+        /// @brief 设置发送缓冲区大小（字节）
+        inline void setSendBufferSize(int size){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::SendBuffer,size);
+        }
+        inline int getSendBufferSize(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::SendBuffer);
+        }
+        /// @brief 设置接收缓冲区大小（字节），监听套接字上设置的值会被接受的连接继承
+        inline void setReceiveBufferSize(int size){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ReceiveBuffer,size);
+        }
+        inline int getReceiveBufferSize(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ReceiveBuffer);
+        }
+        /// @brief 禁用 Nagle 算法，仅适用于TCP套接字
+        inline void setNoDelay(bool option){
+            this->setIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::NoDelay,option);
+        }
+        inline bool isNoDelay(){
+            return this->getIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::NoDelay) != 0;
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        /**
+         * @brief 设置端口复用（SO_REUSEPORT）
+         * @details 
+         *      开启后多个套接字可以绑定同一个地址和端口，内核在它们之间分配连接或数据报。必须在绑定之前设置
+         */
+        inline void setReusePort(bool option){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ReusePort,option);
+        }
+        inline bool isReusePort(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ReusePort) != 0;
+        }
+        /// @brief 设置接收时忙轮询的微秒数，0 表示关闭
+        inline void setBusyPoll(int microseconds){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::BusyPoll,microseconds);
+        }
+        inline int getBusyPoll(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::BusyPoll);
+        }
+        /// @brief 设置处理接收数据的 CPU，设置在监听套接字上时内核优先把连接交给运行在该 CPU 上的 accept
+        inline void setIncomingCpu(int cpu){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::IncomingCpu,cpu);
+        }
+        /// @brief 最近一次处理该套接字接收数据的 CPU，未知时为 -1
+        inline int getIncomingCpu(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::IncomingCpu);
+        }
+        /// @brief 立即发送确认，仅适用于TCP套接字。内核会在之后恢复延迟确认，对延迟敏感的场景需要在每次读取之后重新设置
+        inline void setQuickAck(bool option){
+            this->setIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::QuickAck,option);
+        }
+        inline bool isQuickAck(){
+            return this->getIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::QuickAck) != 0;
+        }
+        /**
+         * @brief 开启或取消 TCP_CORK，仅适用于TCP套接字
+         * @details 开启期间写入的数据积攒成完整的报文段才发出，取消时立即发出剩余的数据。只合并一次发送时可以使用 SocketChannel::writeMore
+         */
+        inline void setCork(bool option){
+            this->setIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::Cork,option);
+        }
+        inline bool isCork(){
+            return this->getIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::Cork) != 0;
+        }
+        /// @brief 在监听套接字上开启 TCP Fast Open，queue_length 为等待完成握手的请求数，0 表示关闭。需要系统参数 net.ipv4.tcp_fastopen 允许服务端使用
+        inline void setFastOpen(int queue_length){
+            this->setIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::FastOpen,queue_length);
+        }
+        inline int getFastOpen(){
+            return this->getIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::FastOpen);
+        }
+        /**
+         * @brief 设置非阻塞模式
+         * @details 非阻塞模式下 SocketChannel::sendFile 在发送缓冲区已满时返回已发送的字节数，调用方在套接字可写时继续发送
+         * @throw
+         *      AntonaStandard::Globals::NullPointer_Error 套接字尚未启动
+         *      std::runtime_error
+         */
+        void setNonBlocking(bool non_blocking);
+        /// @brief 客户端连接时使用 TCP Fast Open，第一次写入的数据随 SYN 发出。必须在 launch 之前设置
+        inline void setFastOpenConnect(bool option){
+            this->setIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::FastOpenConnect,option);
+        }
+        inline bool isFastOpenConnect(){
+            return this->getIntOption(CPS::SocketLevel::TCP_level,CPS::SocketOptions::FastOpenConnect) != 0;
+        }
+        /// @brief 允许零拷贝发送。SocketChannel::sendZeroCopy 第一次调用时也会自动开启
+        inline void setZeroCopy(bool option){
+            this->setIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ZeroCopy,option);
+        }
+        inline bool isZeroCopy(){
+            return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ZeroCopy) != 0;
+        }
+        /// @brief UDP 套接字默认的 GSO 分段大小，之后每次发送都按该长度切分为多个数据报，为 0 时不分段
+        inline void setUdpSegment(int segment_size){
+            this->setIntOption(CPS::SocketLevel::UDP_level,CPS::SocketOptions::UdpSegment,segment_size);
+        }
+        inline int getUdpSegment(){
+            return this->getIntOption(CPS::SocketLevel::UDP_level,CPS::SocketOptions::UdpSegment);
+        }
+        /// @brief UDP 套接字接收时允许合并数据报，合并后的数据通过 SocketChannel::readSegments 读取
+        inline void setUdpGro(bool option){
+            this->setIntOption(CPS::SocketLevel::UDP_level,CPS::SocketOptions::UdpGro,option);
+        }
+        inline bool isUdpGro(){
+            return this->getIntOption(CPS::SocketLevel::UDP_level,CPS::SocketOptions::UdpGro) != 0;
+        }
+    #endif
     };
     /**
      * @brief TCP 监听套接字
@@ -273,6 +456,7 @@ namespace AntonaStandard::Network{
          *      包含以下内容：
          *      - 调用AntonaStandard::CPS::SocketLibraryManager::socket() 创建套接字文件描述符
          *      - 将套接字文件描述符安装给 SocketManager 实例
+         *      - 设置启动之前记录的选项，例如端口复用
          *      - 调用AntonaStandard::CPS::SocketLibraryManager::bind() 绑定到bind_or_remote_addr
          *      - 调用AntonaStandard::CPS::SocketLibraryManager::listen() 开启监听
          */
@@ -281,6 +465,15 @@ namespace AntonaStandard::Network{
         TCPListenSocket() = delete;
         TCPListenSocket(const CPS::SocketAddress& addr):Socket(addr){};
         TCPListenSocket(CPS::SocketAddress&& addr):Socket(addr){};
+        /**
+         * @brief 构造监听套接字，并指定启动时是否开启端口复用
+         * @details 多个开启了端口复用的监听套接字可以绑定同一个地址，见 TCPListenerGroup
+         * @param addr 
+         * @param reuse_port 
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 平台不支持端口复用时抛出
+         */
+        TCPListenSocket(const CPS::SocketAddress& addr,bool reuse_port);
         TCPListenSocket(const TCPListenSocket& sock):Socket(sock){};
         TCPListenSocket(TCPListenSocket&& sock):Socket(sock){};
         /**
@@ -315,6 +508,7 @@ namespace AntonaStandard::Network{
          *      包含以下内容：
          *      - 调用 AntonaStandard::CPS::SocketLibraryManager::socket() 创建套接字文件描述符
          *      - 将套接字文件描述符安装给 SocketManager 实例
+         *      - 设置启动之前记录的选项，例如 TCP Fast Open
          *      - 调用 AntonaStandard::CPS::SocketLibraryManager::connect() 连接到指定地址
          */
         virtual void launch_stuff()override;
@@ -340,6 +534,7 @@ namespace AntonaStandard::Network{
      *      包含以下内容：
      *      - 调用 AntonaStandard::CPS::SocketLibraryManager::socket() 创建套接字文件描述符
      *      - 将套接字文件描述符安装给 SocketManager 实例
+     *      - 设置启动之前记录的选项
      *      - 调用 AntonaStandard::CPS::SocketLibraryManager::bind() 绑定到本地地址，这样可以等待
      *        其它端发送数据，也可以接收广播数据。
      */
@@ -354,44 +549,58 @@ namespace AntonaStandard::Network{
     /**
      * @brief 套接字选项值的封装类
      * @details
-     *      虽然目前项目支持的套接字选项只有设置地址复用，对应的值是bool类型，表示开启还是关闭。但是为了后面的扩展
-     *      需要对所有类型的套接字选项值进行一个抽象。因此这里对套接字选项值做了一个封装，所有的套接字选项值都是通过
-     *      一个void类型的指针保存的，因为任何类型的指针都可以自动转化位 void 类型的指针。该类有一个模板构造函数
-     *      可以传入任意类型的值（任何基本类型或支持拷贝赋值的类），自动计算该类型的大小，并保存。类型大小可以用作参数
-     *      传给 AntonaStandard::CPS::SocketLibraryManager::setSocketOption()。
-     *      AntonaStandard::CPS::SocketLibraryManager::getSocketOption()。
+     *      不同的套接字选项值类型不同（int、linger、timeval 等），这里对套接字选项值做了一个封装：值按字节保存在对象内部
+     *      定长的缓冲区中，同时记录它的大小，大小可以用作参数传给 AntonaStandard::CPS::SocketLibraryManager::setSocketOption()
+     *      和 AntonaStandard::CPS::SocketLibraryManager::getSocketOption()。构造和拷贝都不分配内存。
+     *      值为 int 的常用选项可以直接使用 Socket 的类型化接口，例如 Socket::setNoDelay
      */
     class SocketOptionValue{
+    public:
+        static constexpr socklen_t capacity = 64;      ///< 能保存的最大字节数
     private:
-    /**
-     * @brief 存储封装的资源的指针
-     */
-        std::shared_ptr<void> val;
+        /// @brief 存储选项值的缓冲区
+        alignas(std::max_align_t) unsigned char val[capacity];
         socklen_t val_size;
     public:
         inline socklen_t size()const{
             return this->val_size;
         }
 
-        inline const std::shared_ptr<void> value_ptr()const{
+        inline const void* value_ptr()const{
             return this->val;
         }
+        /**
+         * @brief 以 T 类型读取保存的值
+         * @details 保存的字节数少于 sizeof(T) 时，不足的部分为 0
+         */
+        template<typename T>
+        T as()const{
+            static_assert(std::is_trivially_copyable<T>::value,"option value must be trivially copyable");
+            T ret{};
+            std::memcpy(&ret,this->val,std::min<size_t>(sizeof(T),this->val_size));
+            return ret;
+        }
         /**
          * @brief 模板构造函数，以适应各种类型的值
          * 
-         * @tparam T 
+         * @tparam T 可平凡拷贝的类型
          * @param val 
          */
-        template<typename T>
+        template<typename T,typename = std::enable_if_t<std::is_trivially_copyable<T>::value && !std::is_pointer<T>::value>>
         SocketOptionValue(T val){
-            this->val = std::make_shared<T>(val);
-            this->val_size = sizeof(val);
+            static_assert(sizeof(T) <= capacity,"option value is too large");
+            std::memcpy(this->val,&val,sizeof(T));
+            this->val_size = sizeof(T);
         }
 
+        /**
+         * @brief 拷贝 len 个字节
+         * @throw AntonaStandard::Globals::WrongArgument_Error len 超过 capacity
+         */
         void setValue(const void* val,socklen_t len);
         SocketOptionValue(const void* val,socklen_t len);
-        SocketOptionValue(const SocketOptionValue& val);
-
+        SocketOptionValue(const SocketOptionValue& val)=default;
+        SocketOptionValue& operator=(const SocketOptionValue& val)=default;
     };
     /**
      * @brief 套接字通道类的实现接口
@@ -471,8 +680,7 @@ namespace AntonaStandard::Network{
          */
         inline bool isWritable()const{
             return 
-                this->remote_address.getImp() != nullptr && 
-                this->remote_address.getAddrIn() != nullptr && 
+                this->remote_address.isValid() && 
                 this->manager != nullptr;
         }
 
@@ -486,11 +694,55 @@ namespace AntonaStandard::Network{
         /**
          * @brief 调用该接口会将写缓冲区中的数据发送到远端地址，发送成功会清除写缓冲区
          * 
+         * @param flags 发送标志，详见 AntonaStandard::CPS::MessageFlags
          * @return size_t 
          * @throw
          *      具体异常可以参照 AntonaStandard::CPS::SocketLibraryManager::send() 和 AntonaStandard::CPS::SocketLibraryManager::sendTo()
          */
-        virtual size_t write() = 0;
+        virtual size_t write(int flags) = 0;
+        inline size_t write(){
+            return this->write(CPS::MessageFlags::NoFlags);
+        }
+        /**
+         * @brief 把文件的 [offset,offset+length) 直接发送到远端，默认不支持
+         * @details 详见 SocketChannel::sendFile
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 该类型的套接字通道不支持发送文件
+         */
+        virtual size_t sendFile(int file_fd,std::uint64_t offset,size_t length,const SendFileProgress& progress);
+        /**
+         * @brief 零拷贝发送一段用户内存，默认不支持
+         * @details 详见 SocketChannel::sendZeroCopy
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 该类型的套接字通道不支持零拷贝发送
+         */
+        virtual size_t sendZeroCopy(const void* data,size_t size,ZeroCopyRelease on_release);
+        /// @brief 处理已经到达的零拷贝完成通知，返回释放的发送次数，默认没有通知
+        virtual size_t reapZeroCopy(){
+            return 0;
+        }
+        /// @brief 等待零拷贝完成通知并处理，返回释放的发送次数，默认没有通知
+        virtual size_t waitZeroCopy([[maybe_unused]] int timeout_ms){
+            return 0;
+        }
+        /// @brief 尚未释放的零拷贝发送次数
+        virtual size_t getPendingZeroCopyCount()const{
+            return 0;
+        }
+        /**
+         * @brief 把写缓冲区中的数据按 segment_size 切分为多个数据报发送，默认不支持
+         * @details 详见 SocketChannel::writeSegments
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 该类型的套接字通道不支持分段发送
+         */
+        virtual size_t writeSegments(std::uint16_t segment_size,int flags);
+        /**
+         * @brief 接收可能被合并的多个数据报，默认不支持
+         * @details 详见 SocketChannel::readSegments
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 该类型的套接字通道不支持合并接收
+         */
+        virtual size_t readSegments(size_t& segment_size);
         
         /**
          * @brief 针对不同的套接字通道的需求对自身进行 ‘拷贝’ 后返回
@@ -573,6 +825,129 @@ namespace AntonaStandard::Network{
             this->assert_nullptr("SocketChannel::write();");
             return this->imp->write();
         }
+        /**
+         * @brief 带标志发送写缓冲区中的数据
+         * @param flags 详见 AntonaStandard::CPS::MessageFlags
+         */
+        inline size_t write(int flags){
+            this->assert_nullptr("SocketChannel::write(int);");
+            return this->imp->write(flags);
+        }
+        /**
+         * @brief 把文件的 [offset,offset+length) 直接发送到远端，仅TCP套接字通道支持
+         * @details 
+         *      数据在内核中从文件传到套接字（Linux 下普通文件使用 sendfile，管道使用 splice），不经过写缓冲区，
+         *      避免读入用户空间再写出的两次拷贝。写缓冲区中尚未发送的数据应当先调用 write 发出。
+         *      
+         *      阻塞套接字会一直发送到 length 个字节全部发出。非阻塞套接字在发送缓冲区已满时提前返回，
+         *      调用方在套接字可写时以 offset + 返回值 和 length - 返回值 继续发送。
+         *      每发送一段数据调用一次 progress
+         * @param file_fd   需要发送的文件的文件描述符
+         * @param offset    文件中的起始位置
+         * @param length    需要发送的字节数
+         * @param progress  进度回调，可以为空
+         * @return size_t   本次调用实际发送的字节数
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 套接字通道不支持发送文件
+         *      std::runtime_error 发送失败，或者文件比 offset + length 短
+         */
+        inline size_t sendFile(int file_fd,std::uint64_t offset,size_t length,const SendFileProgress& progress = nullptr){
+            this->assert_nullptr("SocketChannel::sendFile(int,std::uint64_t,size_t,const SendFileProgress&);");
+            return this->imp->sendFile(file_fd,offset,length,progress);
+        }
+        /**
+         * @brief 零拷贝发送一段用户内存，仅 Linux 下的TCP套接字通道支持
+         * @details 
+         *      以 MSG_ZEROCOPY 发送，内核直接引用 data 而不是拷贝到套接字缓冲区，大块数据可以节省拷贝消耗的CPU。
+         *      数据不经过写缓冲区，写缓冲区中尚未发送的数据应当先调用 write 发出。
+         *      
+         *      返回值大于 0 时，data 的前“返回值”个字节被内核引用，在 on_release 被调用之前必须保持有效且不能修改；
+         *      可以把数据的所有者（例如 std::shared_ptr）捕获到 on_release 中，由回调结束它的生命周期。
+         *      内核发送完成后通过错误队列通知，通知在调用 reapZeroCopy、waitZeroCopy 或者下一次 sendZeroCopy 时处理，
+         *      on_release 在这些函数中被调用。返回 0 时没有引用 data，也不会调用 on_release。
+         *      通道析构时会等待一段时间，详见 TCPSocketChannelImp::~TCPSocketChannelImp。
+         *      
+         *      未处理的完成通知过多时会等待通知到达后继续发送；返回值小于 size 说明非阻塞套接字的发送缓冲区已满，
+         *      调用方应在套接字可写之后以剩余的数据继续发送。
+         *      只有几十 KB 以上的数据值得使用零拷贝，小数据处理通知的开销超过拷贝
+         * @param data          需要发送的数据
+         * @param size          数据长度
+         * @param on_release    内核不再引用数据时的回调，可以为空
+         * @return size_t       本次调用实际发送的字节数
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 套接字通道不支持零拷贝发送
+         *      std::runtime_error 发送失败
+         */
+        inline size_t sendZeroCopy(const void* data,size_t size,ZeroCopyRelease on_release = nullptr){
+            this->assert_nullptr("SocketChannel::sendZeroCopy(const void*,size_t,ZeroCopyRelease);");
+            return this->imp->sendZeroCopy(data,size,std::move(on_release));
+        }
+        /**
+         * @brief 处理已经到达的零拷贝完成通知，不阻塞
+         * @return size_t 调用了 on_release 的发送次数
+         */
+        inline size_t reapZeroCopy(){
+            this->assert_nullptr("SocketChannel::reapZeroCopy();");
+            return this->imp->reapZeroCopy();
+        }
+        /**
+         * @brief 等待至少一条零拷贝完成通知到达并处理
+         * @param timeout_ms 超时时间（毫秒），负数表示一直等待。没有未释放的发送时立即返回
+         * @return size_t 调用了 on_release 的发送次数
+         */
+        inline size_t waitZeroCopy(int timeout_ms = -1){
+            this->assert_nullptr("SocketChannel::waitZeroCopy(int);");
+            return this->imp->waitZeroCopy(timeout_ms);
+        }
+        /// @brief 尚未调用 on_release 的零拷贝发送次数
+        inline size_t getPendingZeroCopyCount()const{
+            this->assert_nullptr("SocketChannel::getPendingZeroCopyCount();");
+            return this->imp->getPendingZeroCopyCount();
+        }
+        /**
+         * @brief 把写缓冲区中的数据按 segment_size 切分为多个数据报发送，仅 Linux 下的UDP套接字通道支持
+         * @details 
+         *      使用 UDP 分段卸载（UDP_SEGMENT），每次系统调用携带最多 64 个等长的数据报（最后一个可以更短），
+         *      由内核或者网卡完成切分，大量小数据报的发送不再受系统调用次数的限制。发送完成后清空写缓冲区。
+         *      segment_size 加上报头不应超过路径 MTU，否则数据报会被分片或者丢弃
+         * @param segment_size  每个数据报的长度
+         * @param flags         发送标志，详见 AntonaStandard::CPS::MessageFlags
+         * @return size_t       实际发送的字节数
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 套接字通道不支持分段发送
+         *      AntonaStandard::Globals::WrongArgument_Error segment_size 为 0 或者超过单个数据报的上限
+         *      std::runtime_error 发送失败
+         */
+        inline size_t writeSegments(std::uint16_t segment_size,int flags = CPS::MessageFlags::NoFlags){
+            this->assert_nullptr("SocketChannel::writeSegments(std::uint16_t,int);");
+            return this->imp->writeSegments(segment_size,flags);
+        }
+        /**
+         * @brief 接收可能被合并的多个数据报，仅 Linux 下的UDP套接字通道支持
+         * @details 
+         *      套接字开启 UdpGro 之后，内核把同一来源的连续等长数据报合并后一次交付，读缓冲区中依次存放每个 segment_size 字节的数据报，
+         *      最后一个可以更短。与 read 一样不会扩充读缓冲区，调用之前应当保证至少有 64KB 的可写空间，否则多出的数据会被丢弃
+         * @param segment_size  用于接收每个数据报的长度，没有合并时等于返回值
+         * @return size_t       接收到的总字节数
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 套接字通道不支持合并接收
+         *      std::runtime_error 接收失败
+         */
+        inline size_t readSegments(size_t& segment_size){
+            this->assert_nullptr("SocketChannel::readSegments(size_t&);");
+            return this->imp->readSegments(segment_size);
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        /**
+         * @brief 以 MSG_MORE 发送写缓冲区中的数据，提示内核后面还有数据
+         * @details 
+         *      例如先写出头部再写出正文时，头部使用 writeMore，内核会把它和正文合并成一个报文段，
+         *      避免 Nagle 算法与延迟确认相互等待。效果与 TCP_CORK 相同，但不需要额外的系统调用设置和取消选项
+         */
+        inline size_t writeMore(){
+            return this->write(CPS::MessageFlags::More);
+        }
+    #endif
     };
 
     /**
@@ -580,13 +955,49 @@ namespace AntonaStandard::Network{
      * 
      */
     class TCPSocketChannelImp:public SocketChannelImp{
+    private:
+        /// @brief 一次 sendZeroCopy 调用占用的完成通知编号区间以及其中尚未完成的个数
+        struct PendingZeroCopy{
+            std::uint32_t first;
+            std::uint32_t last;
+            std::uint32_t outstanding;
+            bool copied;
+            ZeroCopyRelease on_release;
+        };
+        /// @brief 按编号排列的未释放的零拷贝发送
+        std::deque<PendingZeroCopy> zerocopy_pending;
+        /// @brief 内核分配给下一次零拷贝发送的编号
+        std::uint32_t zerocopy_next = 0;
+        /// @brief 是否已经开启了 SocketOptions::ZeroCopy
+        bool zerocopy_enabled = false;
+        /// @brief 移出未完成数为 0 的发送并调用它们的 on_release，返回释放的个数
+        size_t release_zerocopy();
     public:
+        /// @brief 析构时等待零拷贝完成通知的最长时间（毫秒）
+        static constexpr int zerocopy_linger_ms = 1000;
         TCPSocketChannelImp():SocketChannelImp(){};
         TCPSocketChannelImp(const TCPSocketChannelImp&) = delete;
         TCPSocketChannelImp(TCPSocketChannelImp&& ) = delete;
-        virtual ~TCPSocketChannelImp(){};
+        /**
+         * @brief 析构前等待未释放的零拷贝发送完成
+         * @warning
+         *      内核在完成通知到达之前仍然引用发送的数据。最多等待 zerocopy_linger_ms 毫秒，
+         *      超时仍未完成的发送不会调用 on_release，其中捕获的所有者直接销毁，
+         *      因此应在销毁通道之前调用 waitZeroCopy 直到 getPendingZeroCopyCount 为 0
+         */
+        virtual ~TCPSocketChannelImp();
         virtual size_t read() override;
-        virtual size_t write() override;
+        using SocketChannelImp::write;
+        virtual size_t write(int flags) override;
+        /// @brief 每次调用 sendfile 发送的最大字节数，决定了进度回调的粒度
+        static constexpr size_t send_file_chunk = 4 << 20;
+        virtual size_t sendFile(int file_fd,std::uint64_t offset,size_t length,const SendFileProgress& progress) override;
+        virtual size_t sendZeroCopy(const void* data,size_t size,ZeroCopyRelease on_release) override;
+        virtual size_t reapZeroCopy() override;
+        virtual size_t waitZeroCopy(int timeout_ms) override;
+        virtual size_t getPendingZeroCopyCount()const override{
+            return this->zerocopy_pending.size();
+        }
     };
     /**
      * @brief UDP 套接字通道的实现类
@@ -599,7 +1010,14 @@ namespace AntonaStandard::Network{
         UDPSocketChannelImp(UDPSocketChannelImp&& ) = delete;
         virtual ~UDPSocketChannelImp() = default;
         virtual size_t read() override;
-        virtual size_t write() override;
+        using SocketChannelImp::write;
+        virtual size_t write(int flags) override;
+        /// @brief 单次系统调用最多携带的分段数
+        static constexpr size_t max_segments = 64;
+        /// @brief 单次系统调用最多携带的字节数，即一个 IPv4 数据报的最大载荷
+        static constexpr size_t max_segmented_size = 65507;
+        virtual size_t writeSegments(std::uint16_t segment_size,int flags) override;
+        virtual size_t readSegments(size_t& segment_size) override;
         virtual std::shared_ptr<SocketChannelImp> copy(std::shared_ptr<SocketChannelImp>)override;
 
     };
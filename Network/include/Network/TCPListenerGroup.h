@@ -0,0 +1,99 @@
+#ifndef NETWORK_TCPLISTENERGROUP_H
+#define NETWORK_TCPLISTENERGROUP_H
+
+/**
+ * @file TCPListenerGroup.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 基于端口复用的多监听套接字组
+ * @details
+ *      单个 TCPListenSocket 只有一个 accept 队列，由一个线程阻塞地调用 accept，在大量连接同时到来时这个队列会成为瓶颈。
+ *      TCPListenerGroup 在同一个地址上打开 N 个开启了 SO_REUSEPORT 的监听套接字（默认每个核心一个），
+ *      每个监听套接字各有一个 accept 线程。内核按连接的四元组哈希把新连接分配到不同的监听套接字，
+ *      各个 accept 队列互不竞争。
+ *
+ *      SO_REUSEPORT 目前只在 Linux 平台可用，其它平台上监听套接字组退化为一个普通的监听套接字
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <Network/Socket.h>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace AntonaStandard::Network{
+    /**
+     * @brief 绑定同一地址的一组 TCP 监听套接字，每个监听套接字有独立的 accept 线程
+     * @details
+     *      调用 launch 时依次启动所有监听套接字，如果地址的端口为 0，第一个监听套接字由系统分配端口，
+     *      其余的监听套接字绑定到同一个端口。之后每个 accept 线程把接受的连接交给 handler，
+     *      handler 会在多个 accept 线程中并发调用，应当尽快返回（例如把连接转交给线程池或者事件循环）。
+     *      handler 抛出的异常会被捕获并输出到 std::cerr，不会终止 accept 线程
+     */
+    class TCPListenerGroup{
+    public:
+        /// @brief 处理新连接的回调
+        using ConnectionHandler = std::function<void(TCPSocket)>;
+    private:
+        CPS::SocketAddress address;                                 ///< 绑定的地址，launch 之后为实际绑定的地址
+        std::vector<TCPListenSocket> listeners;
+        std::vector<std::thread> acceptors;                         ///< 与 listeners 一一对应的 accept 线程
+        std::unique_ptr<std::atomic<std::size_t>[]> accepted;       ///< 每个监听套接字接受的连接数
+        std::atomic<bool> running;
+        ConnectionHandler handler;
+
+        /// @brief 第 index 个 accept 线程的循环
+        void accept_loop(std::size_t index);
+    public:
+        /**
+         * @brief 构造监听套接字组，此时不会创建套接字
+         * @param addr      需要监听的本地地址，端口可以为 0
+         * @param count     监听套接字的个数，为 0 时使用 std::thread::hardware_concurrency()
+         */
+        TCPListenerGroup(const CPS::SocketAddress& addr,std::size_t count = 0);
+        TCPListenerGroup(const TCPListenerGroup&) = delete;
+        TCPListenerGroup& operator=(const TCPListenerGroup&) = delete;
+        /// @brief 析构时调用 stop
+        ~TCPListenerGroup();
+        /**
+         * @brief 启动所有监听套接字和 accept 线程
+         * @param handler 处理新连接的回调
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 重复启动时抛出
+         *      std::runtime_error 创建、绑定或监听套接字失败时抛出，此时已经启动的套接字会被关闭
+         */
+        void launch(ConnectionHandler handler);
+        /**
+         * @brief 停止所有 accept 线程并关闭监听套接字
+         * @details 对监听套接字关闭读通道以唤醒阻塞在 accept 上的线程，等待线程结束后关闭套接字。可以重复调用
+         */
+        void stop();
+        /// @brief 是否正在运行
+        inline bool isRunning()const{
+            return this->running.load(std::memory_order_acquire);
+        }
+        /// @brief 监听套接字的个数
+        inline std::size_t size()const{
+            return this->listeners.size();
+        }
+        /// @brief 监听的地址，launch 之后端口为实际绑定的端口
+        inline const CPS::SocketAddress& getAddress()const{
+            return this->address;
+        }
+        /// @brief 获取第 index 个监听套接字
+        inline TCPListenSocket& getListener(std::size_t index){
+            return this->listeners.at(index);
+        }
+        /// @brief 第 index 个监听套接字接受的连接数，用于观察内核的负载均衡
+        inline std::size_t getAcceptedCount(std::size_t index)const{
+            return this->accepted[index].load(std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,282 @@
+#ifndef NETWORK_TCPSERVER_H
+#define NETWORK_TCPSERVER_H
+
+/**
+ * @file TCPServer.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 多 Reactor 的 TCP 服务端框架
+ * @details
+ *      TCPServer 启动 N 个 EventLoop（默认每个核心一个），每个事件循环运行在独立的线程上。
+ *      accept 线程（由 TCPListenerGroup 提供）把新连接按轮询或者最少连接数交给某个事件循环，
+ *      此后连接的读写、回调和关闭都只在这个事件循环的线程中进行，连接的状态不需要加锁。
+ *
+ *      回调中不应当执行耗时的计算，否则会阻塞同一事件循环上的所有连接。
+ *      TCPConnection::offload 把计算交给 ThreadTools::ThreadsPool，完成后把结果投递回连接所属的事件循环
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#include <Network/EventLoop.h>
+#include <Network/TCPListenerGroup.h>
+#include <ThreadTools/ThreadsPool.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace AntonaStandard::Network{
+    class TCPConnection;
+    class TCPServer;
+    using TCPConnectionPtr = std::shared_ptr<TCPConnection>;
+
+    /**
+     * @brief 连接的回调，都在连接所属的事件循环线程中调用
+     */
+    struct TCPConnectionHandlers{
+        /// @brief 连接加入事件循环之后调用
+        std::function<void(const TCPConnectionPtr&)> on_connect;
+        /// @brief 读到数据之后调用，处理完的数据应当通过 moveGetPos 消费，未消费的数据会保留到下次读取
+        std::function<void(const TCPConnectionPtr&,CPS::SocketDataBuffer&)> on_message;
+        /// @brief 连接关闭时调用，此时已经不能再发送数据
+        std::function<void(const TCPConnectionPtr&)> on_close;
+    };
+
+    /**
+     * @brief 绑定在某个事件循环上的非阻塞 TCP 连接
+     * @details
+     *      读写缓冲区就是套接字通道的缓冲区。send 和 close 可以在任意线程调用，
+     *      不在所属的事件循环线程时会投递过去执行（send 需要拷贝一次数据）
+     */
+    class TCPConnection:public std::enable_shared_from_this<TCPConnection>{
+        friend class TCPServer;
+    private:
+        /// @brief 统计一次 offload，任务执行完毕或者没有执行就被销毁时计数减一
+        class OffloadGuard{
+        private:
+            std::atomic<std::size_t>* counter;
+        public:
+            explicit OffloadGuard(std::atomic<std::size_t>* counter):counter(counter){
+                if(this->counter != nullptr){
+                    this->counter->fetch_add(1,std::memory_order_relaxed);
+                }
+            }
+            OffloadGuard(const OffloadGuard&) = delete;
+            OffloadGuard& operator=(const OffloadGuard&) = delete;
+            ~OffloadGuard(){
+                this->finish();
+            }
+            void finish(){
+                if(this->counter != nullptr){
+                    this->counter->fetch_sub(1,std::memory_order_release);
+                    this->counter = nullptr;
+                }
+            }
+        };
+        EventLoop& loop;
+        TCPSocket socket;
+        int fd;                                                     ///< 在事件循环中注册的文件描述符
+        CPS::SocketDataBuffer& in_buffer;
+        CPS::SocketDataBuffer& out_buffer;
+        std::shared_ptr<const TCPConnectionHandlers> handlers;
+        std::function<void(const TCPConnectionPtr&)> on_removed;    ///< 由 TCPServer 设置，从事件循环的连接表中删除
+        std::atomic<std::size_t>* offloads;                         ///< 由 TCPServer 设置，统计尚未结束的 offload
+        std::size_t read_size;
+        std::chrono::milliseconds idle_timeout;                     ///< 为 0 时不检查空闲超时
+        EventLoop::TimerId idle_timer;
+        bool connected;
+        bool writing;                                               ///< 是否正在关注可写事件
+
+        void start();
+        void handle_events(std::uint32_t events);
+        void handle_read();
+        void flush();
+        void handle_close();
+    public:
+        TCPConnection(EventLoop& loop,TCPSocket socket,std::shared_ptr<const TCPConnectionHandlers> handlers,std::size_t read_size,
+            std::chrono::milliseconds idle_timeout = std::chrono::milliseconds(0));
+        TCPConnection(const TCPConnection&) = delete;
+        TCPConnection& operator=(const TCPConnection&) = delete;
+
+        /**
+         * @brief 发送数据，发送缓冲区已满时暂存在写缓冲区中，套接字可写时继续发送
+         * @details 连接已经关闭时数据被丢弃
+         */
+        void send(const void* data,std::size_t size);
+        inline void send(std::string_view data){
+            this->send(data.data(),data.size());
+        }
+        /// @brief 关闭连接，暂存在写缓冲区中没有发送的数据会被丢弃
+        void close();
+        /// @brief 连接是否还没有关闭，只应当在所属的事件循环线程中调用
+        inline bool isConnected()const{
+            return this->connected;
+        }
+        /// @brief 写缓冲区中等待发送的字节数，只应当在所属的事件循环线程中调用
+        inline std::size_t getPendingSize()const{
+            return this->out_buffer.getReadableSize();
+        }
+        inline EventLoop& getLoop(){
+            return this->loop;
+        }
+        inline TCPSocket& getSocket(){
+            return this->socket;
+        }
+        /**
+         * @brief 把计算交给线程池，完成后在所属的事件循环线程中调用 done
+         * @details
+         *      work 在线程池的工作线程中执行，不应当访问连接的状态。work 的返回值作为 done 的第二个参数，
+         *      返回 void 时 done 只接受连接一个参数。work 抛出的异常会在事件循环线程中重新抛出，被事件循环捕获并输出。
+         *      线程池已经关闭时 work 和 done 都不会执行，提交失败的异常同样在事件循环线程中重新抛出。
+         *      连接可能在计算期间被关闭，done 中应当检查 isConnected。
+         *      
+         *      计算完成后需要向所属的事件循环投递，因此事件循环必须比计算活得更久；事件循环结束之后投递的 done 会被丢弃。
+         *      由 TCPServer 创建的连接满足这一点：TCPServer::stop 会等待尚未结束的计算（包括还在线程池队列中的）。
+         *      单独使用 TCPConnection 时由调用方保证
+         * @param pool  执行计算的线程池
+         * @param work  耗时的计算
+         * @param done  处理结果的回调
+         */
+        template<typename type_Work,typename type_Done>
+        void offload(ThreadTools::ThreadsPool& pool,type_Work work,type_Done done){
+            TCPConnectionPtr self = this->shared_from_this();
+            auto guard = std::make_shared<OffloadGuard>(this->offloads);
+            std::future<void> submitted = pool.submit([self,guard,work = std::move(work),done = std::move(done)]()mutable{
+                using Result = decltype(work());
+                try{
+                    if constexpr(std::is_void_v<Result>){
+                        work();
+                        self->loop.post([self,done]()mutable{ done(self); });
+                    }
+                    else{
+                        auto result = std::make_shared<Result>(work());
+                        self->loop.post([self,done,result]()mutable{ done(self,std::move(*result)); });
+                    }
+                }
+                catch(...){
+                    std::exception_ptr error = std::current_exception();
+                    self->loop.post([error](){ std::rethrow_exception(error); });
+                }
+                // 已经投递完毕，不再访问事件循环
+                guard->finish();
+            });
+            // 提交失败时返回的 future 已经就绪并带有异常；提交成功的任务自己捕获了所有异常，get() 不会抛出
+            if(submitted.wait_for(std::chrono::seconds(0)) == std::future_status::ready){
+                try{
+                    submitted.get();
+                }
+                catch(...){
+                    std::exception_ptr error = std::current_exception();
+                    this->loop.post([error](){ std::rethrow_exception(error); });
+                }
+            }
+        }
+    };
+
+    /**
+     * @brief 新连接分配给事件循环的策略
+     */
+    enum class LoopBalance{
+        RoundRobin,         ///< 轮流分配
+        LeastConnections,   ///< 分配给当前连接数最少的事件循环
+    };
+
+    /**
+     * @brief TCPServer 的配置
+     */
+    struct TCPServerOptions{
+        std::size_t loops = 0;                  ///< 事件循环的个数，为 0 时使用 std::thread::hardware_concurrency()
+        std::size_t listeners = 1;              ///< 监听套接字（accept 线程）的个数，参考 TCPListenerGroup
+        LoopBalance balance = LoopBalance::RoundRobin;
+        std::size_t read_size = 64 << 10;       ///< 每次读取前保证读缓冲区至少有这么多的空闲空间
+        /// @brief 连接在这么长时间内没有收到数据时被关闭（调用 on_close），为 0 时不检查。定时器由事件循环的时间轮管理
+        std::chrono::milliseconds idle_timeout = std::chrono::milliseconds(0);
+    };
+
+    /**
+     * @brief 多 Reactor 的 TCP 服务端
+     * @details 回调必须在 launch 之前设置
+     */
+    class TCPServer{
+    private:
+        struct LoopSlot{
+            EventLoop loop;
+            std::thread thread;
+            std::atomic<std::size_t> load{0};                                   ///< 分配到该事件循环且尚未关闭的连接数
+            std::atomic<std::size_t> offloads{0};                               ///< 该事件循环上的连接尚未结束的 offload 数
+            std::unordered_map<TCPConnection*,TCPConnectionPtr> connections;    ///< 只在该事件循环的线程中访问
+        };
+        TCPServerOptions options;
+        TCPListenerGroup listeners;
+        std::vector<std::unique_ptr<LoopSlot>> slots;
+        std::shared_ptr<TCPConnectionHandlers> handlers;
+        std::atomic<std::size_t> next_slot;
+        std::atomic<bool> running;
+
+        LoopSlot& select_slot();
+        void accept(TCPSocket socket);
+    public:
+        /**
+         * @brief 构造服务端，此时不会创建套接字和线程
+         * @param addr      需要监听的本地地址，端口可以为 0
+         * @param options   配置
+         */
+        TCPServer(const CPS::SocketAddress& addr,TCPServerOptions options = TCPServerOptions());
+        TCPServer(const TCPServer&) = delete;
+        TCPServer& operator=(const TCPServer&) = delete;
+        /// @brief 析构时调用 stop
+        ~TCPServer();
+
+        inline void setConnectionHandler(std::function<void(const TCPConnectionPtr&)> handler){
+            this->handlers->on_connect = std::move(handler);
+        }
+        inline void setMessageHandler(std::function<void(const TCPConnectionPtr&,CPS::SocketDataBuffer&)> handler){
+            this->handlers->on_message = std::move(handler);
+        }
+        inline void setCloseHandler(std::function<void(const TCPConnectionPtr&)> handler){
+            this->handlers->on_close = std::move(handler);
+        }
+        /**
+         * @brief 启动事件循环线程和监听套接字
+         * @throw
+         *      AntonaStandard::Globals::UnlawfulOperation_Error 重复启动，或者当前平台不支持事件循环
+         *      std::runtime_error 创建、绑定或监听套接字失败
+         */
+        void launch();
+        /**
+         * @brief 停止接受新连接，关闭所有连接（调用 on_close）并结束事件循环线程。可以重复调用
+         * @details 返回之前会等待连接通过 TCPConnection::offload 提交的计算结束，之后不会再访问事件循环
+         */
+        void stop();
+        inline bool isRunning()const{
+            return this->running.load(std::memory_order_acquire);
+        }
+        /// @brief 监听的地址，launch 之后端口为实际绑定的端口
+        inline const CPS::SocketAddress& getAddress()const{
+            return this->listeners.getAddress();
+        }
+        inline std::size_t getLoopCount()const{
+            return this->slots.size();
+        }
+        /// @brief 第 index 个事件循环，可以向它投递任务
+        inline EventLoop& getLoop(std::size_t index){
+            return this->slots.at(index)->loop;
+        }
+        /// @brief 第 index 个事件循环上尚未关闭的连接数
+        inline std::size_t getConnectionCount(std::size_t index)const{
+            return this->slots.at(index)->load.load(std::memory_order_relaxed);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,274 @@
+#include <Network/ConnectionPool.h>
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <vector>
+#ifdef AntonaStandard_PLATFORM_LINUX
+    #include <poll.h>
+#endif
+
+namespace AntonaStandard::Network{
+    PooledConnection::PooledConnection(PooledConnection&& other)
+        :pool(other.pool),reused(other.reused),broken(other.broken){
+        if(other.socket){
+            this->socket.emplace(*other.socket);
+            other.socket.reset();
+        }
+    }
+
+    PooledConnection::~PooledConnection(){
+        this->release();
+    }
+
+    TCPSocket& PooledConnection::getSocket(){
+        if(!this->socket){
+            throw Globals::NullPointer_Error("In PooledConnection::getSocket() the connection has been released");
+        }
+        return *this->socket;
+    }
+
+    void PooledConnection::release(){
+        if(!this->socket){
+            return;
+        }
+        TCPSocket socket(*this->socket);
+        this->socket.reset();
+        this->pool->give_back(socket,!this->broken);
+    }
+
+    ConnectionPool::ConnectionPool(ConnectionPoolOptions options):options(std::move(options)){
+        std::size_t count = 1;
+        while(count < this->options.shards){
+            count <<= 1;
+        }
+        this->shards = std::make_unique<Shard[]>(count);
+        this->shard_mask = count - 1;
+        this->max_idle_per_shard = std::max<std::size_t>(1,(this->options.max_idle + count - 1) / count);
+    }
+
+    ConnectionPool::~ConnectionPool(){
+        this->clear();
+    }
+
+    bool ConnectionPool::is_reusable(TCPSocket& socket,std::chrono::steady_clock::time_point since){
+        if(std::chrono::steady_clock::now() - since > this->options.idle_timeout || 
+            socket.getManager()->getSocketFd() == INVALID_SOCKET){
+            return false;
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        // 空闲连接上不应当有任何事件：可读意味着对端关闭了连接或者发来了多余的数据
+        int events = CPS::SocketLibraryManager::manager().poll(socket.getManager()->getSocketFd(),POLLIN,0);
+        return events == 0;
+    #else
+        return true;
+    #endif
+    }
+
+    void ConnectionPool::discard(TCPSocket& socket){
+        this->discarded.fetch_add(1,std::memory_order_relaxed);
+        try{
+            socket.close();
+        }
+        catch(std::exception&){
+            // 连接已经不再使用，关闭失败也没有补救的办法
+        }
+    }
+
+    TCPSocket ConnectionPool::take_idle(Shard& shard,Host& host,IdleList::iterator it){
+        TCPSocket socket(it->socket);
+        // 借出时取最近归还的，淘汰时取最早归还的，只有 prune 需要在中间查找
+        if(host.idle.back() == it){
+            host.idle.pop_back();
+        }
+        else if(host.idle.front() == it){
+            host.idle.pop_front();
+        }
+        else{
+            host.idle.erase(std::find(host.idle.begin(),host.idle.end(),it));
+        }
+        shard.lru.erase(it);
+        return socket;
+    }
+
+    void ConnectionPool::erase_if_unused(Shard& shard,const CPS::SocketAddress& addr){
+        auto found = shard.hosts.find(addr);
+        if(found != shard.hosts.end() && found->second.leased == 0 && found->second.idle.empty()){
+            shard.hosts.erase(found);
+        }
+    }
+
+    PooledConnection ConnectionPool::acquire(const CPS::SocketAddress& addr){
+        Shard& shard = this->shard_of(addr);
+        auto deadline = std::chrono::steady_clock::now() + this->options.acquire_timeout;
+        std::unique_lock<std::mutex> lck(shard.mtx);
+        while(true){
+            // 等待期间地址的记录可能被删除，每一轮重新查找
+            Host& host = shard.hosts[addr];
+            while(!host.idle.empty()){
+                auto it = host.idle.back();
+                auto since = it->since;
+                TCPSocket socket = this->take_idle(shard,host,it);
+                // 借出之后记录不会被删除，可以在锁外探测
+                ++host.leased;
+                lck.unlock();
+                if(this->is_reusable(socket,since)){
+                    this->reused.fetch_add(1,std::memory_order_relaxed);
+                    return PooledConnection(this,socket,true);
+                }
+                this->discard(socket);
+                lck.lock();
+                --host.leased;
+            }
+            if(host.leased < this->options.max_per_host){
+                ++host.leased;
+                lck.unlock();
+                try{
+                    TCPSocket socket(addr);
+                    if(this->options.configure){
+                        this->options.configure(socket);
+                    }
+                    socket.launch();
+                    this->created.fetch_add(1,std::memory_order_relaxed);
+                    return PooledConnection(this,socket,false);
+                }
+                catch(...){
+                    lck.lock();
+                    --shard.hosts[addr].leased;
+                    this->erase_if_unused(shard,addr);
+                    if(shard.waiters > 0){
+                        shard.cv.notify_all();
+                    }
+                    throw;
+                }
+            }
+            ++shard.waiters;
+            std::cv_status status = shard.cv.wait_until(lck,deadline);
+            --shard.waiters;
+            if(status == std::cv_status::timeout){
+                Host& current = shard.hosts[addr];
+                if(current.idle.empty() && current.leased >= this->options.max_per_host){
+                    std::stringstream ss;
+                    ss<<"In ConnectionPool::acquire() timed out waiting for a connection to "<<addr.getIP()<<":"<<addr.getPort()
+                        <<", "<<current.leased<<" connections are in use";
+                    throw std::runtime_error(ss.str());
+                }
+            }
+        }
+    }
+
+    void ConnectionPool::give_back(TCPSocket socket,bool reusable){
+        CPS::SocketAddress addr = socket.get_bind_or_remote_addr();
+        // 残留的数据属于上一次借用，不能带给下一次借用
+        SocketChannel channel = socket.getChannel();
+        channel.getInBuffer().clear();
+        channel.getOutBuffer().clear();
+
+        Shard& shard = this->shard_of(addr);
+        std::vector<TCPSocket> closing;
+        {
+            std::lock_guard<std::mutex> lck(shard.mtx);
+            Host& host = shard.hosts[addr];
+            --host.leased;
+            reusable = reusable && socket.getManager()->getSocketFd() != INVALID_SOCKET;
+            if(reusable && host.idle.size() < this->options.max_idle_per_host){
+                shard.lru.push_front(IdleConnection{addr,socket,std::chrono::steady_clock::now()});
+                host.idle.push_back(shard.lru.begin());
+                if(shard.lru.size() > this->max_idle_per_shard){
+                    // 淘汰最久没有使用的连接，它一定是所属地址最早归还的那一个
+                    auto oldest = std::prev(shard.lru.end());
+                    CPS::SocketAddress oldest_addr = oldest->address;
+                    Host& oldest_host = shard.hosts[oldest_addr];
+                    closing.push_back(this->take_idle(shard,oldest_host,oldest));
+                    this->erase_if_unused(shard,oldest_addr);
+                }
+            }
+            else{
+                closing.push_back(socket);
+            }
+            this->erase_if_unused(shard,addr);
+            if(shard.waiters > 0){
+                shard.cv.notify_all();
+            }
+        }
+        for(auto& sock:closing){
+            this->discard(sock);
+        }
+    }
+
+    std::size_t ConnectionPool::prune(){
+        std::size_t count = 0;
+        for(std::size_t i = 0; i <= this->shard_mask; ++i){
+            Shard& shard = this->shards[i];
+            std::vector<TCPSocket> closing;
+            {
+                std::lock_guard<std::mutex> lck(shard.mtx);
+                for(auto it = shard.lru.begin(); it != shard.lru.end();){
+                    auto current = it++;
+                    if(this->is_reusable(current->socket,current->since)){
+                        continue;
+                    }
+                    CPS::SocketAddress addr = current->address;
+                    closing.push_back(this->take_idle(shard,shard.hosts[addr],current));
+                    this->erase_if_unused(shard,addr);
+                }
+                if(!closing.empty() && shard.waiters > 0){
+                    shard.cv.notify_all();
+                }
+            }
+            for(auto& sock:closing){
+                this->discard(sock);
+            }
+            count += closing.size();
+        }
+        return count;
+    }
+
+    void ConnectionPool::clear(){
+        for(std::size_t i = 0; i <= this->shard_mask; ++i){
+            Shard& shard = this->shards[i];
+            IdleList closing;
+            {
+                std::lock_guard<std::mutex> lck(shard.mtx);
+                closing.swap(shard.lru);
+                for(auto it = shard.hosts.begin(); it != shard.hosts.end();){
+                    it->second.idle.clear();
+                    if(it->second.leased == 0){
+                        it = shard.hosts.erase(it);
+                    }
+                    else{
+                        ++it;
+                    }
+                }
+                if(shard.waiters > 0){
+                    shard.cv.notify_all();
+                }
+            }
+            for(auto& idle:closing){
+                this->discard(idle.socket);
+            }
+        }
+    }
+
+    std::size_t ConnectionPool::getIdleCount(const CPS::SocketAddress& addr){
+        Shard& shard = this->shard_of(addr);
+        std::lock_guard<std::mutex> lck(shard.mtx);
+        auto found = shard.hosts.find(addr);
+        return found == shard.hosts.end() ? 0 : found->second.idle.size();
+    }
+
+    std::size_t ConnectionPool::getLeasedCount(const CPS::SocketAddress& addr){
+        Shard& shard = this->shard_of(addr);
+        std::lock_guard<std::mutex> lck(shard.mtx);
+        auto found = shard.hosts.find(addr);
+        return found == shard.hosts.end() ? 0 : found->second.leased;
+    }
+
+    std::size_t ConnectionPool::getIdleCount(){
+        std::size_t count = 0;
+        for(std::size_t i = 0; i <= this->shard_mask; ++i){
+            std::lock_guard<std::mutex> lck(this->shards[i].mtx);
+            count += this->shards[i].lru.size();
+        }
+        return count;
+    }
+}
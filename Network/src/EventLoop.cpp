@@ -0,0 +1,252 @@
+#include <Network/EventLoop.h>
+#include <chrono>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#ifdef AntonaStandard_PLATFORM_LINUX
+    #include <sys/epoll.h>
+    #include <sys/eventfd.h>
+    #include <unistd.h>
+#endif
+
+namespace AntonaStandard::Network{
+    namespace{
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        constexpr int max_events = 128;
+
+        std::uint32_t to_epoll(std::uint32_t events){
+            std::uint32_t result = 0;
+            if(events & IOEvents::Readable){
+                result |= EPOLLIN | EPOLLRDHUP;
+            }
+            if(events & IOEvents::Writable){
+                result |= EPOLLOUT;
+            }
+            return result;
+        }
+
+        std::uint32_t from_epoll(std::uint32_t events){
+            std::uint32_t result = 0;
+            if(events & (EPOLLIN | EPOLLRDHUP | EPOLLPRI)){
+                result |= IOEvents::Readable;
+            }
+            if(events & EPOLLOUT){
+                result |= IOEvents::Writable;
+            }
+            if(events & (EPOLLERR | EPOLLHUP)){
+                result |= IOEvents::Hangup;
+            }
+            return result;
+        }
+    #endif
+
+        template<typename type_Func>
+        void invoke_guarded(const char* where,type_Func&& func){
+            try{
+                func();
+            }
+            catch(std::exception& e){
+                std::cerr<<"In "<<where<<" uncaught exception: "<<e.what()<<std::endl;
+            }
+            catch(...){
+                std::cerr<<"In "<<where<<" uncaught exception of unknown type"<<std::endl;
+            }
+        }
+    }
+
+    EventLoop::EventLoop():epoll_fd(-1),wakeup_fd(-1),quit(false),owner(std::thread::id()),next_generation(0){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        this->epoll_fd = ::epoll_create1(EPOLL_CLOEXEC);
+        if(this->epoll_fd == -1){
+            std::stringstream ss;
+            ss<<"In EventLoop::EventLoop() epoll_create1 error, error = '"<<errno<<'\'';
+            throw std::runtime_error(ss.str());
+        }
+        this->wakeup_fd = ::eventfd(0,EFD_NONBLOCK | EFD_CLOEXEC);
+        if(this->wakeup_fd == -1){
+            int error = errno;
+            ::close(this->epoll_fd);
+            std::stringstream ss;
+            ss<<"In EventLoop::EventLoop() eventfd error, error = '"<<error<<'\'';
+            throw std::runtime_error(ss.str());
+        }
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = static_cast<std::uint64_t>(-1);
+        ::epoll_ctl(this->epoll_fd,EPOLL_CTL_ADD,this->wakeup_fd,&event);
+    #else
+        throw Globals::UnlawfulOperation_Error("In EventLoop::EventLoop() the event loop is only available on Linux");
+    #endif
+    }
+
+    EventLoop::~EventLoop(){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        ::close(this->wakeup_fd);
+        ::close(this->epoll_fd);
+    #endif
+    }
+
+    void EventLoop::wakeup(){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        std::uint64_t one = 1;
+        // 计数器溢出之前循环线程一定会读取，写失败说明已经有未处理的唤醒
+        [[maybe_unused]] ssize_t size = ::write(this->wakeup_fd,&one,sizeof(one));
+    #endif
+    }
+
+    void EventLoop::run_tasks(){
+        {
+            std::lock_guard<std::mutex> lck(this->mtx_tasks);
+            this->running_tasks.swap(this->tasks);
+        }
+        for(auto& task:this->running_tasks){
+            invoke_guarded("EventLoop::run()",task);
+        }
+        this->running_tasks.clear();
+    }
+
+    int EventLoop::get_wait_timeout()const{
+        Clock::time_point deadline = this->timers.next_deadline();
+        if(deadline == Clock::time_point::max()){
+            return -1;
+        }
+        Clock::time_point now = Clock::now();
+        if(deadline <= now){
+            return 0;
+        }
+        // 向上取整，避免在到期之前被唤醒后空转
+        auto timeout = std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count();
+        return static_cast<int>(std::min<decltype(timeout)>(timeout,std::numeric_limits<int>::max()));
+    }
+
+    void EventLoop::run_timers(){
+        // 回调抛出异常时剩余的到期定时器在下一轮触发
+        invoke_guarded("EventLoop::run()",[this](){ this->timers.advance(); });
+    }
+
+    void EventLoop::run(){
+        std::thread::id none;
+        if(!this->owner.compare_exchange_strong(none,std::this_thread::get_id(),std::memory_order_acq_rel)){
+            throw Globals::UnlawfulOperation_Error("In EventLoop::run() the loop is already running in another thread");
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        epoll_event events[max_events];
+        while(!this->quit.load(std::memory_order_acquire)){
+            int count = ::epoll_wait(this->epoll_fd,events,max_events,this->get_wait_timeout());
+            if(count == -1){
+                if(errno == EINTR){
+                    continue;
+                }
+                std::cerr<<"In EventLoop::run() epoll_wait error, error = '"<<errno<<'\''<<std::endl;
+                break;
+            }
+            for(int i = 0; i < count; ++i){
+                std::uint64_t data = events[i].data.u64;
+                if(data == static_cast<std::uint64_t>(-1)){
+                    std::uint64_t value = 0;
+                    [[maybe_unused]] ssize_t size = ::read(this->wakeup_fd,&value,sizeof(value));
+                    continue;
+                }
+                int fd = static_cast<int>(data & 0xffffffffu);
+                auto found = this->watches.find(fd);
+                if(found == this->watches.end() || found->second->generation != static_cast<std::uint32_t>(data >> 32)){
+                    continue;
+                }
+                // 持有一份引用，回调中注销自己时不会销毁正在执行的回调
+                std::shared_ptr<Watch> watch = found->second;
+                std::uint32_t ready = from_epoll(events[i].events);
+                invoke_guarded("EventLoop::run()",[&](){ watch->handler(ready); });
+            }
+            this->run_timers();
+            this->run_tasks();
+        }
+    #endif
+        this->run_tasks();
+        this->owner.store(std::thread::id(),std::memory_order_release);
+        this->quit.store(false,std::memory_order_release);
+    }
+
+    void EventLoop::stop(){
+        this->quit.store(true,std::memory_order_release);
+        this->wakeup();
+    }
+
+    void EventLoop::post(Task task){
+        {
+            std::lock_guard<std::mutex> lck(this->mtx_tasks);
+            this->tasks.push_back(std::move(task));
+        }
+        this->wakeup();
+    }
+
+    void EventLoop::dispatch(Task task){
+        if(this->isInLoopThread()){
+            task();
+        }
+        else{
+            this->post(std::move(task));
+        }
+    }
+
+    void EventLoop::control(int operation,int fd,std::uint32_t events,std::uint32_t generation){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        epoll_event event{};
+        event.events = to_epoll(events);
+        event.data.u64 = (static_cast<std::uint64_t>(generation) << 32) | static_cast<std::uint32_t>(fd);
+        if(::epoll_ctl(this->epoll_fd,operation,fd,&event) == -1){
+            std::stringstream ss;
+            ss<<"In EventLoop::control() epoll_ctl error, error = '"<<errno<<"' with fd = "<<fd;
+            throw std::runtime_error(ss.str());
+        }
+    #endif
+    }
+
+    void EventLoop::watch(int fd,std::uint32_t events,IOHandler handler){
+        if(this->watches.count(fd) != 0){
+            std::stringstream ss;
+            ss<<"In EventLoop::watch() fd = "<<fd<<" is already watched";
+            throw Globals::UnlawfulOperation_Error(ss.str().c_str());
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        std::uint32_t generation = this->next_generation++;
+        this->control(EPOLL_CTL_ADD,fd,events,generation);
+        this->watches.emplace(fd,std::make_shared<Watch>(Watch{generation,std::move(handler)}));
+    #endif
+    }
+
+    void EventLoop::modify(int fd,std::uint32_t events){
+        auto found = this->watches.find(fd);
+        if(found == this->watches.end()){
+            std::stringstream ss;
+            ss<<"In EventLoop::modify() fd = "<<fd<<" is not watched";
+            throw Globals::UnlawfulOperation_Error(ss.str().c_str());
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        this->control(EPOLL_CTL_MOD,fd,events,found->second->generation);
+    #endif
+    }
+
+    EventLoop::TimerId EventLoop::runAfter(Clock::duration delay,Task task){
+        return this->timers.schedule(delay,std::move(task));
+    }
+
+    bool EventLoop::cancelTimer(TimerId id){
+        return this->timers.cancel(id);
+    }
+
+    bool EventLoop::restartTimer(TimerId id,Clock::duration delay){
+        return this->timers.restart(id,delay);
+    }
+
+    void EventLoop::unwatch(int fd){
+        auto found = this->watches.find(fd);
+        if(found == this->watches.end()){
+            return;
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        ::epoll_ctl(this->epoll_fd,EPOLL_CTL_DEL,fd,nullptr);
+    #endif
+        this->watches.erase(found);
+    }
+}
@@ -0,0 +1,216 @@
+#include <Network/FrameCodec.h>
+#include <cstring>
+#include <sstream>
+
+namespace AntonaStandard::Network{
+    namespace{
+        /// @brief 定长前缀的字节数，varint 返回 0
+        std::size_t prefix_width(LengthPrefix prefix){
+            switch(prefix){
+                case LengthPrefix::Fixed8:  return 1;
+                case LengthPrefix::Fixed16: return 2;
+                case LengthPrefix::Fixed32: return 4;
+                case LengthPrefix::Fixed64: return 8;
+                default:                    return 0;
+            }
+        }
+        constexpr std::size_t max_varint_size = 10;
+    }
+
+    bool LengthPrefixCodec::decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed){
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+        std::uint64_t length = 0;
+        std::size_t header = 0;
+        std::size_t width = prefix_width(this->prefix);
+        if(width == 0){
+            for(std::size_t i = 0; i < size && i < max_varint_size; ++i){
+                if(i == max_varint_size - 1 && bytes[i] > 1){
+                    // 第 10 个字节只剩最高的 1 位可用，更大的值超出 64 位，不能截断
+                    throw Globals::DataCorrupted_Error("In LengthPrefixCodec::decode() the varint length prefix exceeds 64 bits");
+                }
+                length |= static_cast<std::uint64_t>(bytes[i] & 0x7f) << (7 * i);
+                if((bytes[i] & 0x80) == 0){
+                    header = i + 1;
+                    break;
+                }
+            }
+            if(header == 0){
+                if(size >= max_varint_size){
+                    throw Globals::DataCorrupted_Error("In LengthPrefixCodec::decode() the varint length prefix is longer than 10 bytes");
+                }
+                return false;
+            }
+        }
+        else{
+            if(size < width){
+                return false;
+            }
+            for(std::size_t i = 0; i < width; ++i){
+                length = (length << 8) | bytes[i];
+            }
+            header = width;
+        }
+        if(length > this->max_frame_size){
+            std::stringstream ss;
+            ss<<"In LengthPrefixCodec::decode() frame length "<<length<<" exceeds the limit "<<this->max_frame_size;
+            throw Globals::Overflow_Error(ss.str().c_str());
+        }
+        if(size - header < length){
+            return false;
+        }
+        frame = std::string_view(data + header,static_cast<std::size_t>(length));
+        consumed = header + static_cast<std::size_t>(length);
+        return true;
+    }
+
+    void LengthPrefixCodec::encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size){
+        unsigned char header[max_varint_size];
+        std::size_t header_size = 0;
+        std::uint64_t length = size;
+        std::size_t width = prefix_width(this->prefix);
+        if(width == 0){
+            while(length >= 0x80){
+                header[header_size++] = static_cast<unsigned char>(length | 0x80);
+                length >>= 7;
+            }
+            header[header_size++] = static_cast<unsigned char>(length);
+        }
+        else{
+            if(width < sizeof(std::uint64_t) && length >> (8 * width) != 0){
+                std::stringstream ss;
+                ss<<"In LengthPrefixCodec::encode() payload size "<<size<<" does not fit in a "<<width<<" byte prefix";
+                throw Globals::Overflow_Error(ss.str().c_str());
+            }
+            for(std::size_t i = 0; i < width; ++i){
+                header[width - 1 - i] = static_cast<unsigned char>(length >> (8 * i));
+            }
+            header_size = width;
+        }
+        buffer.ensureReceivableSize(header_size + size);
+        buffer.append(header,header_size);
+        buffer.append(payload,size);
+    }
+
+    DelimiterCodec::DelimiterCodec(std::string delimiter,std::size_t max_frame_size)
+        :delimiter(std::move(delimiter)),max_frame_size(max_frame_size){
+        if(this->delimiter.empty()){
+            throw Globals::WrongArgument_Error("In DelimiterCodec::DelimiterCodec() the delimiter is empty");
+        }
+    }
+
+    bool DelimiterCodec::decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed){
+        std::size_t width = this->delimiter.size();
+        std::size_t start = std::min(this->scanned,size);
+        std::size_t pos = std::string_view::npos;
+        if(width == 1){
+            const void* found = std::memchr(data + start,this->delimiter[0],size - start);
+            if(found != nullptr){
+                pos = static_cast<const char*>(found) - data;
+            }
+        }
+        else{
+            pos = std::string_view(data,size).find(this->delimiter,start);
+        }
+        if(pos == std::string_view::npos){
+            // 末尾不足一个分隔符的部分可能是分隔符的开头，下次需要重新检查
+            this->scanned = size + 1 >= width ? size + 1 - width : 0;
+            if(this->scanned > this->max_frame_size){
+                std::stringstream ss;
+                ss<<"In DelimiterCodec::decode() no delimiter found in the first "<<this->scanned<<" bytes, the limit is "<<this->max_frame_size;
+                throw Globals::Overflow_Error(ss.str().c_str());
+            }
+            return false;
+        }
+        if(pos > this->max_frame_size){
+            std::stringstream ss;
+            ss<<"In DelimiterCodec::decode() frame length "<<pos<<" exceeds the limit "<<this->max_frame_size;
+            throw Globals::Overflow_Error(ss.str().c_str());
+        }
+        frame = std::string_view(data,pos);
+        consumed = pos + width;
+        this->scanned = 0;
+        return true;
+    }
+
+    void DelimiterCodec::encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size){
+        buffer.ensureReceivableSize(size + this->delimiter.size());
+        buffer.append(payload,size);
+        buffer.append(this->delimiter.data(),this->delimiter.size());
+    }
+
+    bool LineCodec::decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed){
+        if(!DelimiterCodec::decode(data,size,frame,consumed)){
+            return false;
+        }
+        if(!frame.empty() && frame.back() == '\r'){
+            frame.remove_suffix(1);
+        }
+        return true;
+    }
+
+    void LineCodec::encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size){
+        buffer.ensureReceivableSize(size + 2);
+        buffer.append(payload,size);
+        if(this->crlf){
+            buffer.append("\r\n",2);
+        }
+        else{
+            buffer.append("\n",1);
+        }
+    }
+
+    FixedSizeCodec::FixedSizeCodec(std::size_t record_size):record_size(record_size){
+        if(record_size == 0){
+            throw Globals::WrongArgument_Error("In FixedSizeCodec::FixedSizeCodec() record_size is 0");
+        }
+    }
+
+    bool FixedSizeCodec::decode(const char* data,std::size_t size,std::string_view& frame,std::size_t& consumed){
+        if(size < this->record_size){
+            return false;
+        }
+        frame = std::string_view(data,this->record_size);
+        consumed = this->record_size;
+        return true;
+    }
+
+    void FixedSizeCodec::encode(CPS::SocketDataBuffer& buffer,const void* payload,std::size_t size){
+        if(size != this->record_size){
+            std::stringstream ss;
+            ss<<"In FixedSizeCodec::encode() payload size "<<size<<" is not the record size "<<this->record_size;
+            throw Globals::WrongArgument_Error(ss.str().c_str());
+        }
+        buffer.append(payload,size);
+    }
+
+    FrameReader::FrameReader(SocketChannel channel,FrameCodec& codec,std::size_t read_size)
+        :channel(channel),buffer(this->channel.getInBuffer()),codec(codec),read_size(read_size){
+        this->codec.reset();
+    }
+
+    bool FrameReader::tryNext(std::string_view& frame){
+        std::size_t consumed = 0;
+        if(!this->codec.decode(this->buffer.readingPos(),this->buffer.getReadableSize(),frame,consumed)){
+            return false;
+        }
+        this->buffer.moveGetPos(consumed);
+        return true;
+    }
+
+    bool FrameReader::next(std::string_view& frame){
+        while(!this->tryNext(frame)){
+            // 只保留不完整的帧，之前的帧已经处理完毕
+            if(this->buffer.getReadableSize() == 0){
+                this->buffer.clear();
+            }
+            else{
+                this->buffer.compact();
+            }
+            this->buffer.ensureReceivableSize(this->read_size);
+            if(this->channel.read() == 0){
+                return false;
+            }
+        }
+        return true;
+    }
+}
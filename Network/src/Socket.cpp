@@ -1,4 +1,6 @@
 #include <Network/Socket.h>
+#include <sstream>
+#include <chrono>
 // #include "Socket.h"
 namespace AntonaStandard::Network{
     /***********Socket*******************
@@ -18,7 +20,6 @@ namespace AntonaStandard::Network{
         if(
             !this->manager || 
             !this->prototype ||
-            !this->bind_or_remote_addr.getImp() ||
             !this->flag){
             throw AntonaStandard::Globals::NullPointer_Error(msg.c_str());
         }
@@ -30,11 +31,58 @@ namespace AntonaStandard::Network{
             this->manager->getSocketFd(),
             CPS::SocketLevel::Socket_level,
             option,
-            value.value_ptr().get(),
+            value.value_ptr(),
             value.size()
         );
     }
 
+    void Socket::setIntOption(CPS::SocketLevel level,CPS::SocketOptions option,int value){
+        if(!this->manager){
+            // 尚未启动，launch 时再设置。同一个选项只保留最后一次设置的值
+            for(auto& pending:this->pending_options){
+                if(pending.level == level && pending.option == option){
+                    pending.value = value;
+                    return;
+                }
+            }
+            this->pending_options.push_back({level,option,value});
+            return;
+        }
+        CPS::SocketLibraryManager::manager().setSocketOption(
+            this->manager->getSocketFd(),
+            level,
+            option,
+            &value,
+            sizeof(value)
+        );
+    }
+
+    int Socket::getIntOption(CPS::SocketLevel level,CPS::SocketOptions option){
+        this->assert_nullptr("Socket::getIntOption(CPS::SocketLevel,CPS::SocketOptions);");
+        int value = 0;
+        socklen_t len = sizeof(value);
+        CPS::SocketLibraryManager::manager().getSocketOption(
+            this->manager->getSocketFd(),
+            level,
+            option,
+            &value,
+            &len
+        );
+        return value;
+    }
+
+    void Socket::apply_pending_options(){
+        for(auto& pending:this->pending_options){
+            CPS::SocketLibraryManager::manager().setSocketOption(
+                this->manager->getSocketFd(),
+                pending.level,
+                pending.option,
+                &pending.value,
+                sizeof(pending.value)
+            );
+        }
+    }
+
     SocketOptionValue Socket::getOption(CPS::SocketOptions option) {
         this->assert_nullptr("Socket::getOption(CPS::SocketOptions);");
         
@@ -57,6 +105,7 @@ namespace AntonaStandard::Network{
         this->prototype = other.prototype;
         this->bind_or_remote_addr = other.bind_or_remote_addr;
         this->flag = other.flag;
+        this->pending_options = other.pending_options;
     }
 
     Socket::Socket(Socket&& other) {
@@ -65,6 +114,7 @@ namespace AntonaStandard::Network{
         swap(this->prototype,other.prototype);
         swap(this->bind_or_remote_addr,other.bind_or_remote_addr);
         swap(this->flag,other.flag);
+        swap(this->pending_options,other.pending_options);
     }
 
     void Socket::launch() {
@@ -74,18 +124,25 @@ namespace AntonaStandard::Network{
     }
 
     void Socket::setReuseAddress(bool option) {
-        SocketOptionValue val(option);
-        this->setOption(
+        // setsockopt 要求整数选项的长度为 sizeof(int)
+        this->setIntOption(
+            CPS::SocketLevel::Socket_level,
             CPS::SocketOptions::ReuseAddress,
-            val
+            option
         );
     }
 
     bool Socket::isReuseAddress() { 
-        auto val = this->getOption(CPS::SocketOptions::ReuseAddress);
-        return *static_cast<bool*>(val.value_ptr().get());
+        return this->getIntOption(CPS::SocketLevel::Socket_level,CPS::SocketOptions::ReuseAddress) != 0;
     }
 
+#ifdef AntonaStandard_PLATFORM_LINUX
+    void Socket::setNonBlocking(bool non_blocking){
+        this->assert_nullptr("Socket::setNonBlocking(bool);");
+        CPS::SocketLibraryManager::manager().setNonBlocking(this->manager->getSocketFd(),non_blocking);
+    }
+#endif
+
     SocketChannel Socket::getChannel(){
         return SocketChannel(this->prototype->copy(this->prototype));
     }
@@ -102,6 +159,16 @@ namespace AntonaStandard::Network{
     */
 
 
+    TCPListenSocket::TCPListenSocket(const CPS::SocketAddress& addr,bool reuse_port):Socket(addr){
+        if(reuse_port){
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            this->setReusePort(true);
+        #else
+            throw AntonaStandard::Globals::UnlawfulOperation_Error("TCPListenSocket: SO_REUSEPORT is not supported on this platform");
+        #endif
+        }
+    }
+
     void TCPListenSocket::launch_stuff(){
         // 创建套接字文件描述符
         CPS::SocketFd fd = CPS::SocketLibraryManager::manager().socket(
@@ -119,6 +186,9 @@ namespace AntonaStandard::Network{
         new_prototype->setAddress(this->get_bind_or_remote_addr());
         new_prototype->setManager(this->getManager());
         this->install_prototype(new_prototype);
+
+        // 端口复用等选项必须在绑定之前设置
+        this->apply_pending_options();
         
         // 绑定地址
         CPS::SocketLibraryManager::manager().bind(
@@ -197,6 +267,9 @@ namespace AntonaStandard::Network{
         new_prototype->setManager(this->getManager());
         this->install_prototype(new_prototype);
 
+        // TCP Fast Open 等选项必须在连接之前设置
+        this->apply_pending_options();
+
         // 连接到服务器
         CPS::SocketLibraryManager::manager().connect(
             fd,
@@ -233,6 +306,9 @@ namespace AntonaStandard::Network{
         new_prototype->setManager(this->getManager());
         this->install_prototype(new_prototype);
 
+        // 端口复用等选项必须在绑定之前设置
+        this->apply_pending_options();
+
         // 绑定到本地地址
         // 绑定地址
         CPS::SocketLibraryManager::manager().bind(
@@ -257,23 +333,19 @@ namespace AntonaStandard::Network{
      */
     
     void SocketOptionValue::setValue(const void* val, socklen_t len) {
-        char* new_val = new char[len];
-        // 拷贝
-        std::memcpy(new_val, val, len);
-        this->val = std::shared_ptr<char>(new_val, [](char*& p) {
-            delete[] p;
-            p = nullptr;
-        });
+        if(len > capacity){
+            std::stringstream ss;
+            ss<<"In SocketOptionValue::setValue() option value of "<<len<<" bytes exceeds the capacity of "<<capacity<<" bytes";
+            throw Globals::WrongArgument_Error(ss.str().c_str());
+        }
+        std::memcpy(this->val, val, len);
+        this->val_size = len;
     }
 
     SocketOptionValue::SocketOptionValue(const void* val, socklen_t len) {
         this->setValue(val,len);
     }
 
-    SocketOptionValue::SocketOptionValue(const SocketOptionValue& val) {
-        this->setValue(val.val.get(),val.size());
-    }
-
     /************SocketChannel*********
      * 
      * 
@@ -322,6 +394,22 @@ namespace AntonaStandard::Network{
         }    
     }
 
+    size_t SocketChannelImp::sendFile(int,std::uint64_t,size_t,const SendFileProgress&){
+        throw Globals::UnlawfulOperation_Error("SocketChannelImp::sendFile() is not supported by this channel");
+    }
+
+    size_t SocketChannelImp::sendZeroCopy(const void*,size_t,ZeroCopyRelease){
+        throw Globals::UnlawfulOperation_Error("SocketChannelImp::sendZeroCopy() is not supported by this channel");
+    }
+
+    size_t SocketChannelImp::writeSegments(std::uint16_t,int){
+        throw Globals::UnlawfulOperation_Error("SocketChannelImp::writeSegments() is not supported by this channel");
+    }
+
+    size_t SocketChannelImp::readSegments(size_t&){
+        throw Globals::UnlawfulOperation_Error("SocketChannelImp::readSegments() is not supported by this channel");
+    }
+
     /************TCPSocketChannelImp*******
      * 
  _____ ____ ____  ____             _        _    ____ _                            _ ___                 
@@ -342,11 +430,12 @@ namespace AntonaStandard::Network{
         );
     }
 
-    size_t TCPSocketChannelImp::write() { 
-        this->assert_nullptr("TCPSocketChannelImp::write();");
+    size_t TCPSocketChannelImp::write(int flags) { 
+        this->assert_nullptr("TCPSocketChannelImp::write(int);");
         auto send_size = CPS::SocketLibraryManager::manager().send(
             this->getManager()->getSocketFd(),
-            this->getOutBuffer()
+            this->getOutBuffer(),
+            flags
         );
         // 清空写缓冲
         this->getOutBuffer().clear();
@@ -354,6 +443,179 @@ namespace AntonaStandard::Network{
     }
 
 
+    size_t TCPSocketChannelImp::sendFile(int file_fd,std::uint64_t offset,size_t length,const SendFileProgress& progress){
+        this->assert_nullptr("TCPSocketChannelImp::sendFile(int,std::uint64_t,size_t,const SendFileProgress&);");
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        size_t sent = 0;
+        while(sent < length){
+            size_t size = CPS::SocketLibraryManager::manager().sendFile(
+                this->getManager()->getSocketFd(),
+                file_fd,
+                offset,
+                std::min(length - sent,send_file_chunk)
+            );
+            if(size == 0){
+                // 非阻塞套接字的发送缓冲区已满
+                break;
+            }
+            sent += size;
+            if(progress){
+                progress(sent,length);
+            }
+        }
+        return sent;
+    #else
+        return SocketChannelImp::sendFile(file_fd,offset,length,progress);
+    #endif
+    }
+
+    size_t TCPSocketChannelImp::sendZeroCopy(const void* data,size_t size,ZeroCopyRelease on_release){
+        this->assert_nullptr("TCPSocketChannelImp::sendZeroCopy(const void*,size_t,ZeroCopyRelease);");
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        auto& manager = CPS::SocketLibraryManager::manager();
+        const CPS::SocketFd& fd = this->getManager()->getSocketFd();
+        if(!this->zerocopy_enabled){
+            int option = 1;
+            manager.setSocketOption(fd,CPS::SocketLevel::Socket_level,CPS::SocketOptions::ZeroCopy,&option,sizeof(option));
+            this->zerocopy_enabled = true;
+        }
+        // 顺便处理已经到达的通知，避免错误队列积压导致 ENOBUFS
+        this->reapZeroCopy();
+        const char* bytes = static_cast<const char*>(data);
+        std::uint32_t first = this->zerocopy_next;
+        // 第一次发送成功后立即登记，发送过程中处理的通知才能对应上；
+        // 登记时多计一个未完成数，保证本次调用返回之前不会被释放
+        auto registered = [this,first]()->PendingZeroCopy*{
+            for(auto it = this->zerocopy_pending.rbegin(); it != this->zerocopy_pending.rend(); ++it){
+                if(it->first == first){
+                    return &*it;
+                }
+            }
+            return nullptr;
+        };
+        size_t sent = 0;
+        while(sent < size){
+            bool notification_full = false;
+            size_t n = manager.sendZeroCopy(fd,bytes + sent,size - sent,notification_full);
+            if(n == 0){
+                if(!notification_full || this->zerocopy_pending.empty()){
+                    // 非阻塞套接字的发送缓冲区已满
+                    break;
+                }
+                // 未处理的通知过多，等待错误队列中的通知到达，处理后继续发送
+                manager.poll(fd,0,-1);
+                this->reapZeroCopy();
+                continue;
+            }
+            if(sent == 0){
+                this->zerocopy_pending.push_back({first,first,2,false,std::move(on_release)});
+            }
+            else{
+                PendingZeroCopy* pending = registered();
+                pending->last = this->zerocopy_next;
+                ++pending->outstanding;
+            }
+            ++this->zerocopy_next;
+            sent += n;
+        }
+        if(sent > 0 && --registered()->outstanding == 0){
+            this->release_zerocopy();
+        }
+        return sent;
+    #else
+        return SocketChannelImp::sendZeroCopy(data,size,std::move(on_release));
+    #endif
+    }
+
+    size_t TCPSocketChannelImp::reapZeroCopy(){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        if(this->zerocopy_pending.empty()){
+            return 0;
+        }
+        this->assert_nullptr("TCPSocketChannelImp::reapZeroCopy();");
+        const CPS::SocketFd& fd = this->getManager()->getSocketFd();
+        CPS::ZeroCopyCompletion completion;
+        bool completed = false;
+        while(CPS::SocketLibraryManager::manager().readZeroCopyCompletion(fd,completion)){
+            // 相对于最早的未释放编号计算，处理 32 位编号的回绕
+            std::uint32_t base = this->zerocopy_pending.front().first;
+            std::uint32_t low = completion.first - base;
+            std::uint32_t high = completion.last - base;
+            for(auto& pending:this->zerocopy_pending){
+                std::uint32_t first = pending.first - base;
+                std::uint32_t last = pending.last - base;
+                if(first > high){
+                    break;
+                }
+                if(last < low){
+                    continue;
+                }
+                pending.outstanding -= std::min(last,high) - std::max(first,low) + 1;
+                pending.copied = pending.copied || completion.copied;
+                completed = completed || pending.outstanding == 0;
+            }
+        }
+        if(!completed){
+            return 0;
+        }
+        return this->release_zerocopy();
+    #else
+        return 0;
+    #endif
+    }
+
+    size_t TCPSocketChannelImp::release_zerocopy(){
+        // 先移出再回调，回调中可以再次发送
+        std::vector<PendingZeroCopy> released;
+        auto it = std::stable_partition(this->zerocopy_pending.begin(),this->zerocopy_pending.end(),[](const PendingZeroCopy& pending){
+            return pending.outstanding == 0;
+        });
+        std::move(this->zerocopy_pending.begin(),it,std::back_inserter(released));
+        this->zerocopy_pending.erase(this->zerocopy_pending.begin(),it);
+        for(auto& pending:released){
+            if(pending.on_release){
+                pending.on_release(pending.copied);
+            }
+        }
+        return released.size();
+    }
+
+    TCPSocketChannelImp::~TCPSocketChannelImp(){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        // 内核可能仍在引用 on_release 所捕获的数据，析构之前尽量等待完成通知
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(zerocopy_linger_ms);
+        try{
+            while(!this->zerocopy_pending.empty() && this->getManager() != nullptr){
+                auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+                if(left <= 0){
+                    break;
+                }
+                this->waitZeroCopy(static_cast<int>(left));
+            }
+        }
+        catch(...){
+            // 套接字已经关闭或者回调抛出异常，析构函数中不能继续传播
+        }
+    #endif
+    }
+
+    size_t TCPSocketChannelImp::waitZeroCopy(int timeout_ms){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        size_t released = this->reapZeroCopy();
+        if(released > 0 || this->zerocopy_pending.empty()){
+            return released;
+        }
+        // 错误队列非空时 poll 返回 POLLERR，不需要关注其它事件
+        if(CPS::SocketLibraryManager::manager().poll(this->getManager()->getSocketFd(),0,timeout_ms) == 0){
+            return 0;
+        }
+        return this->reapZeroCopy();
+    #else
+        return 0;
+    #endif
+    }
+
+
     /************UDPSocketChannelImp*****
      * 
  _   _ ____  ____  ____             _        _    ____ _                            _ ___                 
@@ -374,18 +636,62 @@ namespace AntonaStandard::Network{
         );
     }
 
-    size_t UDPSocketChannelImp::write() { 
-        this->assert_nullptr("UDPSocketChannelImp::write();");
+    size_t UDPSocketChannelImp::write(int flags) { 
+        this->assert_nullptr("UDPSocketChannelImp::write(int);");
         auto send_size = CPS::SocketLibraryManager::manager().sendTo(
             this->getManager()->getSocketFd(),
             this->getOutBuffer(),
-            this->getAddress()
+            this->getAddress(),
+            flags
         );
         // 清空写缓冲
         this->getOutBuffer().clear();
         return send_size;
     }
 
+    size_t UDPSocketChannelImp::writeSegments(std::uint16_t segment_size,int flags){
+        this->assert_nullptr("UDPSocketChannelImp::writeSegments(std::uint16_t,int);");
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        if(segment_size == 0 || segment_size > max_segmented_size){
+            throw Globals::WrongArgument_Error("In UDPSocketChannelImp::writeSegments() segment_size must be in [1,65507]");
+        }
+        // 每次调用发送整数个分段
+        size_t batch = std::min(max_segments,max_segmented_size / segment_size) * segment_size;
+        const char* data = this->getOutBuffer().sendingPos();
+        size_t size = this->getOutBuffer().getSendableSize();
+        size_t sent = 0;
+        while(sent < size){
+            sent += CPS::SocketLibraryManager::manager().sendToSegmented(
+                this->getManager()->getSocketFd(),
+                data + sent,
+                std::min(batch,size - sent),
+                this->getAddress(),
+                segment_size,
+                flags
+            );
+        }
+        // 清空写缓冲
+        this->getOutBuffer().clear();
+        return sent;
+    #else
+        return SocketChannelImp::writeSegments(segment_size,flags);
+    #endif
+    }
+
+    size_t UDPSocketChannelImp::readSegments(size_t& segment_size){
+        this->assert_nullptr("UDPSocketChannelImp::readSegments(size_t&);");
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        return CPS::SocketLibraryManager::manager().receiveFromCoalesced(
+            this->getManager()->getSocketFd(),
+            this->getInBuffer(),
+            this->getAddress(),
+            segment_size
+        );
+    #else
+        return SocketChannelImp::readSegments(segment_size);
+    #endif
+    }
+
     std::shared_ptr<SocketChannelImp> UDPSocketChannelImp::copy(std::shared_ptr<SocketChannelImp> src) {
         // 除了manager其它都要进行深拷贝
         auto ret = std::make_shared<UDPSocketChannelImp>();
@@ -417,6 +723,10 @@ namespace AntonaStandard::Network{
         CPS::SocketLibraryManager::manager().close(this->fd);
     }
 
+    void SocketManager::shutdown(CPS::ShutdownOptions how){
+        CPS::SocketLibraryManager::manager().shutdown(this->fd,how);
+    }
+
     SocketManager::~SocketManager() {
         try {
             this->close();
@@ -0,0 +1,120 @@
+#include <Network/TCPListenerGroup.h>
+#include <chrono>
+#include <optional>
+
+namespace AntonaStandard::Network{
+    TCPListenerGroup::TCPListenerGroup(const CPS::SocketAddress& addr,std::size_t count):address(addr),running(false){
+        if(count == 0){
+            count = std::max(1u,std::thread::hardware_concurrency());
+        }
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        bool reuse_port = true;
+    #else
+        // 没有 SO_REUSEPORT 时多个套接字无法绑定同一个地址
+        bool reuse_port = false;
+        count = 1;
+    #endif
+        this->listeners.reserve(count);
+        for(std::size_t i = 0; i < count; ++i){
+            this->listeners.emplace_back(addr,reuse_port);
+        }
+        this->accepted.reset(new std::atomic<std::size_t>[count]);
+        for(std::size_t i = 0; i < count; ++i){
+            this->accepted[i].store(0,std::memory_order_relaxed);
+        }
+    }
+
+    TCPListenerGroup::~TCPListenerGroup(){
+        this->stop();
+    }
+
+    void TCPListenerGroup::launch(ConnectionHandler handler){
+        // 先检查 acceptors，重复启动时不能修改 running
+        if(!this->acceptors.empty() || this->running.exchange(true,std::memory_order_acq_rel)){
+            throw AntonaStandard::Globals::UnlawfulOperation_Error("TCPListenerGroup::launch(): the group has already been launched");
+        }
+        this->handler = std::move(handler);
+        try{
+            for(std::size_t i = 0; i < this->listeners.size(); ++i){
+                if(i == 1 && this->address.getPort() == 0){
+                    // 其余的监听套接字绑定到系统为第一个监听套接字分配的端口
+                    this->address = CPS::SocketLibraryManager::manager().getLocalAddress(
+                        this->listeners[0].getManager()->getSocketFd());
+                    for(std::size_t j = 1; j < this->listeners.size(); ++j){
+                        this->listeners[j].get_bind_or_remote_addr() = this->address;
+                    }
+                }
+                this->listeners[i].launch();
+            }
+            if(this->address.getPort() == 0){
+                this->address = CPS::SocketLibraryManager::manager().getLocalAddress(
+                    this->listeners[0].getManager()->getSocketFd());
+            }
+        }
+        catch(...){
+            this->running.store(false,std::memory_order_release);
+            for(auto& listener:this->listeners){
+                if(listener.getManager()){
+                    listener.getManager()->close();
+                }
+            }
+            throw;
+        }
+        for(std::size_t i = 0; i < this->listeners.size(); ++i){
+            this->acceptors.emplace_back(&TCPListenerGroup::accept_loop,this,i);
+        }
+    }
+
+    void TCPListenerGroup::stop(){
+        this->running.store(false,std::memory_order_release);
+        for(auto& listener:this->listeners){
+            if(listener.getManager()){
+                try{
+                    listener.getManager()->shutdown(CPS::ShutdownOptions::Read);
+                }
+                catch(std::exception&){
+                    // 套接字已经失效，accept 线程同样会因为错误退出
+                }
+            }
+        }
+        for(auto& acceptor:this->acceptors){
+            if(acceptor.joinable()){
+                acceptor.join();
+            }
+        }
+        for(auto& listener:this->listeners){
+            if(listener.getManager()){
+                listener.getManager()->close();
+            }
+        }
+    }
+
+    void TCPListenerGroup::accept_loop(std::size_t index){
+        TCPListenSocket& listener = this->listeners[index];
+        while(this->running.load(std::memory_order_acquire)){
+            std::optional<TCPSocket> connection;
+            try{
+                connection.emplace(listener.accept());
+            }
+            catch(std::exception&){
+                if(!this->running.load(std::memory_order_acquire)){
+                    return;
+                }
+                // 例如文件描述符耗尽，稍后重试，避免空转
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                continue;
+            }
+            this->accepted[index].fetch_add(1,std::memory_order_relaxed);
+            try{
+                this->handler(std::move(*connection));
+            }
+            catch(std::exception& e){
+                std::cerr<<"TCPListenerGroup: connection handler failed: "<<e.what()<<std::endl;
+            }
+            catch(...){
+                // 异常逃出线程函数会调用 std::terminate
+                std::cerr<<"TCPListenerGroup: connection handler failed with an exception of unknown type"<<std::endl;
+            }
+        }
+    }
+}
@@ -0,0 +1,289 @@
+#include <Network/TCPServer.h>
+#include <algorithm>
+#include <thread>
+
+namespace AntonaStandard::Network{
+    TCPConnection::TCPConnection(EventLoop& loop,TCPSocket socket,std::shared_ptr<const TCPConnectionHandlers> handlers,std::size_t read_size,
+        std::chrono::milliseconds idle_timeout)
+        :loop(loop),socket(socket),fd(socket.getManager()->getSocketFd()),
+        in_buffer(this->socket.getChannel().getInBuffer()),out_buffer(this->socket.getChannel().getOutBuffer()),
+        handlers(std::move(handlers)),offloads(nullptr),read_size(read_size),idle_timeout(idle_timeout),idle_timer(0),connected(false),writing(false){
+        this->in_buffer.clear();
+        this->out_buffer.clear();
+    }
+
+    void TCPConnection::start(){
+        this->connected = true;
+        this->loop.watch(this->fd,IOEvents::Readable,[this](std::uint32_t events){
+            this->handle_events(events);
+        });
+        if(this->idle_timeout.count() > 0){
+            // 定时器只持有弱引用，连接关闭时取消定时器
+            std::weak_ptr<TCPConnection> weak = this->shared_from_this();
+            this->idle_timer = this->loop.runAfter(this->idle_timeout,[weak](){
+                if(TCPConnectionPtr self = weak.lock()){
+                    self->idle_timer = 0;
+                    self->handle_close();
+                }
+            });
+        }
+        if(this->handlers->on_connect){
+            this->handlers->on_connect(this->shared_from_this());
+        }
+    }
+
+    void TCPConnection::handle_events(std::uint32_t events){
+        // 回调中可能关闭连接，保证处理期间连接不会被销毁
+        TCPConnectionPtr self = this->shared_from_this();
+        if(events & IOEvents::Readable){
+            this->handle_read();
+        }
+        if(this->connected && (events & IOEvents::Writable)){
+            this->flush();
+        }
+        if(this->connected && (events & IOEvents::Hangup) && !(events & IOEvents::Readable)){
+            this->handle_close();
+        }
+    }
+
+    void TCPConnection::handle_read(){
+        // 已经处理完的数据不再保留，不完整的消息移动到缓冲区开头
+        if(this->in_buffer.getReadableSize() == 0){
+            this->in_buffer.clear();
+        }
+        else{
+            this->in_buffer.compact();
+        }
+        this->in_buffer.ensureReceivableSize(this->read_size);
+        std::size_t size = 0;
+        try{
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            if(!CPS::SocketLibraryManager::manager().tryReceive(this->socket.getManager()->getSocketFd(),this->in_buffer,size)){
+                return;
+            }
+        #endif
+        }
+        catch(std::exception&){
+            // 连接被重置等错误，与对端关闭一样处理
+            this->handle_close();
+            return;
+        }
+        if(size == 0){
+            this->handle_close();
+            return;
+        }
+        if(this->idle_timer != 0){
+            // 时间轮中重新计时是 O(1) 的，每次读到数据都推迟空闲超时
+            this->loop.restartTimer(this->idle_timer,this->idle_timeout);
+        }
+        if(this->handlers->on_message){
+            this->handlers->on_message(this->shared_from_this(),this->in_buffer);
+        }
+        else{
+            this->in_buffer.clear();
+        }
+    }
+
+    void TCPConnection::flush(){
+        try{
+        #ifdef AntonaStandard_PLATFORM_LINUX
+            while(this->out_buffer.getReadableSize() > 0){
+                std::size_t size = CPS::SocketLibraryManager::manager().trySend(
+                    this->socket.getManager()->getSocketFd(),this->out_buffer.readingPos(),this->out_buffer.getReadableSize(),CPS::MessageFlags::NoSignal);
+                if(size == 0){
+                    break;
+                }
+                this->out_buffer.moveGetPos(size);
+            }
+        #endif
+        }
+        catch(std::exception&){
+            this->handle_close();
+            return;
+        }
+        std::size_t readable = this->out_buffer.getReadableSize();
+        bool pending = readable > 0;
+        if(!pending){
+            this->out_buffer.clear();
+        }
+        else if(this->out_buffer.getSendableSize() - readable >= readable){
+            // 已经发送的部分占了一半以上时压缩，持续有数据等待发送时写缓冲区不会无限增长
+            this->out_buffer.compact();
+        }
+        // 只在有数据等待发送时关注可写事件，否则水平触发的可写事件会让事件循环空转
+        if(pending != this->writing){
+            this->writing = pending;
+            this->loop.modify(this->fd,pending ? (IOEvents::Readable | IOEvents::Writable) : IOEvents::Readable);
+        }
+    }
+
+    void TCPConnection::handle_close(){
+        if(!this->connected){
+            return;
+        }
+        this->connected = false;
+        TCPConnectionPtr self = this->shared_from_this();
+        this->loop.unwatch(this->fd);
+        if(this->idle_timer != 0){
+            this->loop.cancelTimer(this->idle_timer);
+            this->idle_timer = 0;
+        }
+        if(this->handlers->on_close){
+            this->handlers->on_close(self);
+        }
+        try{
+            this->socket.close();
+        }
+        catch(std::exception&){
+            // 连接已经不再使用，关闭失败也没有补救的办法
+        }
+        this->in_buffer.clear();
+        this->out_buffer.clear();
+        if(this->on_removed){
+            this->on_removed(self);
+        }
+    }
+
+    void TCPConnection::send(const void* data,std::size_t size){
+        if(!this->loop.isInLoopThread()){
+            TCPConnectionPtr self = this->shared_from_this();
+            std::string copy(static_cast<const char*>(data),size);
+            this->loop.post([self,copy = std::move(copy)](){
+                self->send(copy.data(),copy.size());
+            });
+            return;
+        }
+        if(!this->connected || size == 0){
+            return;
+        }
+        this->out_buffer.append(data,size);
+        if(!this->writing){
+            this->flush();
+        }
+    }
+
+    void TCPConnection::close(){
+        TCPConnectionPtr self = this->shared_from_this();
+        this->loop.dispatch([self](){
+            self->handle_close();
+        });
+    }
+
+    TCPServer::TCPServer(const CPS::SocketAddress& addr,TCPServerOptions options)
+        :options(options),listeners(addr,options.listeners),handlers(std::make_shared<TCPConnectionHandlers>()),
+        next_slot(0),running(false){
+        if(this->options.loops == 0){
+            this->options.loops = std::max(1u,std::thread::hardware_concurrency());
+        }
+    }
+
+    TCPServer::~TCPServer(){
+        this->stop();
+    }
+
+    TCPServer::LoopSlot& TCPServer::select_slot(){
+        if(this->options.balance == LoopBalance::LeastConnections){
+            LoopSlot* best = this->slots.front().get();
+            for(auto& slot:this->slots){
+                if(slot->load.load(std::memory_order_relaxed) < best->load.load(std::memory_order_relaxed)){
+                    best = slot.get();
+                }
+            }
+            return *best;
+        }
+        return *this->slots[this->next_slot.fetch_add(1,std::memory_order_relaxed) % this->slots.size()];
+    }
+
+    void TCPServer::accept(TCPSocket socket){
+    #ifdef AntonaStandard_PLATFORM_LINUX
+        socket.setNonBlocking(true);
+    #endif
+        LoopSlot& slot = this->select_slot();
+        // 在投递之前计数，连续到来的连接不会都分配给同一个事件循环
+        slot.load.fetch_add(1,std::memory_order_relaxed);
+        LoopSlot* target = &slot;
+        std::shared_ptr<const TCPConnectionHandlers> handlers = this->handlers;
+        std::size_t read_size = this->options.read_size;
+        std::chrono::milliseconds idle_timeout = this->options.idle_timeout;
+        slot.loop.post([target,socket,handlers,read_size,idle_timeout](){
+            auto connection = std::make_shared<TCPConnection>(target->loop,socket,handlers,read_size,idle_timeout);
+            connection->on_removed = [target](const TCPConnectionPtr& removed){
+                target->connections.erase(removed.get());
+                target->load.fetch_sub(1,std::memory_order_relaxed);
+            };
+            connection->offloads = &target->offloads;
+            target->connections.emplace(connection.get(),connection);
+            try{
+                connection->start();
+            }
+            catch(...){
+                connection->handle_close();
+                throw;
+            }
+        });
+    }
+
+    void TCPServer::launch(){
+        // 先检查 slots，重复启动时不能修改 running
+        if(!this->slots.empty() || this->running.exchange(true,std::memory_order_acq_rel)){
+            throw Globals::UnlawfulOperation_Error("TCPServer::launch(): the server has already been launched");
+        }
+        try{
+            for(std::size_t i = 0; i < this->options.loops; ++i){
+                this->slots.push_back(std::make_unique<LoopSlot>());
+            }
+            for(auto& slot:this->slots){
+                LoopSlot* target = slot.get();
+                slot->thread = std::thread([target](){
+                    target->loop.run();
+                });
+            }
+            this->listeners.launch([this](TCPSocket socket){
+                this->accept(socket);
+            });
+        }
+        catch(...){
+            for(auto& slot:this->slots){
+                slot->loop.stop();
+                if(slot->thread.joinable()){
+                    slot->thread.join();
+                }
+            }
+            // 清空事件循环，之后可以重新启动
+            this->slots.clear();
+            this->running.store(false,std::memory_order_release);
+            throw;
+        }
+    }
+
+    void TCPServer::stop(){
+        if(!this->running.exchange(false,std::memory_order_acq_rel)){
+            return;
+        }
+        // 先停止 accept，之后不会再有新连接投递到事件循环
+        this->listeners.stop();
+        for(auto& slot:this->slots){
+            LoopSlot* target = slot.get();
+            target->loop.post([target](){
+                std::vector<TCPConnectionPtr> connections;
+                connections.reserve(target->connections.size());
+                for(auto& item:target->connections){
+                    connections.push_back(item.second);
+                }
+                for(auto& connection:connections){
+                    connection->handle_close();
+                }
+            });
+            target->loop.stop();
+        }
+        for(auto& slot:this->slots){
+            if(slot->thread.joinable()){
+                slot->thread.join();
+            }
+            // 线程池中的计算还会向事件循环投递结果，等待它们结束
+            while(slot->offloads.load(std::memory_order_acquire) > 0){
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+}
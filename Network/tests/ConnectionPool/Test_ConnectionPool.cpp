@@ -0,0 +1,254 @@
+#include <gtest/gtest.h>
+#include <Network/ConnectionPool.h>
+#include <NetworkTesting.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+namespace {
+    // 环回地址上的回声服务器，每个连接一个线程
+    class EchoServer{
+    private:
+        Network::TCPListenSocket listener;
+        std::mutex mtx;
+        std::vector<Network::TCPSocket> connections;
+        std::vector<std::thread> workers;
+        std::thread acceptor;
+        std::atomic<size_t> accepted{0};
+
+        static void echo(Network::TCPSocket socket){
+            Network::SocketChannel channel = socket.getChannel();
+            try{
+                while(channel.read() != 0){
+                    auto& in = channel.getInBuffer();
+                    channel.getOutBuffer().append(in.readingPos(), in.getReadableSize());
+                    in.clear();
+                    channel.write();
+                }
+            }
+            catch(std::exception&){
+                // 连接被测试主动关闭
+            }
+        }
+    public:
+        CPS::SocketAddress address;
+
+        EchoServer()
+            :listener(CPS::SocketAddress::loopBackAddress(0)),
+            address(CPS::SocketAddress::loopBackAddress(launch_listener(listener))){
+            this->acceptor = std::thread([this](){
+                while(true){
+                    try{
+                        Network::TCPSocket socket = this->listener.accept();
+                        std::lock_guard<std::mutex> lck(this->mtx);
+                        ++this->accepted;
+                        this->connections.push_back(socket);
+                        this->workers.emplace_back(&EchoServer::echo, socket);
+                    }
+                    catch(std::exception&){
+                        return;
+                    }
+                }
+            });
+        }
+        ~EchoServer(){
+            this->listener.getManager()->shutdown(CPS::ShutdownOptions::Read);
+            this->acceptor.join();
+            this->dropAll();
+            for(auto& worker:this->workers){
+                worker.join();
+            }
+        }
+        // 服务端关闭所有连接，客户端的空闲连接随之失效
+        void dropAll(){
+            std::lock_guard<std::mutex> lck(this->mtx);
+            for(auto& socket:this->connections){
+                try{
+                    socket.getManager()->shutdown(CPS::ShutdownOptions::Both);
+                }
+                catch(std::exception&){
+                }
+            }
+        }
+        size_t getAcceptedCount(){
+            return this->accepted.load();
+        }
+    };
+
+    std::string request(Network::PooledConnection& connection, const std::string& message){
+        Network::SocketChannel channel = connection.getChannel();
+        channel.getOutBuffer().append(message.data(), message.size());
+        channel.write();
+        auto& in = channel.getInBuffer();
+        while(in.getReadableSize() < message.size()){
+            if(channel.read() == 0){
+                break;
+            }
+        }
+        std::string reply(in.readingPos(), in.getReadableSize());
+        in.clear();
+        return reply;
+    }
+}
+
+TEST(Test_ConnectionPool, ReusesConnections){
+    EchoServer server;
+    Network::ConnectionPool pool;
+    for(int i = 0; i < 100; ++i){
+        auto connection = pool.acquire(server.address);
+        EXPECT_EQ(i != 0, connection.isReused());
+        std::string message = "request " + std::to_string(i);
+        EXPECT_EQ(message, request(connection, message));
+        EXPECT_EQ(1u, pool.getLeasedCount(server.address));
+    }
+    EXPECT_EQ(1u, pool.getCreatedCount());
+    EXPECT_EQ(99u, pool.getReusedCount());
+    EXPECT_EQ(1u, pool.getIdleCount(server.address));
+    EXPECT_EQ(0u, pool.getLeasedCount(server.address));
+    EXPECT_EQ(1u, server.getAcceptedCount());
+
+    // 被标记为损坏的连接不会回到连接池
+    {
+        auto connection = pool.acquire(server.address);
+        connection.markBroken();
+    }
+    EXPECT_EQ(0u, pool.getIdleCount(server.address));
+    EXPECT_EQ(1u, pool.getDiscardedCount());
+
+    // 提前归还之后不能再使用
+    auto connection = pool.acquire(server.address);
+    EXPECT_FALSE(connection.isReused());
+    connection.release();
+    EXPECT_FALSE(connection.isValid());
+    EXPECT_THROW(connection.getSocket(), Globals::NullPointer_Error);
+    EXPECT_EQ(1u, pool.getIdleCount());
+}
+
+TEST(Test_ConnectionPool, PerHostLimit){
+    EchoServer server;
+    Network::ConnectionPoolOptions options;
+    options.max_per_host = 2;
+    options.acquire_timeout = std::chrono::milliseconds(100);
+    Network::ConnectionPool pool(options);
+
+    auto first = pool.acquire(server.address);
+    auto second = pool.acquire(server.address);
+    EXPECT_EQ(2u, pool.getLeasedCount(server.address));
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_THROW(pool.acquire(server.address), std::runtime_error);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+    // 等待中的线程被归还的连接唤醒
+    Network::ConnectionPoolOptions waiting_options = options;
+    waiting_options.acquire_timeout = std::chrono::milliseconds(5000);
+    Network::ConnectionPool waiting_pool(waiting_options);
+    auto held = std::make_unique<Network::PooledConnection>(waiting_pool.acquire(server.address));
+    auto other = waiting_pool.acquire(server.address);
+    std::thread releaser([&](){
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        held.reset();
+    });
+    auto connection = waiting_pool.acquire(server.address);
+    EXPECT_TRUE(connection.isReused());
+    EXPECT_EQ("ping", request(connection, "ping"));
+    releaser.join();
+    EXPECT_EQ(2u, waiting_pool.getCreatedCount());
+}
+
+TEST(Test_ConnectionPool, IdleLimits){
+    EchoServer server;
+    Network::ConnectionPoolOptions options;
+    options.max_idle_per_host = 2;
+    Network::ConnectionPool pool(options);
+    {
+        std::vector<Network::PooledConnection> connections;
+        for(int i = 0; i < 4; ++i){
+            connections.push_back(pool.acquire(server.address));
+        }
+    }
+    EXPECT_EQ(2u, pool.getIdleCount(server.address));
+    EXPECT_EQ(2u, pool.getDiscardedCount());
+
+    // 单个分片最多保留 2 个空闲连接，新归还的连接挤掉最久没有使用的连接
+    EchoServer other;
+    Network::ConnectionPoolOptions lru_options;
+    lru_options.shards = 1;
+    lru_options.max_idle = 2;
+    Network::ConnectionPool lru_pool(lru_options);
+    {
+        auto a = lru_pool.acquire(server.address);
+        auto b = lru_pool.acquire(server.address);
+        a.release();
+        b.release();
+        auto c = lru_pool.acquire(other.address);
+    }
+    EXPECT_EQ(2u, lru_pool.getIdleCount());
+    EXPECT_EQ(1u, lru_pool.getIdleCount(server.address));
+    EXPECT_EQ(1u, lru_pool.getIdleCount(other.address));
+    EXPECT_EQ(1u, lru_pool.getDiscardedCount());
+
+    lru_pool.clear();
+    EXPECT_EQ(0u, lru_pool.getIdleCount());
+}
+
+TEST(Test_ConnectionPool, DiscardsStaleConnections){
+    EchoServer server;
+    Network::ConnectionPool pool;
+    {
+        auto connection = pool.acquire(server.address);
+        EXPECT_EQ("hello", request(connection, "hello"));
+    }
+    server.dropAll();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto connection = pool.acquire(server.address);
+    EXPECT_FALSE(connection.isReused());
+    EXPECT_EQ(1u, pool.getDiscardedCount());
+    EXPECT_EQ("again", request(connection, "again"));
+    connection.release();
+
+    // 空闲超时的连接在 prune 时关闭
+    Network::ConnectionPoolOptions options;
+    options.idle_timeout = std::chrono::milliseconds(20);
+    Network::ConnectionPool short_pool(options);
+    {
+        auto first = short_pool.acquire(server.address);
+        auto second = short_pool.acquire(server.address);
+    }
+    EXPECT_EQ(0u, short_pool.prune());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(2u, short_pool.prune());
+    EXPECT_EQ(0u, short_pool.getIdleCount());
+}
+
+TEST(Test_ConnectionPool, ConcurrentBorrowing){
+    EchoServer server;
+    Network::ConnectionPoolOptions options;
+    options.max_per_host = 3;
+    Network::ConnectionPool pool(options);
+    std::atomic<int> mismatches{0};
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t){
+        threads.emplace_back([&, t](){
+            for(int i = 0; i < 50; ++i){
+                auto connection = pool.acquire(server.address);
+                std::string message = std::to_string(t) + ":" + std::to_string(i);
+                if(request(connection, message) != message){
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for(auto& thread:threads){
+        thread.join();
+    }
+    EXPECT_EQ(0, mismatches.load());
+    EXPECT_LE(pool.getCreatedCount(), 3u);
+    EXPECT_EQ(200u, pool.getCreatedCount() + pool.getReusedCount());
+    EXPECT_EQ(0u, pool.getLeasedCount(server.address));
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <Network/FrameCodec.h>
+#include <NetworkTesting.h>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+namespace {
+    std::string to_string(const CPS::SocketDataBuffer& buffer){
+        return std::string(buffer.sendingPos(), buffer.getSendableSize());
+    }
+
+    // 依次解码 data 中的所有帧，每一帧都先确认少一个字节时解码失败
+    std::vector<std::string> decode_all(Network::FrameCodec& codec, const std::string& data){
+        std::vector<std::string> frames;
+        size_t offset = 0;
+        while(offset < data.size()){
+            std::string_view frame;
+            size_t consumed = 0;
+            size_t size = 1;
+            while(!codec.decode(data.data() + offset, size, frame, consumed)){
+                ++size;
+                if(offset + size > data.size()){
+                    return frames;
+                }
+            }
+            EXPECT_EQ(size, consumed);
+            frames.emplace_back(frame);
+            offset += consumed;
+        }
+        return frames;
+    }
+}
+
+TEST(Test_FrameCodec, CompactKeepsUnread){
+    CPS::SocketDataBuffer buffer;
+    buffer.append("abcdef", 6);
+    buffer.moveGetPos(4);
+    buffer.compact();
+    EXPECT_EQ(2u, buffer.getReadableSize());
+    EXPECT_EQ(buffer.sendingPos(), buffer.readingPos());
+    EXPECT_EQ("ef", to_string(buffer));
+    buffer.append("gh", 2);
+    EXPECT_EQ("efgh", std::string(buffer.readingPos(), buffer.getReadableSize()));
+}
+
+TEST(Test_FrameCodec, LengthPrefix){
+    std::vector<std::string> payloads{"", "a", std::string(127, 'b'), std::string(128, 'c'), std::string(300, 'd'), std::string(70000, 'e')};
+    for(auto prefix:{Network::LengthPrefix::Varint, Network::LengthPrefix::Fixed16, Network::LengthPrefix::Fixed32, Network::LengthPrefix::Fixed64}){
+        Network::LengthPrefixCodec codec(prefix);
+        CPS::SocketDataBuffer buffer;
+        std::vector<std::string> expected;
+        for(auto& payload:payloads){
+            if(prefix == Network::LengthPrefix::Fixed16 && payload.size() > 0xffff){
+                EXPECT_THROW(codec.encode(buffer, payload), Globals::Overflow_Error);
+                continue;
+            }
+            codec.encode(buffer, payload);
+            expected.push_back(payload);
+        }
+        EXPECT_EQ(expected, decode_all(codec, to_string(buffer)));
+    }
+
+    // varint 编码与 protobuf 一致
+    Network::LengthPrefixCodec varint;
+    CPS::SocketDataBuffer buffer;
+    varint.encode(buffer, std::string(300, 'x'));
+    EXPECT_EQ("\xac\x02", to_string(buffer).substr(0, 2));
+
+    Network::LengthPrefixCodec fixed(Network::LengthPrefix::Fixed32);
+    buffer.clear();
+    fixed.encode(buffer, "hi");
+    EXPECT_EQ(std::string("\0\0\0\2hi", 6), to_string(buffer));
+
+    // 超过上限的长度和格式错误的 varint
+    Network::LengthPrefixCodec limited(Network::LengthPrefix::Varint, 100);
+    std::string_view frame;
+    size_t consumed = 0;
+    EXPECT_THROW(limited.decode("\xc8\x01", 2, frame, consumed), Globals::Overflow_Error);
+    std::string corrupted(10, '\x80');
+    EXPECT_THROW(limited.decode(corrupted.data(), corrupted.size(), frame, consumed), Globals::DataCorrupted_Error);
+    // 第 10 个字节大于 1 时超出 64 位，不能截断为较小的长度
+    std::string too_wide = std::string(9, '\xff') + '\x02';
+    EXPECT_THROW(limited.decode(too_wide.data(), too_wide.size(), frame, consumed), Globals::DataCorrupted_Error);
+    too_wide = std::string(9, '\x80') + '\x7e';
+    EXPECT_THROW(limited.decode(too_wide.data(), too_wide.size(), frame, consumed), Globals::DataCorrupted_Error);
+    std::string widest = std::string(9, '\xff') + '\x01';
+    EXPECT_THROW(limited.decode(widest.data(), widest.size(), frame, consumed), Globals::Overflow_Error);
+}
+
+TEST(Test_FrameCodec, Delimiter){
+    Network::DelimiterCodec codec("\r\n", 16);
+    std::string data = "hello\r\nworld";
+    std::string_view frame;
+    size_t consumed = 0;
+    EXPECT_FALSE(codec.decode(data.data(), 5, frame, consumed));
+    // 末尾的 \r 可能是分隔符的开头
+    EXPECT_FALSE(codec.decode(data.data(), 6, frame, consumed));
+    ASSERT_TRUE(codec.decode(data.data(), data.size(), frame, consumed));
+    EXPECT_EQ("hello", frame);
+    EXPECT_EQ(7u, consumed);
+    EXPECT_FALSE(codec.decode(data.data() + 7, 5, frame, consumed));
+
+    codec.reset();
+    std::string overlong(20, 'x');
+    EXPECT_THROW(codec.decode(overlong.data(), overlong.size(), frame, consumed), Globals::Overflow_Error);
+    EXPECT_THROW(Network::DelimiterCodec(""), Globals::WrongArgument_Error);
+
+    CPS::SocketDataBuffer buffer;
+    Network::DelimiterCodec pipe("||");
+    pipe.encode(buffer, "a");
+    pipe.encode(buffer, "");
+    pipe.encode(buffer, "bc");
+    EXPECT_EQ("a||||bc||", to_string(buffer));
+    EXPECT_EQ(std::vector<std::string>({"a", "", "bc"}), decode_all(pipe, to_string(buffer)));
+}
+
+TEST(Test_FrameCodec, LinesAndRecords){
+    Network::LineCodec lines;
+    EXPECT_EQ(std::vector<std::string>({"GET / HTTP/1.1", "Host: x", "", "tail"}),
+        decode_all(lines, "GET / HTTP/1.1\r\nHost: x\n\r\ntail\n"));
+    CPS::SocketDataBuffer buffer;
+    Network::LineCodec crlf(true);
+    crlf.encode(buffer, "a");
+    lines.encode(buffer, "b");
+    EXPECT_EQ("a\r\nb\n", to_string(buffer));
+
+    Network::FixedSizeCodec records(3);
+    EXPECT_EQ(std::vector<std::string>({"abc", "def"}), decode_all(records, "abcdefg"));
+    buffer.clear();
+    records.encode(buffer, "xyz");
+    EXPECT_EQ("xyz", to_string(buffer));
+    EXPECT_THROW(records.encode(buffer, "xy"), Globals::WrongArgument_Error);
+    EXPECT_THROW(Network::FixedSizeCodec(0), Globals::WrongArgument_Error);
+}
+
+TEST(Test_FrameCodec, ReaderOverTcp){
+    LoopbackPair pair;
+    std::mt19937 engine(2024);
+    std::vector<std::string> payloads;
+    CPS::SocketDataBuffer encoded;
+    Network::LengthPrefixCodec writer_codec;
+    for(int i = 0; i < 2000; ++i){
+        std::string payload(engine() % 3000, '\0');
+        for(auto& c:payload){
+            c = static_cast<char>(engine());
+        }
+        writer_codec.encode(encoded, payload);
+        payloads.push_back(std::move(payload));
+    }
+
+    // 以随机的块大小写出，帧会跨越多次读取
+    std::thread writer([&](){
+        Network::SocketChannel channel = pair.server->getChannel();
+        std::mt19937 chunks(7);
+        std::string data = to_string(encoded);
+        size_t offset = 0;
+        while(offset < data.size()){
+            size_t size = std::min<size_t>(1 + chunks() % 5000, data.size() - offset);
+            channel.getOutBuffer().append(data.data() + offset, size);
+            offset += channel.write();
+        }
+        pair.server->close();
+    });
+
+    Network::LengthPrefixCodec reader_codec;
+    Network::FrameReader reader(pair.client.getChannel(), reader_codec, 4096);
+    std::string_view frame;
+    size_t count = 0;
+    while(reader.next(frame)){
+        ASSERT_LT(count, payloads.size());
+        ASSERT_EQ(payloads[count], frame)<<count;
+        ++count;
+    }
+    writer.join();
+    EXPECT_EQ(payloads.size(), count);
+    EXPECT_EQ(0u, reader.getBufferedSize());
+}
+
+TEST(Test_FrameCodec, LinesOverTcp){
+    LoopbackPair pair;
+    Network::SocketChannel channel = pair.server->getChannel();
+    channel.getOutBuffer().append("first\r\nsecond\nthi", 17);
+    channel.write();
+
+    Network::LineCodec codec;
+    Network::FrameReader reader(pair.client.getChannel(), codec);
+    std::string_view frame;
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ("first", frame);
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ("second", frame);
+    EXPECT_FALSE(reader.tryNext(frame));
+
+    channel.getOutBuffer().append("rd\n", 3);
+    channel.write();
+    ASSERT_TRUE(reader.next(frame));
+    EXPECT_EQ("third", frame);
+
+    // 不完整的最后一行
+    channel.getOutBuffer().append("partial", 7);
+    channel.write();
+    pair.server->close();
+    EXPECT_FALSE(reader.next(frame));
+    EXPECT_EQ(7u, reader.getBufferedSize());
+}
@@ -0,0 +1,79 @@
+#ifndef TEST_NETWORK_NETWORKTESTING_H
+#define TEST_NETWORK_NETWORKTESTING_H
+
+// Network 各个测试共用的辅助函数
+#include <Network/Socket.h>
+#include <algorithm>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace NetworkTesting{
+    using namespace AntonaStandard;
+
+    // 等待条件成立，超时返回 false
+    template<typename type_Pred>
+    bool wait_for(type_Pred pred){
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while(!pred()){
+            if(std::chrono::steady_clock::now() > deadline){
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    // 启动监听套接字，返回实际绑定的端口
+    inline unsigned short launch_listener(Network::TCPListenSocket& listener){
+        listener.launch();
+        return CPS::SocketLibraryManager::manager().getLocalAddress(listener.getManager()->getSocketFd()).getPort();
+    }
+
+    // 在环回地址上建立一对连接好的TCP套接字，connect_now 为 false 时可以在 connect 之前设置客户端的选项
+    struct LoopbackPair{
+        Network::TCPListenSocket listener;
+        Network::TCPSocket client;
+        std::optional<Network::TCPSocket> server;
+
+        explicit LoopbackPair(bool connect_now = true)
+            :listener(CPS::SocketAddress::loopBackAddress(0)),
+            client(CPS::SocketAddress::loopBackAddress(launch_listener(listener))){
+            if(connect_now){
+                this->connect();
+            }
+        }
+        void connect(){
+            this->client.launch();
+            this->server.emplace(this->listener.accept());
+        }
+    };
+
+    // 阻塞地从通道读取，直到读到 size 字节或者连接关闭；多读到的数据留在读缓冲区中供下次读取
+    inline std::string read_exactly(Network::SocketChannel channel, size_t size){
+        auto& in = channel.getInBuffer();
+        while(in.getReadableSize() < size){
+            in.ensureReceivableSize(64 << 10);
+            if(channel.read() == 0){
+                break;
+            }
+        }
+        std::string data(in.readingPos(), std::min(size, in.getReadableSize()));
+        in.moveGetPos(data.size());
+        return data;
+    }
+    inline std::string read_exactly(Network::TCPSocket& socket, size_t size){
+        return read_exactly(socket.getChannel(), size);
+    }
+
+    // 连接到环回地址上的服务端，type_Server 需要提供 getAddress()
+    template<typename type_Server>
+    Network::TCPSocket connect_to(const type_Server& server){
+        Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(server.getAddress().getPort()));
+        client.launch();
+        return client;
+    }
+}
+
+#endif
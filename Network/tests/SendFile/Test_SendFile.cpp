@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <Network/Socket.h>
+#include <NetworkTesting.h>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef AntonaStandard_PLATFORM_LINUX
+#include <unistd.h>
+
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+namespace {
+    // 写入随机内容的临时文件，析构时自动删除
+    struct TempFile{
+        FILE* file;
+        std::string content;
+
+        explicit TempFile(size_t size):file(std::tmpfile()),content(size, '\0'){
+            std::mt19937 engine(2024);
+            for(auto& c:this->content){
+                c = static_cast<char>(engine());
+            }
+            std::fwrite(this->content.data(), 1, this->content.size(), this->file);
+            std::fflush(this->file);
+        }
+        ~TempFile(){
+            std::fclose(this->file);
+        }
+        int fd()const{
+            return fileno(this->file);
+        }
+    };
+}
+
+TEST(Test_SendFile, BlockingWholeFile){
+    TempFile file(3 * Network::TCPSocketChannelImp::send_file_chunk + 12345);
+    LoopbackPair pair;
+    std::string received;
+    std::thread reader([&](){
+        received = read_exactly(pair.server->getChannel(), file.content.size());
+    });
+
+    std::vector<size_t> progress;
+    size_t sent = pair.client.getChannel().sendFile(file.fd(), 0, file.content.size(), [&](size_t done, size_t total){
+        EXPECT_EQ(file.content.size(), total);
+        progress.push_back(done);
+    });
+    reader.join();
+    EXPECT_EQ(file.content.size(), sent);
+    EXPECT_TRUE(received == file.content);
+    // 按块报告进度，最后一次为全部发送完成
+    ASSERT_GE(progress.size(), 4u);
+    EXPECT_EQ(file.content.size(), progress.back());
+    EXPECT_TRUE(std::is_sorted(progress.begin(), progress.end()));
+}
+
+TEST(Test_SendFile, RangeAndErrors){
+    TempFile file(100000);
+    LoopbackPair pair;
+    Network::SocketChannel channel = pair.client.getChannel();
+    EXPECT_EQ(1000u, channel.sendFile(file.fd(), 5000, 1000));
+    EXPECT_EQ(file.content.substr(5000, 1000), read_exactly(pair.server->getChannel(), 1000));
+    EXPECT_EQ(0u, channel.sendFile(file.fd(), 0, 0));
+
+    // 文件比请求的区间短
+    EXPECT_THROW(channel.sendFile(file.fd(), 99000, 2000), std::runtime_error);
+
+    // UDP 通道不支持
+    Network::UDPSocket udp(CPS::SocketAddress::loopBackAddress(0));
+    udp.launch();
+    EXPECT_THROW(udp.getChannel().sendFile(file.fd(), 0, 10), Globals::UnlawfulOperation_Error);
+}
+
+TEST(Test_SendFile, NonBlockingResumes){
+    TempFile file(8 << 20);
+    LoopbackPair pair;
+    pair.client.setSendBufferSize(64 * 1024);
+    pair.client.setNonBlocking(true);
+    Network::SocketChannel channel = pair.client.getChannel();
+
+    // 对端还没有读取，发送缓冲区很快被填满，只发送了一部分
+    size_t first = channel.sendFile(file.fd(), 0, file.content.size());
+    EXPECT_GT(first, 0u);
+    EXPECT_LT(first, file.content.size());
+
+    std::string received;
+    std::thread reader([&](){
+        received = read_exactly(pair.server->getChannel(), file.content.size());
+    });
+    size_t sent = first;
+    while(sent < file.content.size()){
+        size_t size = channel.sendFile(file.fd(), sent, file.content.size() - sent);
+        if(size == 0){
+            std::this_thread::yield();
+        }
+        sent += size;
+    }
+    reader.join();
+    EXPECT_TRUE(received == file.content);
+}
+
+TEST(Test_SendFile, SpliceFromPipe){
+    int pipe_fds[2];
+    ASSERT_EQ(0, ::pipe(pipe_fds));
+    std::string message = "spliced through a pipe";
+    ASSERT_EQ(static_cast<ssize_t>(message.size()), ::write(pipe_fds[1], message.data(), message.size()));
+
+    LoopbackPair pair;
+    // 管道没有偏移量，offset 被忽略
+    EXPECT_EQ(message.size(), pair.client.getChannel().sendFile(pipe_fds[0], 0, message.size()));
+    EXPECT_EQ(message, read_exactly(pair.server->getChannel(), message.size()));
+    ::close(pipe_fds[0]);
+    ::close(pipe_fds[1]);
+}
+
+// 阻塞套接字在管道暂时为空时等待写端，而不是提前返回
+TEST(Test_SendFile, SpliceWaitsForWriter){
+    int pipe_fds[2];
+    ASSERT_EQ(0, ::pipe(pipe_fds));
+    std::string message(4096, 'x');
+    LoopbackPair pair;
+    std::thread writer([&](){
+        // sendFile 开始时管道为空，分两次写入
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_GT(::write(pipe_fds[1], message.data(), message.size() / 2), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_GT(::write(pipe_fds[1], message.data() + message.size() / 2, message.size() - message.size() / 2), 0);
+    });
+    EXPECT_EQ(message.size(), pair.client.getChannel().sendFile(pipe_fds[0], 0, message.size()));
+    writer.join();
+    EXPECT_EQ(message, read_exactly(pair.server->getChannel(), message.size()));
+    ::close(pipe_fds[0]);
+    ::close(pipe_fds[1]);
+}
+#endif
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <CPS/Socket.h>
+#include <Network/Socket.h>
+#include <NetworkTesting.h>
+#include <ostream>
+#include <string>
+#include <thread>
+
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+TEST(Test_SocketOptions, OptionValueIsInline){
+    Network::SocketOptionValue value(42);
+    EXPECT_EQ(sizeof(int), value.size());
+    EXPECT_EQ(42, value.as<int>());
+    Network::SocketOptionValue copy = value;
+    EXPECT_EQ(42, copy.as<int>());
+    EXPECT_EQ(sizeof(int), copy.size());
+
+    linger lng{1, 5};
+    Network::SocketOptionValue structure(lng);
+    EXPECT_EQ(sizeof(linger), structure.size());
+    EXPECT_EQ(5, structure.as<linger>().l_linger);
+
+    // 超过容量的值不会被截断后传给 setsockopt
+    char large[Network::SocketOptionValue::capacity + 16] = {1};
+    EXPECT_THROW(Network::SocketOptionValue(static_cast<const void*>(large), sizeof(large)), Globals::WrongArgument_Error);
+    Network::SocketOptionValue full(static_cast<const void*>(large), Network::SocketOptionValue::capacity);
+    EXPECT_EQ(Network::SocketOptionValue::capacity, full.size());
+}
+
+TEST(Test_SocketOptions, SetAfterLaunch){
+    LoopbackPair pair;
+    Network::TCPSocket& sock = pair.client;
+
+    EXPECT_FALSE(sock.isNoDelay());
+    sock.setNoDelay(true);
+    EXPECT_TRUE(sock.isNoDelay());
+    sock.setKeepAlive(true);
+    EXPECT_TRUE(sock.isKeepAlive());
+    sock.setReuseAddress(true);
+    EXPECT_TRUE(sock.isReuseAddress());
+
+    sock.setSendBufferSize(64 * 1024);
+    sock.setReceiveBufferSize(64 * 1024);
+    // Linux 内核会把设置的值翻倍，以容纳簿记开销
+    EXPECT_GE(sock.getSendBufferSize(), 64 * 1024);
+    EXPECT_GE(sock.getReceiveBufferSize(), 64 * 1024);
+
+#ifdef AntonaStandard_PLATFORM_LINUX
+    sock.setCork(true);
+    EXPECT_TRUE(sock.isCork());
+    sock.setCork(false);
+    EXPECT_FALSE(sock.isCork());
+    sock.setQuickAck(true);
+    EXPECT_TRUE(sock.isQuickAck());
+    // 减小忙轮询时间不需要特权
+    sock.setBusyPoll(0);
+    EXPECT_EQ(0, sock.getBusyPoll());
+    EXPECT_GE(sock.getIncomingCpu(), -1);
+#endif
+}
+
+TEST(Test_SocketOptions, SetBeforeLaunch){
+    // 启动之前的设置在创建文件描述符之后、绑定或连接之前生效
+    LoopbackPair pair(false);
+    pair.client.setNoDelay(true);
+    pair.client.setKeepAlive(false);
+    pair.client.setKeepAlive(true);
+    EXPECT_THROW(pair.client.isNoDelay(), Globals::NullPointer_Error);
+#ifdef AntonaStandard_PLATFORM_LINUX
+    pair.client.setFastOpenConnect(true);
+#endif
+    pair.connect();
+    EXPECT_TRUE(pair.client.isNoDelay());
+    EXPECT_TRUE(pair.client.isKeepAlive());
+#ifdef AntonaStandard_PLATFORM_LINUX
+    EXPECT_TRUE(pair.client.isFastOpenConnect());
+
+    Network::UDPSocket udp(CPS::SocketAddress::loopBackAddress(0));
+    udp.setReusePort(true);
+    udp.setReceiveBufferSize(256 * 1024);
+    udp.launch();
+    EXPECT_TRUE(udp.isReusePort());
+    EXPECT_GE(udp.getReceiveBufferSize(), 256 * 1024);
+#endif
+}
+
+#ifdef AntonaStandard_PLATFORM_LINUX
+TEST(Test_SocketOptions, FastOpenListener){
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.setFastOpen(16);
+    listener.launch();
+    EXPECT_EQ(16, listener.getFastOpen());
+}
+
+TEST(Test_SocketOptions, WriteMoreCoalesces){
+    LoopbackPair pair;
+    Network::SocketChannel sender = pair.client.getChannel();
+    Network::SocketChannel receiver = pair.server->getChannel();
+
+    std::ostream outs(&sender.getOutBuffer());
+    outs<<"header:";
+    EXPECT_EQ(7u, sender.writeMore());
+    outs<<"body";
+    EXPECT_EQ(4u, sender.write());
+
+    std::string received;
+    while(received.size() < 11 && receiver.read() > 0){
+        received.assign(receiver.getInBuffer().sendingPos(), receiver.getInBuffer().getSendableSize());
+    }
+    EXPECT_EQ("header:body", received);
+}
+#endif
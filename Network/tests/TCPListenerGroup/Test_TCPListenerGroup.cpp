@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <Network/TCPListenerGroup.h>
+#include <NetworkTesting.h>
+#include <atomic>
+#include <chrono>
+#include <istream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+TEST(Test_TCPListenerGroup, AcceptAndReply){
+    Network::TCPListenerGroup group(CPS::SocketAddress::loopBackAddress(0), 2);
+    EXPECT_EQ(2u, group.size());
+    group.launch([](Network::TCPSocket connection){
+        Network::SocketChannel channel = connection.getChannel();
+        std::ostream outs(&channel.getOutBuffer());
+        outs<<"hello";
+        channel.write();
+    });
+    EXPECT_TRUE(group.isRunning());
+    EXPECT_NE(0, group.getAddress().getPort());
+    EXPECT_THROW(group.launch([](Network::TCPSocket){}), Globals::UnlawfulOperation_Error);
+
+    Network::TCPSocket client = connect_to(group);
+    Network::SocketChannel channel = client.getChannel();
+    std::string received;
+    while(received.size() < 5 && channel.read() > 0){
+        received.assign(channel.getInBuffer().sendingPos(), channel.getInBuffer().getSendableSize());
+    }
+    EXPECT_EQ("hello", received);
+    client.close();
+
+    group.stop();
+    EXPECT_FALSE(group.isRunning());
+    // 重复停止没有副作用
+    group.stop();
+    // 停止之后不能再次启动，失败的启动不会改变运行状态
+    EXPECT_THROW(group.launch([](Network::TCPSocket){}), Globals::UnlawfulOperation_Error);
+    EXPECT_FALSE(group.isRunning());
+}
+
+#ifdef AntonaStandard_PLATFORM_LINUX
+TEST(Test_TCPListenerGroup, KernelBalancesConnections){
+    const std::size_t listeners = 4;
+    const std::size_t connections = 200;
+    Network::TCPListenerGroup group(CPS::SocketAddress::loopBackAddress(0), listeners);
+    std::atomic<std::size_t> handled{0};
+    group.launch([&handled](Network::TCPSocket){
+        handled.fetch_add(1);
+    });
+    for(std::size_t i = 0; i < listeners; ++i){
+        EXPECT_TRUE(group.getListener(i).isReusePort());
+    }
+
+    std::vector<Network::TCPSocket> clients;
+    for(std::size_t i = 0; i < connections; ++i){
+        clients.push_back(connect_to(group));
+    }
+    ASSERT_TRUE(wait_for([&](){ return handled.load() == connections; }));
+
+    // 每个连接只被一个监听套接字接受，并且连接分散到了多个监听套接字上
+    std::size_t total = 0;
+    std::size_t busy = 0;
+    for(std::size_t i = 0; i < listeners; ++i){
+        total += group.getAcceptedCount(i);
+        busy += group.getAcceptedCount(i) > 0;
+    }
+    EXPECT_EQ(connections, total);
+    EXPECT_GE(busy, 2u);
+
+    for(auto& client:clients){
+        client.close();
+    }
+    group.stop();
+}
+#endif
+
+TEST(Test_TCPListenerGroup, HandlerExceptionKeepsAccepting){
+    Network::TCPListenerGroup group(CPS::SocketAddress::loopBackAddress(0), 1);
+    std::atomic<std::size_t> calls{0};
+    group.launch([&calls](Network::TCPSocket){
+        std::size_t call = calls.fetch_add(1);
+        if(call == 0){
+            throw std::runtime_error("first connection rejected");
+        }
+        if(call == 1){
+            // 不是 std::exception 的异常同样不会终止 accept 线程
+            throw 42;
+        }
+    });
+    Network::TCPSocket first = connect_to(group);
+    Network::TCPSocket second = connect_to(group);
+    Network::TCPSocket third = connect_to(group);
+    EXPECT_TRUE(wait_for([&](){ return calls.load() == 3; }));
+    first.close();
+    second.close();
+    third.close();
+}
@@ -0,0 +1,378 @@
+#include <gtest/gtest.h>
+#include <Network/TCPServer.h>
+#include <NetworkTesting.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+namespace {
+    void send_all(Network::TCPSocket& client, const std::string& data){
+        Network::SocketChannel channel = client.getChannel();
+        channel.getOutBuffer().append(data.data(), data.size());
+        channel.write();
+    }
+
+    // 调度线程轮询间隔较短的线程池，测试结束时可以尽快关闭
+    class QuickPool:public ThreadTools::ThreadsPool{
+    protected:
+        virtual std::chrono::milliseconds get_manager_waiting_period()override{
+            return std::chrono::milliseconds(10);
+        }
+    public:
+        QuickPool():ThreadTools::ThreadsPool(2, 4){}
+    };
+
+    // 把收到的数据原样发回
+    void echo(const Network::TCPConnectionPtr& connection, CPS::SocketDataBuffer& buffer){
+        connection->send(buffer.readingPos(), buffer.getReadableSize());
+        buffer.moveGetPos(buffer.getReadableSize());
+    }
+}
+
+TEST(Test_TCPServer, EventLoopTasksAndWatches){
+    Network::EventLoop loop;
+    EXPECT_FALSE(loop.isInLoopThread());
+    std::thread runner([&](){ loop.run(); });
+
+    std::atomic<bool> in_loop{false};
+    loop.post([&](){ in_loop = loop.isInLoopThread(); });
+    ASSERT_TRUE(wait_for([&](){ return in_loop.load(); }));
+    EXPECT_THROW(loop.run(), Globals::UnlawfulOperation_Error);
+
+    // 注册套接字的可读事件，回调中注销自己
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    auto port = CPS::SocketLibraryManager::manager().getLocalAddress(listener.getManager()->getSocketFd()).getPort();
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(port));
+    client.launch();
+    Network::TCPSocket server = listener.accept();
+    int fd = client.getManager()->getSocketFd();
+    std::atomic<int> calls{0};
+    loop.post([&](){
+        loop.watch(fd, Network::IOEvents::Readable, [&, fd](std::uint32_t events){
+            EXPECT_TRUE(events & Network::IOEvents::Readable);
+            ++calls;
+            loop.unwatch(fd);
+        });
+        EXPECT_THROW(loop.watch(fd, Network::IOEvents::Readable, [](std::uint32_t){}), Globals::UnlawfulOperation_Error);
+    });
+    send_all(server, "x");
+    ASSERT_TRUE(wait_for([&](){ return calls.load() == 1; }));
+    // 注销之后不再通知，数据仍然没有读取
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(1, calls.load());
+
+    // 回调中的异常不会终止事件循环
+    std::atomic<bool> after_throw{false};
+    loop.post([](){ throw std::runtime_error("expected"); });
+    loop.post([](){ throw 42; });
+    loop.post([&](){ after_throw = true; });
+    ASSERT_TRUE(wait_for([&](){ return after_throw.load(); }));
+
+    loop.stop();
+    runner.join();
+}
+
+TEST(Test_TCPServer, EchoAcrossLoops){
+    Network::TCPServerOptions options;
+    options.loops = 4;
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(0), options);
+    std::atomic<int> foreign_thread{0};
+    std::atomic<int> connected{0}, closed{0};
+    server.setConnectionHandler([&](const Network::TCPConnectionPtr& connection){
+        if(!connection->getLoop().isInLoopThread()){
+            ++foreign_thread;
+        }
+        ++connected;
+    });
+    server.setMessageHandler([&](const Network::TCPConnectionPtr& connection, CPS::SocketDataBuffer& buffer){
+        if(!connection->getLoop().isInLoopThread()){
+            ++foreign_thread;
+        }
+        echo(connection, buffer);
+    });
+    server.setCloseHandler([&](const Network::TCPConnectionPtr& connection){
+        EXPECT_FALSE(connection->isConnected());
+        ++closed;
+    });
+    server.launch();
+    EXPECT_EQ(4u, server.getLoopCount());
+    EXPECT_THROW(server.launch(), Globals::UnlawfulOperation_Error);
+
+    std::vector<Network::TCPSocket> clients;
+    for(int i = 0; i < 8; ++i){
+        clients.push_back(connect_to(server));
+    }
+    ASSERT_TRUE(wait_for([&](){ return connected.load() == 8; }));
+    // 轮询分配，每个事件循环两个连接
+    for(size_t i = 0; i < server.getLoopCount(); ++i){
+        EXPECT_EQ(2u, server.getConnectionCount(i));
+    }
+    for(int round = 0; round < 10; ++round){
+        for(size_t i = 0; i < clients.size(); ++i){
+            std::string message = "client " + std::to_string(i) + " round " + std::to_string(round);
+            send_all(clients[i], message);
+            EXPECT_EQ(message, read_exactly(clients[i], message.size()));
+        }
+    }
+    for(auto& client:clients){
+        client.close();
+    }
+    ASSERT_TRUE(wait_for([&](){ return closed.load() == 8; }));
+    for(size_t i = 0; i < server.getLoopCount(); ++i){
+        EXPECT_EQ(0u, server.getConnectionCount(i));
+    }
+    EXPECT_EQ(0, foreign_thread.load());
+    server.stop();
+    server.stop();
+}
+
+TEST(Test_TCPServer, LeastConnections){
+    Network::TCPServerOptions options;
+    options.loops = 2;
+    options.balance = Network::LoopBalance::LeastConnections;
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(0), options);
+    std::atomic<int> connected{0};
+    server.setConnectionHandler([&](const Network::TCPConnectionPtr&){ ++connected; });
+    server.launch();
+
+    std::vector<Network::TCPSocket> clients;
+    for(int i = 0; i < 2; ++i){
+        clients.push_back(connect_to(server));
+    }
+    ASSERT_TRUE(wait_for([&](){ return connected.load() == 2; }));
+    EXPECT_EQ(1u, server.getConnectionCount(0));
+    EXPECT_EQ(1u, server.getConnectionCount(1));
+
+    // 连接数相同时分配给第一个事件循环，关闭它的连接之后新连接仍然分配给它
+    clients[0].close();
+    ASSERT_TRUE(wait_for([&](){ return server.getConnectionCount(0) == 0; }));
+    EXPECT_EQ(1u, server.getConnectionCount(1));
+    clients.push_back(connect_to(server));
+    ASSERT_TRUE(wait_for([&](){ return connected.load() == 3; }));
+    EXPECT_EQ(1u, server.getConnectionCount(0));
+    EXPECT_EQ(1u, server.getConnectionCount(1));
+    clients.push_back(connect_to(server));
+    ASSERT_TRUE(wait_for([&](){ return connected.load() == 4; }));
+    EXPECT_EQ(2u, server.getConnectionCount(0));
+}
+
+TEST(Test_TCPServer, OffloadToThreadsPool){
+    QuickPool pool;
+    pool.lauch();
+    QuickPool closed_pool;
+    closed_pool.lauch();
+    closed_pool.shutdown();
+    Network::TCPServerOptions options;
+    options.loops = 2;
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(0), options);
+    std::atomic<int> foreign_thread{0};
+    server.setMessageHandler([&](const Network::TCPConnectionPtr& connection, CPS::SocketDataBuffer& buffer){
+        std::string request(buffer.readingPos(), buffer.getReadableSize());
+        buffer.moveGetPos(buffer.getReadableSize());
+        std::thread::id loop_thread = std::this_thread::get_id();
+        if(request == "fail"){
+            connection->offload(pool, [](){ throw std::runtime_error("expected"); }, [](const Network::TCPConnectionPtr&){});
+            connection->send("failed");
+            return;
+        }
+        if(request == "closed"){
+            // 线程池已经关闭，done 不会被调用，提交失败的异常由事件循环输出
+            connection->offload(closed_pool, [](){}, [&foreign_thread](const Network::TCPConnectionPtr&){ ++foreign_thread; });
+            connection->send("closed");
+            return;
+        }
+        connection->offload(pool, [request, loop_thread, &foreign_thread](){
+            if(std::this_thread::get_id() == loop_thread){
+                ++foreign_thread;
+            }
+            unsigned long long sum = 0;
+            for(int i = 1; i <= 100000; ++i){
+                sum += static_cast<unsigned long long>(i) * request.size();
+            }
+            return std::to_string(sum);
+        }, [&foreign_thread](const Network::TCPConnectionPtr& connection, std::string result){
+            if(!connection->getLoop().isInLoopThread()){
+                ++foreign_thread;
+            }
+            if(connection->isConnected()){
+                connection->send(result + "\n");
+            }
+        });
+    });
+    server.launch();
+
+    Network::TCPSocket client = connect_to(server);
+    send_all(client, "fail");
+    EXPECT_EQ("failed", read_exactly(client, 6));
+    send_all(client, "closed");
+    EXPECT_EQ("closed", read_exactly(client, 6));
+    for(int i = 1; i <= 5; ++i){
+        std::string request(i, 'a');
+        std::string expected = std::to_string(5000050000ULL * i) + "\n";
+        send_all(client, request);
+        EXPECT_EQ(expected, read_exactly(client, expected.size()));
+    }
+    EXPECT_EQ(0, foreign_thread.load());
+    server.stop();
+    pool.shutdown();
+}
+
+// stop 等待尚未结束的计算，之后销毁服务端是安全的
+TEST(Test_TCPServer, StopWaitsForOffload){
+    QuickPool pool;
+    pool.lauch();
+    Network::TCPServerOptions options;
+    options.loops = 1;
+    auto server = std::make_unique<Network::TCPServer>(CPS::SocketAddress::loopBackAddress(0), options);
+    std::atomic<bool> started{false};
+    std::atomic<bool> finished{false};
+    server->setMessageHandler([&](const Network::TCPConnectionPtr& connection, CPS::SocketDataBuffer& buffer){
+        buffer.moveGetPos(buffer.getReadableSize());
+        connection->offload(pool, [&](){
+            started = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            finished = true;
+        }, [](const Network::TCPConnectionPtr&){});
+    });
+    server->launch();
+
+    Network::TCPSocket client = connect_to(*server);
+    send_all(client, "work");
+    ASSERT_TRUE(wait_for([&](){ return started.load(); }));
+    server->stop();
+    EXPECT_TRUE(finished.load());
+    server.reset();
+    pool.shutdown();
+}
+
+// 启动失败之后可以再次启动
+TEST(Test_TCPServer, LaunchAfterFailure){
+    Network::TCPListenSocket blocker(CPS::SocketAddress::loopBackAddress(0));
+    unsigned short port = launch_listener(blocker);
+    Network::TCPServerOptions options;
+    options.loops = 2;
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(port), options);
+    EXPECT_THROW(server.launch(), std::runtime_error);
+    EXPECT_FALSE(server.isRunning());
+    EXPECT_EQ(0u, server.getLoopCount());
+    blocker.getManager()->close();
+    server.launch();
+    EXPECT_EQ(2u, server.getLoopCount());
+    Network::TCPSocket client = connect_to(server);
+    ASSERT_TRUE(wait_for([&](){ return server.getConnectionCount(0) + server.getConnectionCount(1) == 1; }));
+    server.stop();
+    // 停止之后不能再次启动，失败的启动不会改变运行状态
+    EXPECT_THROW(server.launch(), Globals::UnlawfulOperation_Error);
+    EXPECT_FALSE(server.isRunning());
+}
+
+TEST(Test_TCPServer, LargeWritesAndStop){
+    const size_t size = 8 << 20;
+    Network::TCPServerOptions options;
+    options.loops = 1;
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(0), options);
+    std::atomic<bool> buffered{false};
+    std::atomic<int> closed{0};
+    std::atomic<bool> first{true};
+    server.setConnectionHandler([&](const Network::TCPConnectionPtr& connection){
+        if(!first.exchange(false)){
+            return;
+        }
+        std::string data(size, 0);
+        for(size_t i = 0; i < size; ++i){
+            data[i] = static_cast<char>(i % 251);
+        }
+        connection->send(data);
+        // 环回地址的发送缓冲区放不下 8 MiB，剩余的数据在可写时继续发送
+        buffered = connection->getPendingSize() > 0;
+    });
+    server.setCloseHandler([&](const Network::TCPConnectionPtr&){ ++closed; });
+    server.launch();
+
+    Network::TCPSocket client = connect_to(server);
+    std::string received = read_exactly(client, size);
+    ASSERT_EQ(size, received.size());
+    bool intact = true;
+    for(size_t i = 0; i < size; ++i){
+        intact = intact && received[i] == static_cast<char>(i % 251);
+    }
+    EXPECT_TRUE(intact);
+    EXPECT_TRUE(buffered.load());
+
+    // 停止服务端时关闭所有连接
+    Network::TCPSocket idle = connect_to(server);
+    ASSERT_TRUE(wait_for([&](){ return server.getConnectionCount(0) == 2; }));
+    server.stop();
+    EXPECT_EQ(2, closed.load());
+    EXPECT_EQ(0u, read_exactly(idle, 1).size());
+}
+
+TEST(Test_TCPServer, EventLoopTimers){
+    Network::EventLoop loop;
+    std::thread runner([&](){ loop.run(); });
+    std::mutex mtx;
+    std::vector<int> order;
+    auto record = [&](int value){
+        std::lock_guard<std::mutex> lck(mtx);
+        order.push_back(value);
+    };
+    std::atomic<bool> done{false};
+    auto start = std::chrono::steady_clock::now();
+    loop.post([&](){
+        loop.runAfter(std::chrono::milliseconds(30), [&](){ record(3); done = true; });
+        loop.runAfter(std::chrono::milliseconds(10), [&](){ record(1); });
+        auto cancelled = loop.runAfter(std::chrono::milliseconds(5), [&](){ record(-1); });
+        auto delayed = loop.runAfter(std::chrono::milliseconds(1), [&](){ record(2); });
+        EXPECT_TRUE(loop.cancelTimer(cancelled));
+        EXPECT_TRUE(loop.restartTimer(delayed, std::chrono::milliseconds(20)));
+        // 定时器回调中的异常不会终止事件循环
+        loop.runAfter(std::chrono::milliseconds(15), [](){ throw std::runtime_error("expected"); });
+        EXPECT_EQ(4u, loop.getTimerCount());
+    });
+    // 没有文件描述符就绪时也能按时触发
+    ASSERT_TRUE(wait_for([&](){ return done.load(); }));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(30));
+    {
+        std::lock_guard<std::mutex> lck(mtx);
+        EXPECT_EQ((std::vector<int>{1, 2, 3}), order);
+    }
+    loop.stop();
+    runner.join();
+}
+
+TEST(Test_TCPServer, IdleTimeout){
+    Network::TCPServerOptions options;
+    options.loops = 1;
+    options.idle_timeout = std::chrono::milliseconds(100);
+    Network::TCPServer server(CPS::SocketAddress::loopBackAddress(0), options);
+    std::atomic<int> closed{0};
+    server.setMessageHandler(echo);
+    server.setCloseHandler([&](const Network::TCPConnectionPtr&){ ++closed; });
+    server.launch();
+
+    Network::TCPSocket idle = connect_to(server);
+    Network::TCPSocket active = connect_to(server);
+    ASSERT_TRUE(wait_for([&](){ return server.getConnectionCount(0) == 2; }));
+    // 持续收到数据的连接不会超时
+    auto start = std::chrono::steady_clock::now();
+    while(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(300)){
+        send_all(active, "ping");
+        EXPECT_EQ("ping", read_exactly(active, 4));
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+    ASSERT_TRUE(wait_for([&](){ return closed.load() == 1; }));
+    EXPECT_EQ(0u, read_exactly(idle, 1).size());
+    EXPECT_EQ(1u, server.getConnectionCount(0));
+    ASSERT_TRUE(wait_for([&](){ return closed.load() == 2; }));
+    EXPECT_EQ(0u, server.getConnectionCount(0));
+    server.stop();
+    EXPECT_EQ(2, closed.load());
+}
@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include <Network/Socket.h>
+#include <string>
+
+#ifdef AntonaStandard_PLATFORM_LINUX
+using namespace AntonaStandard;
+
+namespace {
+    unsigned short local_port(Network::Socket& sock){
+        return CPS::SocketLibraryManager::manager().getLocalAddress(sock.getManager()->getSocketFd()).getPort();
+    }
+
+    std::string make_payload(size_t size){
+        std::string payload(size, '\0');
+        for(size_t i = 0; i < size; ++i){
+            payload[i] = static_cast<char>('a' + i % 26);
+        }
+        return payload;
+    }
+
+    Network::SocketChannel launch_channel(Network::UDPSocket& sock, bool gro){
+        if(gro){
+            sock.setUdpGro(true);
+        }
+        sock.launch();
+        return sock.getChannel();
+    }
+
+    // 一对在环回地址上单向发送数据报的 UDP 套接字
+    struct UdpPair{
+        Network::UDPSocket sender;
+        Network::UDPSocket receiver;
+        Network::SocketChannel receiving;
+        Network::SocketChannel sending;
+
+        explicit UdpPair(bool gro)
+            :sender(CPS::SocketAddress::loopBackAddress(0)),
+            receiver(CPS::SocketAddress::loopBackAddress(0)),
+            receiving(launch_channel(receiver, gro)),
+            sending(launch_channel(sender, false)){
+            this->sending.setAddress(CPS::SocketAddress::loopBackAddress(local_port(this->receiver)));
+        }
+
+        size_t read(size_t& segment_size){
+            this->receiving.getInBuffer().clear();
+            this->receiving.getInBuffer().ensureReceivableSize(64 * 1024);
+            return this->receiving.readSegments(segment_size);
+        }
+    };
+}
+
+TEST(Test_UdpSegmentation, SegmentsArriveAsDatagrams){
+    UdpPair pair(false);
+    std::string payload = make_payload(100 * 1000 + 500);
+    pair.sending.getOutBuffer().append(payload.data(), payload.size());
+    // 超过单次调用的上限，分多次发送
+    EXPECT_EQ(payload.size(), pair.sending.writeSegments(1000));
+    EXPECT_EQ(0u, pair.sending.getOutBuffer().getSendableSize());
+
+    // 接收端没有开启 GRO，每次读到一个数据报
+    std::string received;
+    for(int i = 0; i < 101; ++i){
+        size_t segment_size = 0;
+        size_t size = pair.read(segment_size);
+        ASSERT_EQ(i < 100 ? 1000u : 500u, size);
+        EXPECT_EQ(size, segment_size);
+        received.append(pair.receiving.getInBuffer().sendingPos(), size);
+    }
+    EXPECT_TRUE(received == payload);
+    EXPECT_EQ(local_port(pair.sender), pair.receiving.getAddress().getPort());
+}
+
+TEST(Test_UdpSegmentation, GroCoalesces){
+    UdpPair pair(true);
+    EXPECT_TRUE(pair.receiver.isUdpGro());
+    std::string payload = make_payload(40 * 1200 + 100);
+    pair.sending.getOutBuffer().append(payload.data(), payload.size());
+    EXPECT_EQ(payload.size(), pair.sending.writeSegments(1200));
+
+    // 合并的粒度由内核决定，但每个数据报的长度不变，按 segment_size 切分后内容一致
+    std::string received;
+    size_t datagrams = 0;
+    size_t reads = 0;
+    while(received.size() < payload.size()){
+        size_t segment_size = 0;
+        size_t size = pair.read(segment_size);
+        ASSERT_GT(size, 0u);
+        ASSERT_TRUE(segment_size == 1200 || segment_size == size)<<segment_size;
+        datagrams += (size + segment_size - 1) / segment_size;
+        received.append(pair.receiving.getInBuffer().sendingPos(), size);
+        ++reads;
+    }
+    EXPECT_TRUE(received == payload);
+    EXPECT_EQ(41u, datagrams);
+    EXPECT_LE(reads, datagrams);
+}
+
+TEST(Test_UdpSegmentation, DefaultSegmentOption){
+    UdpPair pair(false);
+    pair.sender.setUdpSegment(600);
+    EXPECT_EQ(600, pair.sender.getUdpSegment());
+    // 设置了默认分段大小之后普通的 write 也会被切分
+    std::string payload = make_payload(1500);
+    pair.sending.getOutBuffer().append(payload.data(), payload.size());
+    EXPECT_EQ(payload.size(), pair.sending.write());
+    for(size_t expected:{600u, 600u, 300u}){
+        size_t segment_size = 0;
+        EXPECT_EQ(expected, pair.read(segment_size));
+    }
+}
+
+TEST(Test_UdpSegmentation, Unsupported){
+    UdpPair pair(false);
+    pair.sending.getOutBuffer().append("x", 1);
+    EXPECT_THROW(pair.sending.writeSegments(0), Globals::WrongArgument_Error);
+
+    Network::TCPListenSocket listener(CPS::SocketAddress::loopBackAddress(0));
+    listener.launch();
+    Network::TCPSocket client(CPS::SocketAddress::loopBackAddress(local_port(listener)));
+    client.launch();
+    size_t segment_size = 0;
+    EXPECT_THROW(client.getChannel().writeSegments(1000), Globals::UnlawfulOperation_Error);
+    EXPECT_THROW(client.getChannel().readSegments(segment_size), Globals::UnlawfulOperation_Error);
+}
+#endif
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <Network/Socket.h>
+#include <NetworkTesting.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef AntonaStandard_PLATFORM_LINUX
+using namespace AntonaStandard;
+using namespace NetworkTesting;
+
+namespace {
+    // 等待所有零拷贝发送被释放
+    void wait_all(Network::SocketChannel& channel){
+        for(int i = 0; i < 100 && channel.getPendingZeroCopyCount() > 0; ++i){
+            channel.waitZeroCopy(100);
+        }
+    }
+
+    std::shared_ptr<std::string> make_block(size_t size, char fill){
+        auto block = std::make_shared<std::string>(size, fill);
+        for(size_t i = 0; i < size; i += 4096){
+            (*block)[i] = static_cast<char>(i / 4096);
+        }
+        return block;
+    }
+}
+
+TEST(Test_ZeroCopy, SendAndRelease){
+    LoopbackPair pair;
+    Network::SocketChannel channel = pair.client.getChannel();
+    std::vector<std::shared_ptr<std::string>> blocks;
+    std::vector<std::weak_ptr<std::string>> watchers;
+    std::string expected;
+    for(char fill:{'a', 'b', 'c', 'd'}){
+        blocks.push_back(make_block(1 << 20, fill));
+        watchers.push_back(blocks.back());
+        expected += *blocks.back();
+    }
+
+    std::string received;
+    std::thread reader([&](){
+        received = read_exactly(pair.server->getChannel(), expected.size());
+    });
+    size_t released = 0;
+    for(auto& block:blocks){
+        const std::string* data = block.get();
+        // 所有权转移给回调，释放通知到达之前数据一直有效
+        EXPECT_EQ(data->size(), channel.sendZeroCopy(data->data(), data->size(), [block = std::move(block), &released](bool){
+            ++released;
+        }));
+    }
+    reader.join();
+    EXPECT_TRUE(received == expected);
+
+    wait_all(channel);
+    EXPECT_EQ(0u, channel.getPendingZeroCopyCount());
+    EXPECT_EQ(blocks.size(), released);
+    for(auto& weak:watchers){
+        EXPECT_TRUE(weak.expired());
+    }
+    EXPECT_TRUE(pair.client.isZeroCopy());
+}
+
+TEST(Test_ZeroCopy, NonBlockingResumes){
+    LoopbackPair pair;
+    pair.client.setSendBufferSize(64 * 1024);
+    pair.client.setNonBlocking(true);
+    Network::SocketChannel channel = pair.client.getChannel();
+    auto block = make_block(8 << 20, 'z');
+
+    // 对端还没有读取，只发送了一部分，剩余部分没有被内核引用
+    size_t calls = 0;
+    size_t released = 0;
+    auto on_release = [&released](bool){
+        ++released;
+    };
+    size_t sent = channel.sendZeroCopy(block->data(), block->size(), on_release);
+    ++calls;
+    EXPECT_GT(sent, 0u);
+    EXPECT_LT(sent, block->size());
+
+    std::string received;
+    std::thread reader([&](){
+        received = read_exactly(pair.server->getChannel(), block->size());
+    });
+    while(sent < block->size()){
+        size_t size = channel.sendZeroCopy(block->data() + sent, block->size() - sent, on_release);
+        if(size == 0){
+            std::this_thread::yield();
+            continue;
+        }
+        ++calls;
+        sent += size;
+    }
+    reader.join();
+    EXPECT_TRUE(received == *block);
+    wait_all(channel);
+    EXPECT_EQ(calls, released);
+}
+
+// 套接字析构时等待完成通知，on_release 在析构返回之前被调用
+TEST(Test_ZeroCopy, DestructorWaitsForRelease){
+    LoopbackPair pair;
+    auto block = make_block(1 << 20, 'w');
+    std::weak_ptr<std::string> watcher = block;
+    bool released = false;
+    const std::string* data = block.get();
+    EXPECT_EQ(data->size(), pair.server->getChannel().sendZeroCopy(data->data(), data->size(), [block = std::move(block), &released](bool){
+        released = true;
+    }));
+    EXPECT_EQ(data->size(), read_exactly(pair.client, data->size()).size());
+    pair.server.reset();
+    EXPECT_TRUE(released);
+    EXPECT_TRUE(watcher.expired());
+}
+
+TEST(Test_ZeroCopy, Unsupported){
+    LoopbackPair pair;
+    Network::SocketChannel channel = pair.client.getChannel();
+    EXPECT_EQ(0u, channel.sendZeroCopy("", 0, [](bool){
+        ADD_FAILURE()<<"nothing was sent";
+    }));
+    EXPECT_EQ(0u, channel.getPendingZeroCopyCount());
+    EXPECT_EQ(0u, channel.waitZeroCopy(0));
+
+    Network::UDPSocket udp(CPS::SocketAddress::loopBackAddress(0));
+    udp.launch();
+    EXPECT_THROW(udp.getChannel().sendZeroCopy("data", 4), Globals::UnlawfulOperation_Error);
+}
+#endif
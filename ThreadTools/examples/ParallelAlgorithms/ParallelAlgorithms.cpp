@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include <ThreadTools/ParallelAlgorithms.h>
+#include <Utilities/Antona_foreach.h>
+using namespace AntonaStandard::ThreadTools;
+using AntonaStandard::Utilities::r_wrap;
+using namespace std;
+
+// 计时，返回毫秒
+template<typename type_FUNC>
+double measure(type_FUNC&& func){
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double,milli>(end - start).count();
+}
+
+int main(){
+    ThreadsPool pool(4,8);
+    pool.lauch();
+    cout<<"threads taking part: "<<parallel_concurrency(pool)<<endl;
+
+    const size_t size = 1 << 22;
+    mt19937 engine(2024);
+    uniform_real_distribution<double> dist(0.0,1000.0);
+    vector<double> values(size);
+    for(auto& value:values){
+        value = dist(engine);
+    }
+    vector<double> out(size);
+
+    double serial = measure([&](){
+        transform(values.begin(),values.end(),out.begin(),[](double x){ return sqrt(x) * log1p(x); });
+    });
+    double parallel = measure([&](){
+        parallel_transform(pool,values,out.begin(),[](double x){ return sqrt(x) * log1p(x); });
+    });
+    cout<<"transform  serial: "<<serial<<" ms, parallel: "<<parallel<<" ms"<<endl;
+
+    double serial_sum = 0,parallel_sum = 0;
+    serial = measure([&](){ serial_sum = accumulate(out.begin(),out.end(),0.0); });
+    parallel = measure([&](){ parallel_sum = parallel_reduce(pool,out,0.0); });
+    cout<<"reduce     serial: "<<serial<<" ms, parallel: "<<parallel<<" ms, difference: "<<fabs(serial_sum - parallel_sum)<<endl;
+
+    serial = measure([&](){ partial_sum(values.begin(),values.end(),out.begin()); });
+    parallel = measure([&](){ parallel_inclusive_scan(pool,values,out.begin()); });
+    cout<<"scan       serial: "<<serial<<" ms, parallel: "<<parallel<<" ms"<<endl;
+
+    vector<double> copy = values;
+    serial = measure([&](){ sort(copy.begin(),copy.end()); });
+    parallel = measure([&](){ parallel_sort(pool,values); });
+    cout<<"sort       serial: "<<serial<<" ms, parallel: "<<parallel<<" ms, same: "<<boolalpha<<(copy == values)<<endl;
+
+    // 逆向视图：对 r_wrap 排序得到降序
+    parallel_sort(pool,r_wrap(values));
+    cout<<"descending after sorting r_wrap: "<<is_sorted(values.rbegin(),values.rend())<<endl;
+    pool.shutdown();
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <vector>
+#include <ThreadTools/TimerWheel.h>
+using namespace AntonaStandard::ThreadTools;
+using namespace std;
+
+// 模拟 10 万个连接的空闲超时：每个连接一个定时器，每毫秒随机挑选一部分连接收到数据并推迟超时，
+// 超时的连接被关闭后重新建立。分别用时间轮和按到期时间排序的 std::multimap 管理定时器
+
+using Clock = TimerWheel::Clock;
+const int connections = 100000;
+const int steps = 2000;                     // 模拟的毫秒数
+const int reads_per_step = 200;             // 每毫秒收到数据的连接数
+const auto idle_timeout = chrono::milliseconds(500);
+
+// 计时，返回毫秒
+template<typename type_FUNC>
+double measure(type_FUNC&& func){
+    auto start = chrono::steady_clock::now();
+    func();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double,milli>(end - start).count();
+}
+
+size_t run_wheel(const Clock::time_point origin,const vector<int>& reads){
+    TimerWheel wheel(chrono::milliseconds(1),origin);
+    vector<TimerWheel::TimerId> timers(connections);
+    size_t expired = 0;
+    Clock::time_point now = origin;
+    function<void(int)> open = [&](int c){
+        timers[c] = wheel.schedule_at(now + idle_timeout,[&,c](){
+            ++expired;
+            open(c);
+        });
+    };
+    for(int c = 0; c < connections; ++c){
+        open(c);
+    }
+    size_t r = 0;
+    for(int step = 1; step <= steps; ++step){
+        now = origin + chrono::milliseconds(step);
+        for(int i = 0; i < reads_per_step; ++i){
+            wheel.restart_at(timers[reads[r++]],now + idle_timeout);
+        }
+        wheel.advance(now);
+    }
+    return expired;
+}
+
+size_t run_multimap(const Clock::time_point origin,const vector<int>& reads){
+    using Timers = multimap<Clock::time_point,int>;
+    Timers timers;
+    vector<Timers::iterator> handles(connections);
+    size_t expired = 0;
+    Clock::time_point now = origin;
+    for(int c = 0; c < connections; ++c){
+        handles[c] = timers.emplace(now + idle_timeout,c);
+    }
+    size_t r = 0;
+    for(int step = 1; step <= steps; ++step){
+        now = origin + chrono::milliseconds(step);
+        for(int i = 0; i < reads_per_step; ++i){
+            int c = reads[r++];
+            timers.erase(handles[c]);
+            handles[c] = timers.emplace(now + idle_timeout,c);
+        }
+        while(!timers.empty() && timers.begin()->first <= now){
+            int c = timers.begin()->second;
+            timers.erase(timers.begin());
+            ++expired;
+            handles[c] = timers.emplace(now + idle_timeout,c);
+        }
+    }
+    return expired;
+}
+
+int main(){
+    mt19937 engine(2024);
+    uniform_int_distribution<int> pick(0,connections - 1);
+    vector<int> reads(static_cast<size_t>(steps) * reads_per_step);
+    for(auto& c:reads){
+        c = pick(engine);
+    }
+    const Clock::time_point origin = Clock::now();
+    size_t wheel_expired = 0,multimap_expired = 0;
+    cout<<connections<<" connections, "<<steps<<" ms, "<<reads_per_step<<" reads/ms"<<endl;
+    cout<<"TimerWheel:    "<<measure([&](){ wheel_expired = run_wheel(origin,reads); })<<" ms, "<<wheel_expired<<" expired"<<endl;
+    cout<<"std::multimap: "<<measure([&](){ multimap_expired = run_multimap(origin,reads); })<<" ms, "<<multimap_expired<<" expired"<<endl;
+    return 0;
+}
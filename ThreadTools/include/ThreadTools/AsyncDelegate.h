@@ -0,0 +1,229 @@
+#ifndef THREADTOOLS_ASYNCDELEGATE_H
+#define THREADTOOLS_ASYNCDELEGATE_H
+
+/**
+ * @file AsyncDelegate.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 在线程池上异步调用委托
+ * @details
+ *      Delegate 的调用会在调用方线程上依次执行所有委托函数，一个耗时的订阅者会拖慢事件的发布者。
+ *      本文件提供的 async_invoke 将委托函数分发到 ThreadsPool 上执行，调用方立即返回：
+ *      - DispatchMode::Parallel 每个委托函数作为一个独立的任务提交，彼此并行
+ *      - DispatchMode::Serial 所有委托函数在同一个任务中按顺序执行
+ *      - 传入 Strand 时所有委托函数在 Strand 上按顺序执行，并且多次调用之间也保持先后顺序
+ *      所有委托函数执行完成后，可以通过返回的 std::future<void> 或者 async_invoke_then 传入的回调得知，
+ *      委托函数抛出的第一个异常会传递给 future 或回调，其余委托函数不受影响
+ * @note
+ *      调用时会拷贝一份委托函数和参数，之后对委托的增删不影响已经发出的调用。参数按值保存，委托函数的引用参数
+ *      引用的是这份拷贝；返回值会被丢弃，需要返回值时可以在委托函数内自行处理
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <Utilities/Delegate.h>
+#include <Utilities/ConcurrentDelegate.h>
+#include <ThreadTools/ThreadsPool.h>
+#include <ThreadTools/Strand.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace ThreadTools{
+        enum class DispatchMode;
+        class AsyncCompletion;
+    }
+}
+
+namespace AntonaStandard::ThreadTools{
+    /// @brief 委托函数的分发方式
+    enum class DispatchMode{
+        Parallel,           ///< 每个委托函数一个任务，并行执行
+        Serial              ///< 所有委托函数在一个任务中按顺序执行
+    };
+
+    /**
+     * @brief 一次异步调用的完成状态
+     * @details 记录尚未完成的任务数和第一个异常，最后一个任务完成时调用完成回调
+     */
+    class AsyncCompletion{
+        TESTING_MESSAGE
+    private:
+        std::atomic<unsigned long> remaining;
+        std::mutex mtx;
+        std::exception_ptr error;
+        std::function<void(std::exception_ptr)> on_complete;
+    public:
+        AsyncCompletion(unsigned long task_num,std::function<void(std::exception_ptr)> on_complete):
+            remaining(task_num),error(nullptr),on_complete(std::move(on_complete)){};
+        /// @brief 记录异常，只保留第一个
+        void set_error(std::exception_ptr exception);
+        /// @brief 标记一个任务完成，最后一个任务完成时调用完成回调
+        void finish_one();
+        /**
+         * @brief 把任务提交到线程池
+         * @details 线程池在提交时已经关闭，任务不会执行，此时在调用方线程中记录异常并标记该任务完成
+         */
+        void submit_to(ThreadsPool& pool,std::function<void()> task);
+    };
+
+    template<typename type_RETURN_VALUE,typename... type_PARAMETERS_PACK>
+    using AsyncHandler = std::shared_ptr<AntonaStandard::Utilities::BaseFuncPointerContainer<type_RETURN_VALUE,type_PARAMETERS_PACK...>>;
+
+    template<typename type_RETURN_VALUE,typename... type_PARAMETERS_PACK>
+    using AsyncHandlerArray = std::vector<AsyncHandler<type_RETURN_VALUE,type_PARAMETERS_PACK...>>;
+
+    /// @brief 拷贝 Delegate 中的委托函数
+    template<typename type_RETURN_VALUE,typename... type_PARAMETERS_PACK>
+    AsyncHandlerArray<type_RETURN_VALUE,type_PARAMETERS_PACK...>
+    async_snapshot(const AntonaStandard::Utilities::Delegate<type_RETURN_VALUE(type_PARAMETERS_PACK...)>& delegate){
+        AsyncHandlerArray<type_RETURN_VALUE,type_PARAMETERS_PACK...> handlers;
+        handlers.reserve(delegate.size());
+        for(auto container:delegate.getDelegateList()){
+            handlers.emplace_back(container->copy());
+        }
+        return handlers;
+    }
+
+    /// @brief 获取 ConcurrentDelegate 当前的委托函数，容器本身由 shared_ptr 共享，不需要拷贝
+    template<typename type_RETURN_VALUE,typename... type_PARAMETERS_PACK>
+    AsyncHandlerArray<type_RETURN_VALUE,type_PARAMETERS_PACK...>
+    async_snapshot(const AntonaStandard::Utilities::ConcurrentDelegate<type_RETURN_VALUE(type_PARAMETERS_PACK...)>& delegate){
+        auto guard = delegate.snapshot();
+        return AsyncHandlerArray<type_RETURN_VALUE,type_PARAMETERS_PACK...>(guard->begin(),guard->end());
+    }
+
+    /**
+     * @brief 将委托函数分发到线程池，完成后调用回调
+     * @tparam type_DELEGATE Delegate 或 ConcurrentDelegate
+     * @param pool
+     * @param delegate
+     * @param mode 分发方式
+     * @param on_complete 所有委托函数完成后在线程池中调用，参数为第一个异常，没有异常时为空。
+     *                    线程池在分发过程中关闭时，未能提交的委托函数按抛出 std::runtime_error 处理，此时可能在调用方线程中调用
+     * @param args 调用参数，会被拷贝
+     * @throw std::runtime_error 调用时线程池已经关闭
+     */
+    template<typename type_DELEGATE,typename... type_ARGS>
+    void async_invoke_then(ThreadsPool& pool,const type_DELEGATE& delegate,DispatchMode mode,
+                            std::function<void(std::exception_ptr)> on_complete,type_ARGS&&... args){
+        if(pool.has_shutdown()){
+            throw std::runtime_error("thread pool is shutdown");
+        }
+        auto handlers = async_snapshot(delegate);
+        auto params = std::make_shared<std::tuple<std::decay_t<type_ARGS>...>>(std::forward<type_ARGS>(args)...);
+        // 没有委托函数时按顺序方式提交一个空任务，保证回调同样在线程池中调用
+        if(mode == DispatchMode::Parallel && !handlers.empty()){
+            auto completion = std::make_shared<AsyncCompletion>(handlers.size(),std::move(on_complete));
+            for(auto& handler:handlers){
+                completion->submit_to(pool,[handler,params,completion](){
+                    try{
+                        std::apply([&handler](auto&... values){
+                            handler->call(values...);
+                        },*params);
+                    }
+                    catch(...){
+                        completion->set_error(std::current_exception());
+                    }
+                    completion->finish_one();
+                });
+            }
+        }
+        else{
+            auto completion = std::make_shared<AsyncCompletion>(1,std::move(on_complete));
+            auto shared_handlers = std::make_shared<decltype(handlers)>(std::move(handlers));
+            completion->submit_to(pool,[shared_handlers,params,completion](){
+                for(auto& handler:*shared_handlers){
+                    try{
+                        std::apply([&handler](auto&... values){
+                            handler->call(values...);
+                        },*params);
+                    }
+                    catch(...){
+                        completion->set_error(std::current_exception());
+                    }
+                }
+                completion->finish_one();
+            });
+        }
+    }
+
+    /**
+     * @brief 将委托函数投递到 Strand 上按顺序执行，完成后调用回调
+     * @details 同一个 Strand 上的多次调用按调用顺序执行，不会交错
+     * @throw std::runtime_error 线程池已经关闭
+     */
+    template<typename type_DELEGATE,typename... type_ARGS>
+    void async_invoke_then(Strand& strand,const type_DELEGATE& delegate,
+                            std::function<void(std::exception_ptr)> on_complete,type_ARGS&&... args){
+        auto handlers = std::make_shared<decltype(async_snapshot(delegate))>(async_snapshot(delegate));
+        auto params = std::make_shared<std::tuple<std::decay_t<type_ARGS>...>>(std::forward<type_ARGS>(args)...);
+        auto completion = std::make_shared<AsyncCompletion>(1,std::move(on_complete));
+        strand.post([handlers,params,completion](){
+            for(auto& handler:*handlers){
+                try{
+                    std::apply([&handler](auto&... values){
+                        handler->call(values...);
+                    },*params);
+                }
+                catch(...){
+                    completion->set_error(std::current_exception());
+                }
+            }
+            completion->finish_one();
+        });
+    }
+
+    /**
+     * @brief 将委托函数分发到线程池
+     * @return std::future<void> 所有委托函数完成后就绪，有委托函数抛出异常时 get() 会抛出第一个异常
+     * @throw std::runtime_error 线程池已经关闭
+     */
+    template<typename type_DELEGATE,typename... type_ARGS>
+    std::future<void> async_invoke(ThreadsPool& pool,const type_DELEGATE& delegate,DispatchMode mode,type_ARGS&&... args){
+        auto promise = std::make_shared<std::promise<void>>();
+        std::future<void> future = promise->get_future();
+        async_invoke_then(pool,delegate,mode,[promise](std::exception_ptr error){
+            if(error){
+                promise->set_exception(error);
+            }
+            else{
+                promise->set_value();
+            }
+        },std::forward<type_ARGS>(args)...);
+        return future;
+    }
+
+    /**
+     * @brief 将委托函数投递到 Strand 上按顺序执行
+     * @return std::future<void> 所有委托函数完成后就绪
+     * @throw std::runtime_error 线程池已经关闭
+     */
+    template<typename type_DELEGATE,typename... type_ARGS>
+    std::future<void> async_invoke(Strand& strand,const type_DELEGATE& delegate,type_ARGS&&... args){
+        auto promise = std::make_shared<std::promise<void>>();
+        std::future<void> future = promise->get_future();
+        async_invoke_then(strand,delegate,[promise](std::exception_ptr error){
+            if(error){
+                promise->set_exception(error);
+            }
+            else{
+                promise->set_value();
+            }
+        },std::forward<type_ARGS>(args)...);
+        return future;
+    }
+}
+
+#endif
@@ -0,0 +1,230 @@
+#ifndef THREADTOOLS_PARALLELALGORITHMS_H
+#define THREADTOOLS_PARALLELALGORITHMS_H
+
+/**
+ * @file ParallelAlgorithms.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 基于线程池的并行算法
+ * @details
+ *      提供 parallel_for_each、parallel_transform、parallel_reduce、parallel_inclusive_scan 和 parallel_sort，
+ *      接受随机访问迭代器区间或者范围（容器、数组以及 Utilities::r_wrap 返回的逆向包装器）。
+ *
+ *      所有算法都通过 parallel_chunks 调度：调用线程向线程池提交若干个辅助任务，然后自己也参与计算。
+ *      参与者通过原子变量领取区间，每次领取剩余长度的 1/(2*参与者数)，但不少于 grain（guided 调度），
+ *      开头的块较大以减少领取次数，结尾的块较小以平衡负载；先完成的参与者自然会多领取。
+ *      调用线程等待的是所有区间处理完毕，而不是辅助任务结束，所以线程池繁忙、甚至在线程池的任务中嵌套调用时，
+ *      调用线程也能独自完成全部工作，不会死锁
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <vector>
+#include <ThreadTools/ThreadsPool.h>
+
+namespace AntonaStandard::ThreadTools{
+    /**
+     * @brief 在线程池上并行处理 [0,count)
+     * @details body 的两个参数为一个区间 [begin,end)，同一个下标只会被处理一次
+     * @param grain 每次领取的最小长度，为 0 时根据 count 和参与者数自动选择
+     * @throw body 抛出的第一个异常，之后尚未开始的区间不再执行
+     */
+    void parallel_chunks(ThreadsPool& pool,std::size_t count,std::size_t grain,
+        const std::function<void(std::size_t,std::size_t)>& body);
+
+    /// @brief 在 pool 上参与计算的线程数，即线程池当前的工作线程数加上调用线程
+    std::size_t parallel_concurrency(const ThreadsPool& pool);
+
+    /// @brief 把 count 分成 blocks 块，返回 blocks + 1 个边界
+    std::vector<std::size_t> parallel_block_bounds(std::size_t count,std::size_t blocks);
+
+    template<typename type_Iterator>
+    constexpr bool is_random_access_iterator_v = std::is_base_of<std::random_access_iterator_tag,
+        typename std::iterator_traits<type_Iterator>::iterator_category>::value;
+
+    /// @brief 是否可以通过 std::begin 和 std::end 遍历，用于区分范围重载和迭代器重载
+    template<typename type_Range,typename = void>
+    struct is_range:std::false_type{};
+    template<typename type_Range>
+    struct is_range<type_Range,std::void_t<decltype(std::begin(std::declval<type_Range&>()))>>:std::true_type{};
+
+    /**
+     * @brief 对 [first,last) 的每个元素调用 func
+     */
+    template<typename type_Iterator,typename type_Func>
+    void parallel_for_each(ThreadsPool& pool,type_Iterator first,type_Iterator last,type_Func func,std::size_t grain = 0){
+        static_assert(is_random_access_iterator_v<type_Iterator>,"parallel_for_each requires random access iterators");
+        parallel_chunks(pool,static_cast<std::size_t>(last - first),grain,[&](std::size_t begin,std::size_t end){
+            std::for_each(first + begin,first + end,func);
+        });
+    }
+    template<typename type_Range,typename type_Func,
+        typename = std::enable_if_t<is_range<type_Range>::value>>
+    void parallel_for_each(ThreadsPool& pool,type_Range&& range,type_Func func,std::size_t grain = 0){
+        parallel_for_each(pool,std::begin(range),std::end(range),func,grain);
+    }
+
+    /**
+     * @brief 把 op(*it) 依次写入 d_first 开始的区间
+     * @return type_OutIterator 写入的最后一个元素之后的位置
+     */
+    template<typename type_Iterator,typename type_OutIterator,typename type_Op>
+    type_OutIterator parallel_transform(ThreadsPool& pool,type_Iterator first,type_Iterator last,type_OutIterator d_first,
+        type_Op op,std::size_t grain = 0){
+        static_assert(is_random_access_iterator_v<type_Iterator> && is_random_access_iterator_v<type_OutIterator>,
+            "parallel_transform requires random access iterators");
+        std::size_t count = static_cast<std::size_t>(last - first);
+        parallel_chunks(pool,count,grain,[&](std::size_t begin,std::size_t end){
+            std::transform(first + begin,first + end,d_first + begin,op);
+        });
+        return d_first + count;
+    }
+    template<typename type_Range,typename type_OutIterator,typename type_Op,
+        typename = std::enable_if_t<is_range<type_Range>::value>>
+    type_OutIterator parallel_transform(ThreadsPool& pool,type_Range&& range,type_OutIterator d_first,type_Op op,std::size_t grain = 0){
+        return parallel_transform(pool,std::begin(range),std::end(range),d_first,op,grain);
+    }
+
+    /**
+     * @brief 归约 [first,last)，结果为 init op x0 op x1 ...
+     * @details op 必须满足结合律，不要求交换律：各块的部分结果按顺序合并
+     */
+    template<typename type_Iterator,typename type_Value,typename type_Op = std::plus<>>
+    type_Value parallel_reduce(ThreadsPool& pool,type_Iterator first,type_Iterator last,type_Value init,type_Op op = type_Op()){
+        static_assert(is_random_access_iterator_v<type_Iterator>,"parallel_reduce requires random access iterators");
+        std::size_t count = static_cast<std::size_t>(last - first);
+        if(count == 0){
+            return init;
+        }
+        std::vector<std::size_t> bounds = parallel_block_bounds(count,parallel_concurrency(pool) * 4);
+        std::vector<std::optional<type_Value>> partials(bounds.size() - 1);
+        parallel_chunks(pool,partials.size(),1,[&](std::size_t begin,std::size_t end){
+            for(std::size_t block = begin; block < end; ++block){
+                type_Iterator it = first + bounds[block];
+                type_Iterator block_end = first + bounds[block + 1];
+                type_Value value = *it;
+                for(++it; it != block_end; ++it){
+                    value = op(std::move(value),*it);
+                }
+                partials[block].emplace(std::move(value));
+            }
+        });
+        for(auto& partial:partials){
+            init = op(std::move(init),std::move(*partial));
+        }
+        return init;
+    }
+    template<typename type_Range,typename type_Value,typename type_Op = std::plus<>,
+        typename = std::enable_if_t<is_range<type_Range>::value>>
+    type_Value parallel_reduce(ThreadsPool& pool,type_Range&& range,type_Value init,type_Op op = type_Op()){
+        return parallel_reduce(pool,std::begin(range),std::end(range),std::move(init),op);
+    }
+
+    /**
+     * @brief 包含式前缀和，d_first[i] = x0 op x1 op ... op xi
+     * @details
+     *      两遍扫描：第一遍并行计算每块的归约值，串行求出每块的前缀，第二遍并行写出结果。
+     *      op 必须满足结合律；d_first 可以等于 first
+     * @return type_OutIterator 写入的最后一个元素之后的位置
+     */
+    template<typename type_Iterator,typename type_OutIterator,typename type_Op = std::plus<>>
+    type_OutIterator parallel_inclusive_scan(ThreadsPool& pool,type_Iterator first,type_Iterator last,type_OutIterator d_first,
+        type_Op op = type_Op()){
+        static_assert(is_random_access_iterator_v<type_Iterator> && is_random_access_iterator_v<type_OutIterator>,
+            "parallel_inclusive_scan requires random access iterators");
+        using Value = typename std::iterator_traits<type_Iterator>::value_type;
+        std::size_t count = static_cast<std::size_t>(last - first);
+        if(count == 0){
+            return d_first;
+        }
+        std::vector<std::size_t> bounds = parallel_block_bounds(count,parallel_concurrency(pool) * 4);
+        std::size_t blocks = bounds.size() - 1;
+        // 第一遍：每块的归约值，最后一块不需要
+        std::vector<std::optional<Value>> prefixes(blocks);
+        parallel_chunks(pool,blocks - 1,1,[&](std::size_t begin,std::size_t end){
+            for(std::size_t block = begin; block < end; ++block){
+                type_Iterator it = first + bounds[block];
+                type_Iterator block_end = first + bounds[block + 1];
+                Value value = *it;
+                for(++it; it != block_end; ++it){
+                    value = op(std::move(value),*it);
+                }
+                prefixes[block + 1].emplace(std::move(value));
+            }
+        });
+        for(std::size_t block = 2; block < blocks; ++block){
+            prefixes[block] = op(*prefixes[block - 1],std::move(*prefixes[block]));
+        }
+        // 第二遍：以前缀为起点写出每块的结果
+        parallel_chunks(pool,blocks,1,[&](std::size_t begin,std::size_t end){
+            for(std::size_t block = begin; block < end; ++block){
+                type_Iterator it = first + bounds[block];
+                type_Iterator block_end = first + bounds[block + 1];
+                type_OutIterator out = d_first + bounds[block];
+                Value value = prefixes[block] ? op(*prefixes[block],*it) : Value(*it);
+                *out = value;
+                for(++it,++out; it != block_end; ++it,++out){
+                    value = op(std::move(value),*it);
+                    *out = value;
+                }
+            }
+        });
+        return d_first + count;
+    }
+    template<typename type_Range,typename type_OutIterator,typename type_Op = std::plus<>,
+        typename = std::enable_if_t<is_range<type_Range>::value>>
+    type_OutIterator parallel_inclusive_scan(ThreadsPool& pool,type_Range&& range,type_OutIterator d_first,type_Op op = type_Op()){
+        return parallel_inclusive_scan(pool,std::begin(range),std::end(range),d_first,op);
+    }
+
+    /**
+     * @brief 并行排序，不稳定
+     * @details 先把区间分块并行排序，再逐轮两两归并相邻的块，每一轮内的归并并行执行
+     */
+    template<typename type_Iterator,typename type_Compare = std::less<>>
+    void parallel_sort(ThreadsPool& pool,type_Iterator first,type_Iterator last,type_Compare comp = type_Compare()){
+        static_assert(is_random_access_iterator_v<type_Iterator>,"parallel_sort requires random access iterators");
+        // 块太小时归并的开销超过并行的收益
+        constexpr std::size_t min_block = 4096;
+        std::size_t count = static_cast<std::size_t>(last - first);
+        std::size_t blocks = std::min(parallel_concurrency(pool) * 2,count / min_block);
+        if(blocks < 2){
+            std::sort(first,last,comp);
+            return;
+        }
+        std::vector<std::size_t> bounds = parallel_block_bounds(count,blocks);
+        parallel_chunks(pool,blocks,1,[&](std::size_t begin,std::size_t end){
+            for(std::size_t block = begin; block < end; ++block){
+                std::sort(first + bounds[block],first + bounds[block + 1],comp);
+            }
+        });
+        for(std::size_t width = 1; width < blocks; width *= 2){
+            std::size_t pairs = (blocks + 2 * width - 1) / (2 * width);
+            parallel_chunks(pool,pairs,1,[&](std::size_t begin,std::size_t end){
+                for(std::size_t pair = begin; pair < end; ++pair){
+                    std::size_t low = pair * 2 * width;
+                    std::size_t middle = std::min(low + width,blocks);
+                    std::size_t high = std::min(low + 2 * width,blocks);
+                    if(middle < high){
+                        std::inplace_merge(first + bounds[low],first + bounds[middle],first + bounds[high],comp);
+                    }
+                }
+            });
+        }
+    }
+    template<typename type_Range,typename type_Compare = std::less<>,
+        typename = std::enable_if_t<is_range<type_Range>::value>>
+    void parallel_sort(ThreadsPool& pool,type_Range&& range,type_Compare comp = type_Compare()){
+        parallel_sort(pool,std::begin(range),std::end(range),comp);
+    }
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef THREADTOOLS_STRAND_H
+#define THREADTOOLS_STRAND_H
+
+/**
+ * @file Strand.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义串行执行序列（Strand）
+ * @details
+ *      投递到同一个 Strand 的任务会按照投递顺序在线程池上依次执行，任意时刻最多只有一个任务在执行，
+ *      不同 Strand 之间的任务仍然可以并行。需要保持顺序的任务不必独占一个线程
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <mutex>
+#include <queue>
+#include <functional>
+#include <ThreadTools/ThreadsPool.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace ThreadTools{
+        class Strand;
+    }
+}
+
+namespace AntonaStandard::ThreadTools{
+    /**
+     * @brief 串行执行序列
+     * @details
+     *      Strand 内部维护一个任务队列，队列非空时向线程池提交一个排空任务，排空任务依次执行队列中的任务直到队列为空。
+     *      因此同一时刻线程池中最多只有一个属于该 Strand 的排空任务
+     * @warning
+     *      Strand 和它引用的线程池必须比投递到其中的任务活得更久
+     */
+    class Strand{
+        TESTING_MESSAGE
+    private:
+        ThreadsPool& pool;
+        /// @brief 保护任务队列和 running
+        std::mutex mtx;
+        std::queue<std::function<void()>> tasks;
+        /// @brief 是否已经向线程池提交了排空任务
+        bool running;
+        /**
+         * @brief 在线程池中执行，依次取出并执行任务直到队列为空
+         * @details 任务抛出的异常会被忽略，不影响后续任务
+         */
+        void drain();
+    public:
+        explicit Strand(ThreadsPool& pool):pool(pool),running(false){};
+        Strand(const Strand&) = delete;
+        Strand& operator=(const Strand&) = delete;
+        Strand(Strand&&) = delete;
+        Strand& operator=(Strand&&) = delete;
+        virtual ~Strand() = default;
+
+        /**
+         * @brief 投递任务，任务会在之前投递的任务全部完成后执行
+         * @details 线程池在检查之后、提交排空任务之前被关闭时，队列中的任务会在调用方线程中依次执行，不会丢失
+         * @param task
+         * @throw std::runtime_error 调用时线程池已经关闭
+         */
+        void post(std::function<void()> task);
+        /// @brief 获取 Strand 使用的线程池
+        inline ThreadsPool& get_pool(){
+            return this->pool;
+        }
+    };
+}
+
+#endif
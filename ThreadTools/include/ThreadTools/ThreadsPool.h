@@ -179,6 +179,22 @@ namespace AntonaStandard::ThreadTools{
          * 
          */
         void shutdown();
+        /**
+         * @brief 判断线程池是否已经关闭
+         * 
+         * @return true 线程池已关闭，提交的任务不会被执行
+         * @return false 
+         */
+        inline bool has_shutdown()const{
+            return this->is_shutdown.load(std::memory_order_relaxed);
+        }
+        /**
+         * @brief 获取当前存活的工作线程数
+         * @details 调度线程会根据负载增减工作线程，返回值只是一个快照
+         */
+        inline int get_live_thread_num()const{
+            return this->live_thread_num.load(std::memory_order_relaxed);
+        }
         /**
          * @brief 由用户调用，用于向线程池提交任务
          * @details
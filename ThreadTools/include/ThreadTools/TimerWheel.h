@@ -0,0 +1,215 @@
+#ifndef THREADTOOLS_TIMERWHEEL_H
+#define THREADTOOLS_TIMERWHEEL_H
+
+/**
+ * @file TimerWheel.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 定义分层时间轮（TimerWheel）以及由独立线程驱动的定时服务（TimerService）
+ * @details
+ *      时间轮把时间划分为固定长度的刻度（tick），定时器按到期刻度挂在槽位的链表上，插入、取消和重新计时都是 O(1)，
+ *      不需要堆，也不需要为每个定时器开一个线程，适合管理大量连接的空闲、读写超时。
+ *
+ *      与 Linux 内核的定时器相同，时间轮分为 4 层：第 0 层 256 个槽位，每个槽位 1 个刻度；
+ *      第 1~3 层各 64 个槽位，每个槽位分别覆盖 2^8、2^14、2^20 个刻度，总共覆盖 2^26 个刻度（1ms 刻度时约 18.6 小时），
+ *      更远的定时器先挂在最高层，逐层下降时重新计算位置。时间每走完低一层的一圈，就把高一层当前槽位的定时器
+ *      重新分配到低层（级联），每个定时器最多被移动 3 次。
+ *
+ *      定时器节点存放在连续的数组中，通过下标组成双向链表，释放的节点放入空闲链表复用，
+ *      TimerId 中带有节点的版本号，节点复用之后旧的 TimerId 会失效
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <ThreadTools/ThreadsPool.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace ThreadTools{
+        class TimerWheel;
+        class TimerService;
+    }
+}
+
+namespace AntonaStandard::ThreadTools{
+    /**
+     * @brief 分层时间轮
+     * @details
+     *      时间轮本身不加锁，也不创建线程，由所属的线程（例如事件循环或者 TimerService）定期调用 advance 驱动。
+     *      定时器最早在到期刻度被 advance 处理时触发，最多比期望的时间晚一个刻度（以及驱动线程的调度延迟），不会提前触发
+     */
+    class TimerWheel{
+        TESTING_MESSAGE
+    public:
+        using Clock = std::chrono::steady_clock;
+        /// @brief 定时器的标识，0 表示无效
+        using TimerId = std::uint64_t;
+        using Callback = std::function<void()>;
+    private:
+        static constexpr std::uint32_t nil = 0xffffffffu;
+        static constexpr int root_bits = 8;
+        static constexpr int level_bits = 6;
+        static constexpr int levels = 4;
+        static constexpr std::uint64_t root_size = 1u << root_bits;
+        static constexpr std::uint64_t level_size = 1u << level_bits;
+        static constexpr std::uint64_t max_delta = (std::uint64_t(1) << (root_bits + level_bits * (levels - 1))) - 1;
+        static constexpr std::uint32_t slot_count = root_size + level_size * (levels - 1);
+        static constexpr std::uint32_t expiring_slot = slot_count;     ///< 正在触发的定时器所在的链表
+
+        struct Node{
+            Callback callback;
+            std::uint64_t expire = 0;           ///< 到期的刻度
+            std::uint32_t prev = nil;
+            std::uint32_t next = nil;
+            std::uint32_t slot = nil;           ///< 所在的槽位，空闲节点为 nil
+            std::uint32_t generation = 0;       ///< 每次释放加 1，用于识别过期的 TimerId
+        };
+
+        Clock::duration tick;
+        Clock::time_point start;
+        std::uint64_t current;                  ///< 下一个要处理的刻度，之前的刻度都已经处理完毕
+        std::vector<Node> nodes;
+        std::uint32_t free_head;
+        std::vector<std::uint32_t> heads;       ///< 每个槽位链表的第一个节点，最后一个是正在触发的链表
+        std::size_t count;
+        std::size_t root_count;                 ///< 第 0 层的定时器个数，为 0 时 advance 可以直接跳到下一次级联
+
+        std::uint32_t slot_of(std::uint64_t expire)const;
+        void link(std::uint32_t index,std::uint32_t slot);
+        void unlink(std::uint32_t index);
+        std::uint32_t allocate();
+        void release(std::uint32_t index);
+        /// @brief 根据 TimerId 找到有效的节点，无效返回 nil
+        std::uint32_t find(TimerId id)const;
+        std::uint64_t to_tick(Clock::time_point deadline)const;
+        /// @brief 把高层的一个槽位重新分配到低层
+        void cascade(std::uint32_t slot);
+        /// @brief 依次触发正在触发的链表中的定时器
+        std::size_t fire();
+    public:
+        /**
+         * @param tick  刻度的长度，决定定时器的精度
+         * @param start 时间轮的起点，第 0 个刻度从这里开始
+         * @throw std::invalid_argument tick 不是正数
+         */
+        explicit TimerWheel(Clock::duration tick = std::chrono::milliseconds(1),Clock::time_point start = Clock::now());
+        TimerWheel(const TimerWheel&) = delete;
+        TimerWheel& operator=(const TimerWheel&) = delete;
+        virtual ~TimerWheel() = default;
+
+        /**
+         * @brief 添加一个在 deadline 到期的定时器
+         * @details 已经过去的时间点在下一次 advance 时触发
+         * @return TimerId 用于取消或者重新计时
+         */
+        TimerId schedule_at(Clock::time_point deadline,Callback callback);
+        /// @brief 添加一个在 delay 之后到期的定时器
+        inline TimerId schedule(Clock::duration delay,Callback callback){
+            return this->schedule_at(Clock::now() + delay,std::move(callback));
+        }
+        /**
+         * @brief 取消定时器
+         * @return true 取消成功
+         * @return false 定时器已经触发或者已经被取消
+         */
+        bool cancel(TimerId id);
+        /**
+         * @brief 把尚未触发的定时器改为在 deadline 到期，回调不变。常用于收到数据之后推迟空闲超时
+         * @return false 定时器已经触发或者已经被取消
+         */
+        bool restart_at(TimerId id,Clock::time_point deadline);
+        inline bool restart(TimerId id,Clock::duration delay){
+            return this->restart_at(id,Clock::now() + delay);
+        }
+        /**
+         * @brief 推进时间轮到 now，触发所有到期的定时器
+         * @details
+         *      回调在调用 advance 的线程中执行，可以在回调中添加、取消定时器。
+         *      回调抛出的异常会传递给调用方，剩余的到期定时器在下一次 advance 时触发
+         * @return std::size_t 触发的定时器个数
+         */
+        std::size_t advance(Clock::time_point now = Clock::now());
+        /**
+         * @brief 下一次需要调用 advance 的时间
+         * @details
+         *      第 0 层有定时器时是其中最早的到期时间；否则是下一次级联的时间，此时可能没有定时器到期。
+         *      没有定时器时返回 Clock::time_point::max()
+         */
+        Clock::time_point next_deadline()const;
+        /// @brief 尚未触发的定时器个数
+        inline std::size_t size()const{
+            return this->count;
+        }
+        inline bool empty()const{
+            return this->count == 0;
+        }
+        inline Clock::duration get_tick()const{
+            return this->tick;
+        }
+    };
+
+    /**
+     * @brief 由独立线程驱动的线程安全的定时服务
+     * @details
+     *      所有定时器共用一个线程，线程在没有定时器到期时休眠。到期的回调默认在定时线程中执行，
+     *      应当尽快返回；指定线程池时回调被提交到线程池执行，定时线程只负责计时
+     * @warning 线程池必须比 TimerService 活得更久
+     */
+    class TimerService{
+        TESTING_MESSAGE
+    public:
+        using TimerId = TimerWheel::TimerId;
+        using Callback = TimerWheel::Callback;
+    private:
+        std::mutex mtx;
+        std::condition_variable cv;
+        TimerWheel wheel;
+        ThreadsPool* pool;
+        bool is_shutdown;
+        /// @brief 定时线程休眠到的时间点，更早到期的任务需要唤醒它
+        TimerWheel::Clock::time_point sleeping_until;
+        /// @brief 已经到期、等待在锁外执行的任务
+        std::vector<Callback> due;
+        std::thread worker;
+
+        void run();
+    public:
+        /**
+         * @param pool  执行回调的线程池，为空或者已经关闭时在定时线程中执行
+         * @param tick  时间轮刻度的长度
+         */
+        explicit TimerService(ThreadsPool* pool = nullptr,TimerWheel::Clock::duration tick = std::chrono::milliseconds(1));
+        TimerService(const TimerService&) = delete;
+        TimerService& operator=(const TimerService&) = delete;
+        TimerService(TimerService&&) = delete;
+        TimerService& operator=(TimerService&&) = delete;
+        /// @brief 析构时调用 shutdown
+        virtual ~TimerService();
+
+        /**
+         * @brief 添加一个在 delay 之后执行的任务
+         * @throw std::runtime_error 定时服务已经关闭
+         */
+        TimerId schedule(TimerWheel::Clock::duration delay,Callback callback);
+        /// @brief 取消任务，任务已经执行或者正在执行时返回 false
+        bool cancel(TimerId id);
+        /// @brief 把尚未执行的任务推迟到 delay 之后
+        bool restart(TimerId id,TimerWheel::Clock::duration delay);
+        /// @brief 停止定时线程，尚未到期的任务不再执行。可以重复调用
+        void shutdown();
+        /// @brief 尚未执行的任务个数
+        std::size_t size();
+    };
+}
+
+#endif
@@ -0,0 +1,37 @@
+#include <ThreadTools/AsyncDelegate.h>
+#include <chrono>
+
+namespace AntonaStandard::ThreadTools {
+    void AsyncCompletion::set_error(std::exception_ptr exception){
+        std::lock_guard<std::mutex> lck(this->mtx);
+        if(!this->error){
+            this->error = exception;
+        }
+    }
+    void AsyncCompletion::finish_one(){
+        if(this->remaining.fetch_sub(1) != 1){
+            return;
+        }
+        // 最后一个任务，之前所有任务的 set_error 都已经完成
+        std::exception_ptr exception;
+        {
+            std::lock_guard<std::mutex> lck(this->mtx);
+            exception = this->error;
+        }
+        this->on_complete(exception);
+    }
+    void AsyncCompletion::submit_to(ThreadsPool& pool,std::function<void()> task){
+        std::future<void> result = pool.submit(std::move(task));
+        // 提交失败时返回的 future 已经就绪并带有异常；提交成功的任务自己捕获了所有异常，get() 不会抛出
+        if(result.wait_for(std::chrono::seconds(0)) != std::future_status::ready){
+            return;
+        }
+        try{
+            result.get();
+        }
+        catch(...){
+            this->set_error(std::current_exception());
+            this->finish_one();
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#include <ThreadTools/ParallelAlgorithms.h>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+namespace AntonaStandard::ThreadTools{
+    namespace{
+        /**
+         * @brief 一次 parallel_chunks 调用的共享状态
+         * @details
+         *      辅助任务持有 shared_ptr，可能在调用线程返回之后才开始执行。此时所有区间都已领取完，
+         *      辅助任务领取不到区间，不会访问已经失效的 body
+         */
+        struct ChunkJob{
+            const std::function<void(std::size_t,std::size_t)>* body;
+            std::size_t count;
+            std::size_t grain;
+            std::size_t participants;
+            std::atomic<std::size_t> next{0};       ///< 下一个未领取的下标
+            std::atomic<std::size_t> finished{0};   ///< 已处理完的下标个数
+            std::atomic<bool> failed{false};
+            std::mutex mtx;                         ///< 保护 error，搭配 cv 等待 finished
+            std::condition_variable cv;
+            std::exception_ptr error;
+
+            /// @brief 领取一个区间，没有剩余时返回 false
+            bool claim(std::size_t& begin,std::size_t& end){
+                std::size_t current = this->next.load(std::memory_order_relaxed);
+                do{
+                    if(current >= this->count){
+                        return false;
+                    }
+                    std::size_t remaining = this->count - current;
+                    std::size_t size = std::max(this->grain,remaining / (2 * this->participants));
+                    end = current + std::min(size,remaining);
+                }while(!this->next.compare_exchange_weak(current,end,std::memory_order_relaxed));
+                begin = current;
+                return true;
+            }
+
+            void work(){
+                std::size_t begin = 0;
+                std::size_t end = 0;
+                while(this->claim(begin,end)){
+                    if(!this->failed.load(std::memory_order_relaxed)){
+                        try{
+                            (*this->body)(begin,end);
+                        }
+                        catch(...){
+                            std::lock_guard<std::mutex> lck(this->mtx);
+                            if(!this->error){
+                                this->error = std::current_exception();
+                            }
+                            this->failed.store(true,std::memory_order_relaxed);
+                        }
+                    }
+                    std::size_t size = end - begin;
+                    if(this->finished.fetch_add(size,std::memory_order_acq_rel) + size == this->count){
+                        std::lock_guard<std::mutex> lck(this->mtx);
+                        this->cv.notify_all();
+                    }
+                }
+            }
+        };
+    }
+
+    std::size_t parallel_concurrency(const ThreadsPool& pool){
+        // 按照任务实际提交到的线程池划分，多出来的辅助任务只会排队，领取不到区间
+        return static_cast<std::size_t>(std::max(0,pool.get_live_thread_num())) + 1;
+    }
+
+    std::vector<std::size_t> parallel_block_bounds(std::size_t count,std::size_t blocks){
+        blocks = std::max<std::size_t>(1,std::min(blocks,count));
+        std::vector<std::size_t> bounds(blocks + 1);
+        for(std::size_t i = 0; i <= blocks; ++i){
+            bounds[i] = count / blocks * i + std::min(i,count % blocks);
+        }
+        return bounds;
+    }
+
+    void parallel_chunks(ThreadsPool& pool,std::size_t count,std::size_t grain,
+        const std::function<void(std::size_t,std::size_t)>& body){
+        if(count == 0){
+            return;
+        }
+        std::size_t participants = parallel_concurrency(pool);
+        if(grain == 0){
+            grain = std::max<std::size_t>(1,count / (participants * 16));
+        }
+        if(count <= grain || pool.has_shutdown()){
+            body(0,count);
+            return;
+        }
+        auto job = std::make_shared<ChunkJob>();
+        job->body = &body;
+        job->count = count;
+        job->grain = grain;
+        job->participants = participants;
+        std::size_t helpers = std::min(participants - 1,(count + grain - 1) / grain - 1);
+        for(std::size_t i = 0; i < helpers; ++i){
+            // 不需要 future：完成与否由 finished 判断
+            pool.submit([job](){
+                job->work();
+            });
+        }
+        job->work();
+        std::unique_lock<std::mutex> lck(job->mtx);
+        job->cv.wait(lck,[&job](){
+            return job->finished.load(std::memory_order_acquire) == job->count;
+        });
+        if(job->error){
+            std::rethrow_exception(job->error);
+        }
+    }
+}
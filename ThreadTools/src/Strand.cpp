@@ -0,0 +1,55 @@
+#include <ThreadTools/Strand.h>
+#include <chrono>
+#include <stdexcept>
+
+namespace AntonaStandard::ThreadTools {
+    void Strand::drain(){
+        std::function<void()> task;
+        while(true){
+            {
+                std::lock_guard<std::mutex> lck(this->mtx);
+                if(this->tasks.empty()){
+                    this->running = false;
+                    return;
+                }
+                task = std::move(this->tasks.front());
+                this->tasks.pop();
+            }
+            try{
+                task();
+            }
+            catch(...){
+                // 保证后续任务可以继续执行
+            }
+        }
+    }
+    void Strand::post(std::function<void()> task){
+        if(this->pool.has_shutdown()){
+            throw std::runtime_error("thread pool is shutdown");
+        }
+        {
+            std::lock_guard<std::mutex> lck(this->mtx);
+            this->tasks.push(std::move(task));
+            if(this->running){
+                // 正在执行的排空任务会取走这个任务
+                return;
+            }
+            this->running = true;
+        }
+        std::future<void> result = this->pool.submit([this](){
+            this->drain();
+        });
+        // 检查与提交之间线程池可能被关闭，此时返回的 future 已经就绪并带有异常；
+        // 排空任务自己捕获了所有异常，提交成功时 get() 不会抛出
+        if(result.wait_for(std::chrono::seconds(0)) != std::future_status::ready){
+            return;
+        }
+        try{
+            result.get();
+        }
+        catch(...){
+            // 排空任务不会再执行，running 仍为 true 保证其它线程只入队，在调用方线程中依次执行队列中的任务
+            this->drain();
+        }
+    }
+}
@@ -155,7 +155,12 @@ namespace AntonaStandard::ThreadTools {
     }
     void ThreadsPool::shutdown(){
         // 关闭线程池
-        this->is_shutdown.store(true,std::memory_order_release);       // 优先修改
+        {
+            // 在锁内修改，工作线程要么在等待之前看到标志，要么已经在等待并收到下面的通知
+            std::lock_guard<std::mutex> lck(this->mtx_thr_pool);
+            this->is_shutdown.store(true,std::memory_order_release);   // 优先修改
+        }
+        this->cv_thr_pool.notify_all();
         // 关闭管理者线程（防止它创建新线程）
         if(this->manager_thread.joinable()){
             this->manager_thread.join();
@@ -0,0 +1,338 @@
+#include <ThreadTools/TimerWheel.h>
+#include <future>
+#include <stdexcept>
+
+namespace AntonaStandard::ThreadTools {
+    TimerWheel::TimerWheel(Clock::duration tick,Clock::time_point start)
+        :tick(tick),start(start),current(0),free_head(nil),heads(slot_count + 1,nil),count(0),root_count(0){
+        if(tick <= Clock::duration::zero()){
+            throw std::invalid_argument("TimerWheel tick must be positive");
+        }
+    }
+
+    std::uint32_t TimerWheel::slot_of(std::uint64_t expire)const{
+        std::uint64_t delta = expire - this->current;
+        if(delta < root_size){
+            return static_cast<std::uint32_t>(expire & (root_size - 1));
+        }
+        if(delta > max_delta){
+            // 超出时间轮范围的定时器先挂在最高层的最远处，级联时按真实的到期刻度重新分配
+            delta = max_delta;
+            expire = this->current + max_delta;
+        }
+        int level = 1;
+        while(delta >= (std::uint64_t(1) << (root_bits + level_bits * level))){
+            ++level;
+        }
+        std::uint64_t index = (expire >> (root_bits + level_bits * (level - 1))) & (level_size - 1);
+        return static_cast<std::uint32_t>(root_size + level_size * (level - 1) + index);
+    }
+
+    void TimerWheel::link(std::uint32_t index,std::uint32_t slot){
+        Node& node = this->nodes[index];
+        node.slot = slot;
+        node.prev = nil;
+        node.next = this->heads[slot];
+        if(node.next != nil){
+            this->nodes[node.next].prev = index;
+        }
+        this->heads[slot] = index;
+        if(slot < root_size){
+            ++this->root_count;
+        }
+    }
+
+    void TimerWheel::unlink(std::uint32_t index){
+        Node& node = this->nodes[index];
+        if(node.prev != nil){
+            this->nodes[node.prev].next = node.next;
+        }
+        else{
+            this->heads[node.slot] = node.next;
+        }
+        if(node.next != nil){
+            this->nodes[node.next].prev = node.prev;
+        }
+        if(node.slot < root_size){
+            --this->root_count;
+        }
+        node.prev = node.next = nil;
+    }
+
+    std::uint32_t TimerWheel::allocate(){
+        if(this->free_head != nil){
+            std::uint32_t index = this->free_head;
+            this->free_head = this->nodes[index].next;
+            this->nodes[index].next = nil;
+            return index;
+        }
+        if(this->nodes.size() >= nil - 1){
+            throw std::length_error("TimerWheel has too many timers");
+        }
+        this->nodes.emplace_back();
+        return static_cast<std::uint32_t>(this->nodes.size() - 1);
+    }
+
+    void TimerWheel::release(std::uint32_t index){
+        Node& node = this->nodes[index];
+        node.callback = nullptr;
+        node.slot = nil;
+        ++node.generation;
+        node.next = this->free_head;
+        this->free_head = index;
+        --this->count;
+    }
+
+    std::uint32_t TimerWheel::find(TimerId id)const{
+        std::uint64_t low = id & 0xffffffffu;
+        if(low == 0 || low > this->nodes.size()){
+            return nil;
+        }
+        std::uint32_t index = static_cast<std::uint32_t>(low - 1);
+        const Node& node = this->nodes[index];
+        if(node.slot == nil || node.generation != static_cast<std::uint32_t>(id >> 32)){
+            return nil;
+        }
+        return index;
+    }
+
+    std::uint64_t TimerWheel::to_tick(Clock::time_point deadline)const{
+        std::uint64_t expire = 0;
+        if(deadline > this->start){
+            auto elapsed = deadline - this->start;
+            // 向上取整，保证定时器不会提前触发
+            expire = static_cast<std::uint64_t>((elapsed + this->tick - Clock::duration(1)) / this->tick);
+        }
+        return expire < this->current ? this->current : expire;
+    }
+
+    TimerWheel::TimerId TimerWheel::schedule_at(Clock::time_point deadline,Callback callback){
+        std::uint32_t index = this->allocate();
+        Node& node = this->nodes[index];
+        node.callback = std::move(callback);
+        node.expire = this->to_tick(deadline);
+        this->link(index,this->slot_of(node.expire));
+        ++this->count;
+        return (static_cast<TimerId>(node.generation) << 32) | (index + 1);
+    }
+
+    bool TimerWheel::cancel(TimerId id){
+        std::uint32_t index = this->find(id);
+        if(index == nil){
+            return false;
+        }
+        this->unlink(index);
+        this->release(index);
+        return true;
+    }
+
+    bool TimerWheel::restart_at(TimerId id,Clock::time_point deadline){
+        std::uint32_t index = this->find(id);
+        if(index == nil){
+            return false;
+        }
+        this->unlink(index);
+        this->nodes[index].expire = this->to_tick(deadline);
+        this->link(index,this->slot_of(this->nodes[index].expire));
+        return true;
+    }
+
+    void TimerWheel::cascade(std::uint32_t slot){
+        std::uint32_t index = this->heads[slot];
+        this->heads[slot] = nil;
+        while(index != nil){
+            std::uint32_t next = this->nodes[index].next;
+            this->link(index,this->slot_of(this->nodes[index].expire));
+            index = next;
+        }
+    }
+
+    std::size_t TimerWheel::fire(){
+        std::size_t fired = 0;
+        while(this->heads[expiring_slot] != nil){
+            std::uint32_t index = this->heads[expiring_slot];
+            this->unlink(index);
+            // 先释放节点再调用，回调中可以安全地添加定时器
+            Callback callback = std::move(this->nodes[index].callback);
+            this->release(index);
+            ++fired;
+            callback();
+        }
+        return fired;
+    }
+
+    std::size_t TimerWheel::advance(Clock::time_point now){
+        std::size_t fired = this->fire();
+        if(now < this->start){
+            return fired;
+        }
+        std::uint64_t target = static_cast<std::uint64_t>((now - this->start) / this->tick);
+        while(this->current <= target){
+            if(this->count == 0){
+                this->current = target + 1;
+                break;
+            }
+            std::uint64_t now_tick = this->current;
+            std::uint64_t index = now_tick & (root_size - 1);
+            if(index == 0){
+                // 第 0 层走完一圈，把高层当前槽位的定时器分配到低层；高层也走完一圈时继续向上
+                for(int level = 1; level < levels; ++level){
+                    std::uint64_t slot = (now_tick >> (root_bits + level_bits * (level - 1))) & (level_size - 1);
+                    this->cascade(static_cast<std::uint32_t>(root_size + level_size * (level - 1) + slot));
+                    if(slot != 0){
+                        break;
+                    }
+                }
+            }
+            else if(this->root_count == 0){
+                // 第 0 层为空时直接跳到下一次级联
+                std::uint64_t next_cascade = (now_tick | (root_size - 1)) + 1;
+                this->current = next_cascade <= target ? next_cascade : target + 1;
+                continue;
+            }
+            this->current = now_tick + 1;
+            // 把到期的槽位整体移到触发链表，回调中新加入的定时器不会落入其中
+            std::uint32_t head = this->heads[index];
+            this->heads[index] = nil;
+            for(std::uint32_t node = head; node != nil; node = this->nodes[node].next){
+                this->nodes[node].slot = expiring_slot;
+                --this->root_count;
+            }
+            this->heads[expiring_slot] = head;
+            fired += this->fire();
+        }
+        return fired;
+    }
+
+    TimerWheel::Clock::time_point TimerWheel::next_deadline()const{
+        if(this->count == 0){
+            return Clock::time_point::max();
+        }
+        if(this->heads[expiring_slot] != nil){
+            return this->start;
+        }
+        if(this->root_count > 0){
+            for(std::uint64_t tick = this->current; tick < this->current + root_size; ++tick){
+                if(this->heads[tick & (root_size - 1)] != nil){
+                    return this->start + this->tick * tick;
+                }
+            }
+        }
+        std::uint64_t next_cascade = (this->current + root_size - 1) & ~(root_size - 1);
+        return this->start + this->tick * next_cascade;
+    }
+
+    TimerService::TimerService(ThreadsPool* pool,TimerWheel::Clock::duration tick)
+        :wheel(tick),pool(pool),is_shutdown(false),sleeping_until(TimerWheel::Clock::time_point::max()){
+        this->worker = std::thread([this](){
+            this->run();
+        });
+    }
+
+    TimerService::~TimerService(){
+        this->shutdown();
+    }
+
+    void TimerService::run(){
+        std::unique_lock<std::mutex> lck(this->mtx);
+        std::vector<Callback> ready;
+        while(!this->is_shutdown){
+            this->sleeping_until = this->wheel.next_deadline();
+            if(this->sleeping_until == TimerWheel::Clock::time_point::max()){
+                this->cv.wait(lck);
+            }
+            else{
+                this->cv.wait_until(lck,this->sleeping_until);
+            }
+            this->sleeping_until = TimerWheel::Clock::time_point::min();
+            if(this->is_shutdown){
+                break;
+            }
+            // 时间轮中的回调只把任务移到 due，真正的任务在锁外执行，任务中可以再添加定时任务
+            this->wheel.advance();
+            if(this->due.empty()){
+                continue;
+            }
+            ready.swap(this->due);
+            lck.unlock();
+            for(auto& callback:ready){
+                if(this->pool != nullptr){
+                    std::future<void> submitted = this->pool->submit([callback](){
+                        try{
+                            callback();
+                        }
+                        catch(...){
+                            // 与在定时线程中执行时一样忽略
+                        }
+                    });
+                    // 提交成功的任务自己捕获了所有异常，get() 抛出说明线程池已经关闭，退回到定时线程中执行
+                    if(submitted.wait_for(std::chrono::seconds(0)) != std::future_status::ready){
+                        continue;
+                    }
+                    try{
+                        submitted.get();
+                        continue;
+                    }
+                    catch(...){
+                    }
+                }
+                try{
+                    callback();
+                }
+                catch(...){
+                    // 保证后续任务可以继续执行
+                }
+            }
+            ready.clear();
+            lck.lock();
+        }
+    }
+
+    TimerService::TimerId TimerService::schedule(TimerWheel::Clock::duration delay,Callback callback){
+        auto deadline = TimerWheel::Clock::now() + delay;
+        std::lock_guard<std::mutex> lck(this->mtx);
+        if(this->is_shutdown){
+            throw std::runtime_error("timer service is shutdown");
+        }
+        TimerId id = this->wheel.schedule_at(deadline,[this,callback = std::move(callback)]()mutable{
+            this->due.push_back(std::move(callback));
+        });
+        if(deadline < this->sleeping_until){
+            this->cv.notify_one();
+        }
+        return id;
+    }
+
+    bool TimerService::cancel(TimerId id){
+        std::lock_guard<std::mutex> lck(this->mtx);
+        return this->wheel.cancel(id);
+    }
+
+    bool TimerService::restart(TimerId id,TimerWheel::Clock::duration delay){
+        auto deadline = TimerWheel::Clock::now() + delay;
+        std::lock_guard<std::mutex> lck(this->mtx);
+        if(!this->wheel.restart_at(id,deadline)){
+            return false;
+        }
+        if(deadline < this->sleeping_until){
+            this->cv.notify_one();
+        }
+        return true;
+    }
+
+    void TimerService::shutdown(){
+        {
+            std::lock_guard<std::mutex> lck(this->mtx);
+            this->is_shutdown = true;
+        }
+        this->cv.notify_one();
+        if(this->worker.joinable()){
+            this->worker.join();
+        }
+    }
+
+    std::size_t TimerService::size(){
+        std::lock_guard<std::mutex> lck(this->mtx);
+        return this->wheel.size();
+    }
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <ThreadTools/AsyncDelegate.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+    std::atomic<int> sum(0);
+    std::mutex order_mtx;
+    std::vector<int> order;
+
+    void add_value(int value){
+        sum += value;
+    }
+    void add_double(int value){
+        sum += value * 2;
+    }
+    int slow_add(int value){
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        sum += value;
+        return value;
+    }
+    void record_first(int value){
+        std::lock_guard<std::mutex> lck(order_mtx);
+        order.push_back(value * 10 + 1);
+    }
+    void record_second(int value){
+        std::lock_guard<std::mutex> lck(order_mtx);
+        order.push_back(value * 10 + 2);
+    }
+    void throw_error(int){
+        throw std::logic_error("handler failed");
+    }
+}
+
+// 并行与串行分发，通过 future 等待完成
+TEST(Test_AsyncDelegate, ParallelAndSerial){
+    using namespace AntonaStandard::ThreadTools;
+    using namespace AntonaStandard::Utilities;
+    ThreadsPool pool(2, 4);
+    pool.lauch();
+
+    Delegate<void(int)> delegate;
+    delegate += newDelegate(add_value);
+    delegate += newDelegate(add_double);
+
+    sum = 0;
+    async_invoke(pool, delegate, DispatchMode::Parallel, 1).get();
+    EXPECT_EQ(3, sum.load());
+
+    async_invoke(pool, delegate, DispatchMode::Serial, 2).get();
+    EXPECT_EQ(9, sum.load());
+
+    // 非 void 委托的返回值会被丢弃
+    Delegate<int(int)> slow_delegate;
+    slow_delegate += newDelegate(slow_add);
+    auto future = async_invoke(pool, slow_delegate, DispatchMode::Parallel, 5);
+    // 调用方不会被慢的委托函数阻塞
+    EXPECT_EQ(std::future_status::timeout, future.wait_for(std::chrono::milliseconds(0)));
+    future.get();
+    EXPECT_EQ(14, sum.load());
+
+    // 空委托同样在线程池中完成
+    Delegate<void(int)> empty_delegate;
+    EXPECT_EQ(std::future_status::ready, async_invoke(pool, empty_delegate, DispatchMode::Parallel, 1).wait_for(std::chrono::seconds(5)));
+}
+
+// 异常通过 future 传递，其它委托函数不受影响
+TEST(Test_AsyncDelegate, ExceptionAndCallback){
+    using namespace AntonaStandard::ThreadTools;
+    using namespace AntonaStandard::Utilities;
+    ThreadsPool pool(2, 4);
+    pool.lauch();
+
+    ConcurrentDelegate<void(int)> delegate;
+    delegate += newDelegate(throw_error);
+    delegate += newDelegate(add_value);
+
+    sum = 0;
+    auto future = async_invoke(pool, delegate, DispatchMode::Serial, 4);
+    EXPECT_THROW(future.get(), std::logic_error);
+    EXPECT_EQ(4, sum.load());
+
+    std::promise<bool> done;
+    async_invoke_then(pool, delegate, DispatchMode::Parallel, [&done](std::exception_ptr error){
+        done.set_value(error != nullptr);
+    }, 1);
+    EXPECT_TRUE(done.get_future().get());
+    EXPECT_EQ(5, sum.load());
+}
+
+// Strand 上的调用按顺序执行
+TEST(Test_AsyncDelegate, StrandKeepsOrder){
+    using namespace AntonaStandard::ThreadTools;
+    using namespace AntonaStandard::Utilities;
+    ThreadsPool pool(4, 4);
+    pool.lauch();
+    Strand strand(pool);
+
+    Delegate<void(int)> delegate;
+    delegate += newDelegate(record_first);
+    delegate += newDelegate(record_second);
+
+    order.clear();
+    std::vector<std::future<void>> futures;
+    for(int i = 0; i < 50; ++i){
+        futures.push_back(async_invoke(strand, delegate, i));
+    }
+    for(auto& future:futures){
+        future.get();
+    }
+    ASSERT_EQ(100, order.size());
+    for(int i = 0; i < 50; ++i){
+        EXPECT_EQ(i * 10 + 1, order[i * 2]);
+        EXPECT_EQ(i * 10 + 2, order[i * 2 + 1]);
+    }
+}
+
+// 关闭的线程池拒绝调用
+TEST(Test_AsyncDelegate, ShutdownPool){
+    using namespace AntonaStandard::ThreadTools;
+    using namespace AntonaStandard::Utilities;
+    ThreadsPool pool(1, 1);
+    pool.lauch();
+    pool.shutdown();
+    Strand strand(pool);
+
+    Delegate<void(int)> delegate;
+    delegate += newDelegate(add_value);
+    EXPECT_THROW(async_invoke(pool, delegate, DispatchMode::Parallel, 1), std::runtime_error);
+    EXPECT_THROW(async_invoke(strand, delegate, 1), std::runtime_error);
+
+    // 分发过程中线程池关闭，未能提交的任务按异常完成，回调不会丢失
+    std::exception_ptr error;
+    AsyncCompletion completion(1, [&error](std::exception_ptr exception){ error = exception; });
+    completion.submit_to(pool, [](){});
+    ASSERT_TRUE(error != nullptr);
+    EXPECT_THROW(std::rethrow_exception(error), std::runtime_error);
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <ThreadTools/ParallelAlgorithms.h>
+#include <Utilities/Antona_foreach.h>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using AntonaStandard::ThreadTools::ThreadsPool;
+using AntonaStandard::Utilities::r_wrap;
+
+namespace {
+    // 缩短调度线程的轮询间隔，让测试结束时能尽快关闭线程池
+    class TestPool:public ThreadsPool{
+    protected:
+        std::chrono::milliseconds get_manager_waiting_period()override{
+            return std::chrono::milliseconds(10);
+        }
+    public:
+        TestPool():ThreadsPool(2,4){
+            this->lauch();
+        }
+        // 调度线程会调用重写的虚函数，必须在派生类析构之前关闭
+        ~TestPool()override{
+            this->shutdown();
+        }
+    };
+
+    std::vector<int> random_values(std::size_t size, unsigned seed){
+        std::mt19937 engine(seed);
+        std::uniform_int_distribution<int> dist(-1000, 1000);
+        std::vector<int> values(size);
+        for(auto& value:values){
+            value = dist(engine);
+        }
+        return values;
+    }
+}
+
+TEST(Test_ParallelAlgorithms, Chunks){
+    TestPool pool;
+    // 每个下标恰好处理一次
+    for(std::size_t count:{0u, 1u, 7u, 1000u, 100000u}){
+        std::vector<std::atomic<int>> visited(count);
+        AntonaStandard::ThreadTools::parallel_chunks(pool, count, 0, [&](std::size_t begin, std::size_t end){
+            for(std::size_t i = begin; i < end; ++i){
+                visited[i].fetch_add(1);
+            }
+        });
+        for(std::size_t i = 0; i < count; ++i){
+            ASSERT_EQ(1, visited[i].load())<<i;
+        }
+    }
+    EXPECT_EQ(std::vector<std::size_t>({0, 4, 7, 10}), AntonaStandard::ThreadTools::parallel_block_bounds(10, 3));
+    // 参与者按线程池的工作线程数计算，而不是按机器核心数
+    EXPECT_EQ(pool.get_live_thread_num() + 1, static_cast<int>(AntonaStandard::ThreadTools::parallel_concurrency(pool)));
+
+    // 异常传递给调用线程
+    EXPECT_THROW(AntonaStandard::ThreadTools::parallel_chunks(pool, 1000, 1, [](std::size_t begin, std::size_t){
+        if(begin >= 500){
+            throw std::runtime_error("chunk failed");
+        }
+    }), std::runtime_error);
+}
+
+TEST(Test_ParallelAlgorithms, ForEachAndTransform){
+    TestPool pool;
+    std::vector<int> values = random_values(50000, 1);
+    std::vector<int> doubled = values;
+    AntonaStandard::ThreadTools::parallel_for_each(pool, doubled, [](int& value){
+        value *= 2;
+    });
+    for(std::size_t i = 0; i < values.size(); ++i){
+        ASSERT_EQ(values[i] * 2, doubled[i]);
+    }
+
+    // r_wrap 逆向遍历，结果是逆序的
+    std::vector<long long> squares(values.size());
+    auto end = AntonaStandard::ThreadTools::parallel_transform(pool, r_wrap(values), squares.begin(), [](int value){
+        return static_cast<long long>(value) * value;
+    });
+    EXPECT_EQ(squares.end(), end);
+    for(std::size_t i = 0; i < values.size(); ++i){
+        ASSERT_EQ(static_cast<long long>(values[i]) * values[i], squares[values.size() - 1 - i]);
+    }
+
+    int array[] = {1, 2, 3, 4, 5};
+    std::vector<int> reversed(5);
+    AntonaStandard::ThreadTools::parallel_transform(pool, r_wrap(array), reversed.begin(), [](int value){
+        return value;
+    }, 1);
+    EXPECT_EQ(std::vector<int>({5, 4, 3, 2, 1}), reversed);
+}
+
+TEST(Test_ParallelAlgorithms, ReduceAndScan){
+    TestPool pool;
+    std::vector<int> values = random_values(100001, 2);
+    long long expected = std::accumulate(values.begin(), values.end(), 10LL);
+    EXPECT_EQ(expected, AntonaStandard::ThreadTools::parallel_reduce(pool, values, 10LL));
+    EXPECT_EQ(expected, AntonaStandard::ThreadTools::parallel_reduce(pool, values.begin(), values.end(), 10LL));
+    EXPECT_EQ(5, AntonaStandard::ThreadTools::parallel_reduce(pool, values.begin(), values.begin(), 5));
+
+    // 不满足交换律的运算按顺序合并
+    std::vector<std::string> words;
+    std::string joined;
+    for(int i = 0; i < 2000; ++i){
+        words.push_back(std::to_string(i));
+        joined += words.back();
+    }
+    EXPECT_EQ(joined, AntonaStandard::ThreadTools::parallel_reduce(pool, words, std::string()));
+    std::string reversed_joined;
+    for(auto& word:r_wrap(words)){
+        reversed_joined += word;
+    }
+    EXPECT_EQ(reversed_joined, AntonaStandard::ThreadTools::parallel_reduce(pool, r_wrap(words), std::string()));
+
+    std::vector<long long> wide(values.begin(), values.end());
+    std::vector<long long> expected_scan(wide.size());
+    std::partial_sum(wide.begin(), wide.end(), expected_scan.begin());
+    std::vector<long long> scan(wide.size());
+    EXPECT_EQ(scan.end(), AntonaStandard::ThreadTools::parallel_inclusive_scan(pool, wide, scan.begin()));
+    EXPECT_EQ(expected_scan, scan);
+    // 原地计算
+    AntonaStandard::ThreadTools::parallel_inclusive_scan(pool, wide.begin(), wide.end(), wide.begin());
+    EXPECT_EQ(expected_scan, wide);
+
+    std::vector<int> small{3, 1, 4};
+    std::vector<int> small_scan(3);
+    AntonaStandard::ThreadTools::parallel_inclusive_scan(pool, small, small_scan.begin(), [](int lhs, int rhs){
+        return std::max(lhs, rhs);
+    });
+    EXPECT_EQ(std::vector<int>({3, 3, 4}), small_scan);
+}
+
+TEST(Test_ParallelAlgorithms, Sort){
+    TestPool pool;
+    for(std::size_t size:{0u, 10u, 5000u, 200000u}){
+        std::vector<int> values = random_values(size, 3);
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+        AntonaStandard::ThreadTools::parallel_sort(pool, values);
+        ASSERT_EQ(expected, values)<<size;
+
+        // 对逆向视图升序排序，原容器为降序
+        AntonaStandard::ThreadTools::parallel_sort(pool, r_wrap(values));
+        ASSERT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()))<<size;
+    }
+    std::vector<int> values = random_values(100000, 4);
+    AntonaStandard::ThreadTools::parallel_sort(pool, values.begin(), values.end(), std::greater<>());
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end(), std::greater<>()));
+}
+
+TEST(Test_ParallelAlgorithms, NestedInPool){
+    // 在线程池的任务中嵌套调用，所有工作线程都被占用时调用线程独自完成
+    TestPool pool;
+    std::vector<std::future<long long>> futures;
+    std::vector<int> values = random_values(20000, 5);
+    long long expected = std::accumulate(values.begin(), values.end(), 0LL);
+    for(int i = 0; i < 8; ++i){
+        futures.push_back(pool.submit([&pool, &values](){
+            return AntonaStandard::ThreadTools::parallel_reduce(pool, values, 0LL);
+        }));
+    }
+    for(auto& future:futures){
+        EXPECT_EQ(expected, future.get());
+    }
+}
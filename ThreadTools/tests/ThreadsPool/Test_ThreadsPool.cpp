@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <ThreadTools/ThreadsPool.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <vector>
+
+using AntonaStandard::ThreadTools::ThreadsPool;
+
+namespace {
+    // 调度线程轮询间隔较短的线程池，测试结束时可以尽快关闭
+    class QuickPool:public ThreadsPool{
+    protected:
+        virtual std::chrono::milliseconds get_manager_waiting_period()override{
+            return std::chrono::milliseconds(10);
+        }
+    public:
+        QuickPool():ThreadsPool(2, 4){}
+    };
+}
+
+// 关闭时唤醒所有在等待任务的工作线程，不依赖调度线程最后一次是否发出通知
+TEST(Test_ThreadsPool, RepeatedLaunchAndShutdown){
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < 200; ++i){
+        QuickPool pool;
+        pool.lauch();
+        std::vector<std::future<int>> results;
+        for(int j = 0; j < 4; ++j){
+            results.push_back(pool.submit([j](){ return j; }));
+        }
+        int sum = 0;
+        for(auto& result:results){
+            sum += result.get();
+        }
+        EXPECT_EQ(6, sum);
+        pool.shutdown();
+        EXPECT_TRUE(pool.has_shutdown());
+    }
+    // 每次关闭最多等待调度线程的一个轮询周期
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(30));
+}
+
+TEST(Test_ThreadsPool, ShutdownRejectsTasks){
+    QuickPool pool;
+    pool.lauch();
+    pool.shutdown();
+    auto result = pool.submit([](){ return 1; });
+    EXPECT_THROW(result.get(), std::runtime_error);
+}
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+#include <ThreadTools/TimerWheel.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace AntonaStandard::ThreadTools;
+using std::chrono::milliseconds;
+
+namespace {
+    using Clock = TimerWheel::Clock;
+    // 所有时间都相对于固定的起点，不依赖真实的时钟
+    const Clock::time_point origin = Clock::time_point() + std::chrono::hours(1);
+
+    Clock::time_point at(long long ms){
+        return origin + milliseconds(ms);
+    }
+
+    // 调度线程轮询间隔较短的线程池，测试结束时可以尽快关闭
+    class QuickPool:public ThreadsPool{
+    protected:
+        virtual std::chrono::milliseconds get_manager_waiting_period()override{
+            return std::chrono::milliseconds(10);
+        }
+    public:
+        QuickPool():ThreadsPool(2, 4){}
+    };
+}
+
+TEST(Test_TimerWheel, FiresAcrossLevels){
+    TimerWheel wheel(milliseconds(1), origin);
+    // 分别落在第 0~3 层以及超出时间轮范围
+    std::vector<long long> delays{0, 5, 255, 256, 300, 16383, 16384, 20000, 1 << 20, 2000000, 67108863, 100000000};
+    std::vector<int> fired(delays.size(), 0);
+    for(size_t i = 0; i < delays.size(); ++i){
+        wheel.schedule_at(at(delays[i]), [&fired, i](){ ++fired[i]; });
+    }
+    EXPECT_EQ(delays.size(), wheel.size());
+    for(size_t i = 0; i < delays.size(); ++i){
+        if(delays[i] > 0){
+            wheel.advance(at(delays[i] - 1));
+            EXPECT_EQ(0, fired[i]) << "delay " << delays[i];
+        }
+        wheel.advance(at(delays[i]));
+        EXPECT_EQ(1, fired[i]) << "delay " << delays[i];
+        EXPECT_EQ(delays.size() - i - 1, wheel.size());
+    }
+    EXPECT_TRUE(wheel.empty());
+    EXPECT_EQ(Clock::time_point::max(), wheel.next_deadline());
+}
+
+TEST(Test_TimerWheel, CancelAndRestart){
+    TimerWheel wheel(milliseconds(1), origin);
+    int fired = 0;
+    auto first = wheel.schedule_at(at(10), [&](){ ++fired; });
+    auto second = wheel.schedule_at(at(20), [&](){ fired += 10; });
+    EXPECT_TRUE(wheel.cancel(first));
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_FALSE(wheel.cancel(0));
+    // 推迟到第 1 层
+    EXPECT_TRUE(wheel.restart_at(second, at(1000)));
+    EXPECT_EQ(0u, wheel.advance(at(999)));
+    EXPECT_EQ(0, fired);
+    EXPECT_EQ(1u, wheel.advance(at(1000)));
+    EXPECT_EQ(10, fired);
+    EXPECT_FALSE(wheel.restart_at(second, at(2000)));
+
+    // 节点复用之后旧的 TimerId 失效
+    auto reused = wheel.schedule_at(at(1100), [&](){ fired += 100; });
+    EXPECT_NE(reused, first);
+    EXPECT_NE(reused, second);
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_FALSE(wheel.cancel(second));
+    EXPECT_EQ(1u, wheel.size());
+    EXPECT_TRUE(wheel.cancel(reused));
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(Test_TimerWheel, CallbacksModifyWheel){
+    TimerWheel wheel(milliseconds(1), origin);
+    std::vector<long long> fired_at;
+    long long now = 0;
+    // 回调中重新添加自己，间隔恰好是第 0 层的一圈，不能在同一个刻度中再次触发
+    std::function<void()> periodic = [&](){
+        fired_at.push_back(now);
+        if(fired_at.size() < 4){
+            wheel.schedule_at(at(now + 256), periodic);
+        }
+    };
+    wheel.schedule_at(at(0), periodic);
+    // 回调中取消另一个定时器
+    bool victim_fired = false;
+    TimerWheel::TimerId victim = wheel.schedule_at(at(60), [&](){ victim_fired = true; });
+    wheel.schedule_at(at(50), [&](){ EXPECT_TRUE(wheel.cancel(victim)); });
+    for(now = 0; now <= 2000; ++now){
+        wheel.advance(at(now));
+    }
+    EXPECT_EQ((std::vector<long long>{0, 256, 512, 768}), fired_at);
+    EXPECT_FALSE(victim_fired);
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(Test_TimerWheel, MatchesReference){
+    TimerWheel wheel(milliseconds(1), origin);
+    std::mt19937_64 engine(2024);
+    std::uniform_int_distribution<long long> delay(0, 5000000);
+    const int count = 20000;
+    std::vector<long long> deadline(count);
+    std::vector<long long> fired_at(count, -1);
+    std::vector<TimerWheel::TimerId> ids(count);
+    std::vector<bool> cancelled(count, false);
+    long long now = 0;
+    for(int i = 0; i < count; ++i){
+        deadline[i] = delay(engine);
+        ids[i] = wheel.schedule_at(at(deadline[i]), [&, i](){ fired_at[i] = now; });
+    }
+    for(int i = 0; i < count; i += 7){
+        EXPECT_TRUE(wheel.cancel(ids[i]));
+        cancelled[i] = true;
+    }
+    for(int i = 3; i < count; i += 11){
+        if(!cancelled[i]){
+            deadline[i] = delay(engine);
+            EXPECT_TRUE(wheel.restart_at(ids[i], at(deadline[i])));
+        }
+    }
+    std::uniform_int_distribution<long long> step(1, 3000);
+    while(!wheel.empty()){
+        now += step(engine);
+        wheel.advance(at(now));
+        if(!wheel.empty()){
+            EXPECT_LE(wheel.next_deadline(), at(now) + milliseconds(256));
+        }
+    }
+    long long last = 0;
+    for(int i = 0; i < count; ++i){
+        if(cancelled[i]){
+            EXPECT_EQ(-1, fired_at[i]);
+            continue;
+        }
+        // 在第一次 now >= deadline 的 advance 中触发
+        ASSERT_GE(fired_at[i], deadline[i]) << i;
+        ASSERT_LT(fired_at[i] - deadline[i], 3000) << i;
+        last = std::max(last, fired_at[i]);
+    }
+    EXPECT_GT(last, 0);
+}
+
+TEST(Test_TimerWheel, NextDeadline){
+    TimerWheel wheel(milliseconds(1), origin);
+    EXPECT_EQ(Clock::time_point::max(), wheel.next_deadline());
+    auto far = wheel.schedule_at(at(1000), [](){});
+    // 第 0 层为空时需要在下一次级联时推进
+    EXPECT_EQ(at(0), wheel.next_deadline());
+    wheel.advance(at(1));
+    EXPECT_EQ(at(256), wheel.next_deadline());
+    wheel.schedule_at(at(10), [](){});
+    EXPECT_EQ(at(10), wheel.next_deadline());
+    wheel.advance(at(10));
+    EXPECT_EQ(at(256), wheel.next_deadline());
+    wheel.advance(at(768));
+    EXPECT_EQ(at(1000), wheel.next_deadline());
+    EXPECT_TRUE(wheel.cancel(far));
+    EXPECT_THROW(TimerWheel(milliseconds(0)), std::invalid_argument);
+}
+
+TEST(Test_TimerService, RunsOnTimerThread){
+    TimerService service;
+    std::promise<std::vector<int>> done;
+    std::vector<int> order;
+    std::mutex mtx;
+    auto record = [&](int value){
+        std::lock_guard<std::mutex> lck(mtx);
+        order.push_back(value);
+        if(order.size() == 3){
+            done.set_value(order);
+        }
+    };
+    // 取消和重新计时都在到期之前很久完成，不受调度延迟影响
+    auto start = Clock::now();
+    service.schedule(milliseconds(150), [&](){ record(3); });
+    service.schedule(milliseconds(50), [&](){ record(1); });
+    auto cancelled = service.schedule(milliseconds(75), [&](){ record(-1); });
+    auto delayed = service.schedule(milliseconds(200), [&](){ record(2); });
+    EXPECT_TRUE(service.cancel(cancelled));
+    EXPECT_TRUE(service.restart(delayed, milliseconds(100)));
+    auto future = done.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(5)));
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), future.get());
+    EXPECT_GE(Clock::now() - start, milliseconds(150));
+    EXPECT_FALSE(service.cancel(delayed));
+    EXPECT_EQ(0u, service.size());
+
+    // 关闭之后尚未到期的任务不再执行
+    std::atomic<bool> late{false};
+    service.schedule(milliseconds(50), [&](){ late = true; });
+    service.shutdown();
+    EXPECT_THROW(service.schedule(milliseconds(1), [](){}), std::runtime_error);
+    std::this_thread::sleep_for(milliseconds(80));
+    EXPECT_FALSE(late.load());
+}
+
+TEST(Test_TimerService, SubmitsToThreadsPool){
+    QuickPool pool;
+    pool.lauch();
+    std::atomic<int> fired{0};
+    std::atomic<bool> blocked{true};
+    {
+        TimerService service(&pool);
+        // 长时间运行的任务在线程池中执行，不会推迟其它定时任务
+        service.schedule(milliseconds(1), [&](){
+            while(blocked.load()){
+                std::this_thread::sleep_for(milliseconds(1));
+            }
+        });
+        for(int i = 0; i < 100; ++i){
+            service.schedule(milliseconds(5 + i % 10), [&](){ ++fired; });
+        }
+        auto deadline = Clock::now() + std::chrono::seconds(5);
+        while(fired.load() < 100 && Clock::now() < deadline){
+            std::this_thread::sleep_for(milliseconds(1));
+        }
+        EXPECT_EQ(100, fired.load());
+        blocked = false;
+    }
+    pool.shutdown();
+
+    // 线程池关闭之后回调退回到定时线程中执行，不会丢失
+    TimerService service(&pool);
+    std::promise<std::thread::id> ran;
+    service.schedule(milliseconds(1), [&](){ ran.set_value(std::this_thread::get_id()); });
+    auto future = ran.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(5)));
+    EXPECT_NE(std::this_thread::get_id(), future.get());
+}
@@ -0,0 +1,314 @@
+/**
+ * @file BinarySerializer.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 基于成员变量元数据的二进制序列化
+ * @details
+ *      对通过 REFLECT_FIELDS 注册的类型生成二进制编码和解码，直接读写 CPS::SocketDataBuffer 的连续内存：
+ *      - 编码前先计算编码后的总长度，只扩容一次，之后逐个成员直接写入，不经过 std::stringstream
+ *      - 所有成员的编解码在编译期展开，没有虚函数调用
+ *      - 解码时检查边界，数据不完整时抛出异常并且不移动缓冲区的读取位点
+ *
+ *      编码格式（小端序）：
+ *      - 算术类型和枚举：按照类型大小定长编码
+ *      - std::string：uint32 长度 + 字节
+ *      - std::vector<T>：uint32 元素个数 + 逐个元素
+ *      - std::array<T,N>：逐个元素
+ *      - 注册了成员变量的类：按照注册顺序逐个成员编码
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_BINARYSERIALIZER_H
+#define UTILITIES_BINARYSERIALIZER_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <CPS/Socket.h>
+#include <Globals/Exception.h>
+#include <Utilities/FieldReflection.h>
+
+namespace AntonaStandard{
+    namespace Utilities{
+        template<typename type_VALUE,typename = void>
+        struct BinaryCodec;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /// @brief 主机字节序是否为小端序，小端序主机上编解码退化为 memcpy
+    constexpr bool binary_host_little_endian =
+    #if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        false;
+    #else
+        true;
+    #endif
+
+    /// @brief 以小端序写入算术类型，返回写入后的位置
+    template<typename type_VALUE>
+    inline char* binaryStore(char* out,type_VALUE value){
+        if constexpr(binary_host_little_endian || sizeof(type_VALUE) == 1){
+            std::memcpy(out,&value,sizeof(type_VALUE));
+        }
+        else{
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            for(std::size_t i = 0; i < sizeof(type_VALUE); ++i){
+                out[i] = bytes[sizeof(type_VALUE) - 1 - i];
+            }
+        }
+        return out + sizeof(type_VALUE);
+    }
+
+    /// @brief 以小端序读取算术类型，调用方负责检查边界
+    template<typename type_VALUE>
+    inline const char* binaryLoad(const char* in,type_VALUE& value){
+        if constexpr(binary_host_little_endian || sizeof(type_VALUE) == 1){
+            std::memcpy(&value,in,sizeof(type_VALUE));
+        }
+        else{
+            char* bytes = reinterpret_cast<char*>(&value);
+            for(std::size_t i = 0; i < sizeof(type_VALUE); ++i){
+                bytes[i] = in[sizeof(type_VALUE) - 1 - i];
+            }
+        }
+        return in + sizeof(type_VALUE);
+    }
+
+    /// @brief 检查剩余数据是否足够
+    inline void binaryRequire(const char* in,const char* end,std::size_t size){
+        if(static_cast<std::size_t>(end - in) < size){
+            throw AntonaStandard::Globals::DataCorrupted_Error("The binary data is truncated!");
+        }
+    }
+
+    /// @brief 写入长度前缀
+    inline char* binaryStoreLength(char* out,std::size_t length){
+        if(length > UINT32_MAX){
+            throw AntonaStandard::Globals::WrongArgument_Error("The length is too large to be serialized!");
+        }
+        return binaryStore(out,static_cast<std::uint32_t>(length));
+    }
+
+    /// @brief 读取长度前缀
+    inline const char* binaryLoadLength(const char* in,const char* end,std::uint32_t& length){
+        binaryRequire(in,end,sizeof(std::uint32_t));
+        return binaryLoad(in,length);
+    }
+
+    /**
+     * @brief 算术类型和枚举的编解码
+     */
+    template<typename type_VALUE>
+    struct BinaryCodec<type_VALUE,std::enable_if_t<std::is_arithmetic<type_VALUE>::value || std::is_enum<type_VALUE>::value>>{
+        static constexpr std::size_t size(const type_VALUE&){
+            return sizeof(type_VALUE);
+        }
+        static inline char* encode(char* out,const type_VALUE& value){
+            if constexpr(std::is_enum<type_VALUE>::value){
+                return binaryStore(out,static_cast<std::underlying_type_t<type_VALUE>>(value));
+            }
+            else{
+                return binaryStore(out,value);
+            }
+        }
+        static inline const char* decode(const char* in,const char* end,type_VALUE& value){
+            binaryRequire(in,end,sizeof(type_VALUE));
+            if constexpr(std::is_enum<type_VALUE>::value){
+                std::underlying_type_t<type_VALUE> raw;
+                in = binaryLoad(in,raw);
+                value = static_cast<type_VALUE>(raw);
+                return in;
+            }
+            else{
+                return binaryLoad(in,value);
+            }
+        }
+    };
+
+    /**
+     * @brief std::string 的编解码
+     */
+    template<>
+    struct BinaryCodec<std::string,void>{
+        static inline std::size_t size(const std::string& value){
+            return sizeof(std::uint32_t) + value.size();
+        }
+        static inline char* encode(char* out,const std::string& value){
+            out = binaryStoreLength(out,value.size());
+            std::memcpy(out,value.data(),value.size());
+            return out + value.size();
+        }
+        static inline const char* decode(const char* in,const char* end,std::string& value){
+            std::uint32_t length = 0;
+            in = binaryLoadLength(in,end,length);
+            binaryRequire(in,end,length);
+            value.assign(in,length);
+            return in + length;
+        }
+    };
+
+    /**
+     * @brief std::vector 的编解码
+     * @details 小端序主机上算术类型的数组整体拷贝
+     */
+    template<typename type_ELEMENT,typename type_ALLOCATOR>
+    struct BinaryCodec<std::vector<type_ELEMENT,type_ALLOCATOR>,void>{
+        using Vector = std::vector<type_ELEMENT,type_ALLOCATOR>;
+        static constexpr bool bulk = binary_host_little_endian && std::is_arithmetic<type_ELEMENT>::value && !std::is_same<type_ELEMENT,bool>::value;
+
+        static inline std::size_t size(const Vector& value){
+            if constexpr(bulk){
+                return sizeof(std::uint32_t) + value.size() * sizeof(type_ELEMENT);
+            }
+            else{
+                std::size_t total = sizeof(std::uint32_t);
+                for(const auto& element:value){
+                    total += BinaryCodec<type_ELEMENT>::size(element);
+                }
+                return total;
+            }
+        }
+        static inline char* encode(char* out,const Vector& value){
+            out = binaryStoreLength(out,value.size());
+            if constexpr(bulk){
+                std::memcpy(out,value.data(),value.size() * sizeof(type_ELEMENT));
+                return out + value.size() * sizeof(type_ELEMENT);
+            }
+            else{
+                for(const auto& element:value){
+                    out = BinaryCodec<type_ELEMENT>::encode(out,element);
+                }
+                return out;
+            }
+        }
+        static inline const char* decode(const char* in,const char* end,Vector& value){
+            std::uint32_t length = 0;
+            in = binaryLoadLength(in,end,length);
+            if constexpr(bulk){
+                binaryRequire(in,end,std::size_t(length) * sizeof(type_ELEMENT));
+                value.resize(length);
+                std::memcpy(value.data(),in,std::size_t(length) * sizeof(type_ELEMENT));
+                return in + std::size_t(length) * sizeof(type_ELEMENT);
+            }
+            else{
+                // 每个元素至少占一个字节，先检查一下防止恶意的长度导致大量分配
+                binaryRequire(in,end,length);
+                value.resize(length);
+                for(auto&& element:value){
+                    type_ELEMENT temp{};
+                    in = BinaryCodec<type_ELEMENT>::decode(in,end,temp);
+                    element = std::move(temp);
+                }
+                return in;
+            }
+        }
+    };
+
+    /**
+     * @brief std::array 的编解码
+     */
+    template<typename type_ELEMENT,std::size_t N>
+    struct BinaryCodec<std::array<type_ELEMENT,N>,void>{
+        static inline std::size_t size(const std::array<type_ELEMENT,N>& value){
+            std::size_t total = 0;
+            for(const auto& element:value){
+                total += BinaryCodec<type_ELEMENT>::size(element);
+            }
+            return total;
+        }
+        static inline char* encode(char* out,const std::array<type_ELEMENT,N>& value){
+            for(const auto& element:value){
+                out = BinaryCodec<type_ELEMENT>::encode(out,element);
+            }
+            return out;
+        }
+        static inline const char* decode(const char* in,const char* end,std::array<type_ELEMENT,N>& value){
+            for(auto& element:value){
+                in = BinaryCodec<type_ELEMENT>::decode(in,end,element);
+            }
+            return in;
+        }
+    };
+
+    /**
+     * @brief 注册了成员变量的类的编解码，按照注册顺序逐个成员处理
+     */
+    template<typename type_CLASS>
+    struct BinaryCodec<type_CLASS,std::enable_if_t<hasFieldMetadata_v<type_CLASS>>>{
+        static inline std::size_t size(const type_CLASS& value){
+            return std::apply([&value](const auto&... fields){
+                return (std::size_t(0) + ... + BinaryCodec<typename std::decay_t<decltype(fields)>::Type>::size(fields.get(value)));
+            },fieldsOf<type_CLASS>());
+        }
+        static inline char* encode(char* out,const type_CLASS& value){
+            std::apply([&out,&value](const auto&... fields){
+                ((out = BinaryCodec<typename std::decay_t<decltype(fields)>::Type>::encode(out,fields.get(value))),...);
+            },fieldsOf<type_CLASS>());
+            return out;
+        }
+        static inline const char* decode(const char* in,const char* end,type_CLASS& value){
+            std::apply([&in,end,&value](const auto&... fields){
+                ((in = BinaryCodec<typename std::decay_t<decltype(fields)>::Type>::decode(in,end,fields.get(value))),...);
+            },fieldsOf<type_CLASS>());
+            return in;
+        }
+    };
+
+    /// @brief 计算对象编码后的字节数
+    template<typename type_VALUE>
+    inline std::size_t encodedSize(const type_VALUE& value){
+        return BinaryCodec<type_VALUE>::size(value);
+    }
+
+    /**
+     * @brief 将对象编码到 out 指向的内存，out 的空间不能小于 encodedSize(value)
+     * @return std::size_t 写入的字节数
+     */
+    template<typename type_VALUE>
+    inline std::size_t serialize(char* out,const type_VALUE& value){
+        return BinaryCodec<type_VALUE>::encode(out,value) - out;
+    }
+
+    /**
+     * @brief 将对象编码后追加到缓冲区的写入位点之后，缓冲区只会扩容一次
+     * @return std::size_t 写入的字节数
+     */
+    template<typename type_VALUE>
+    inline std::size_t serialize(AntonaStandard::CPS::SocketDataBuffer& buffer,const type_VALUE& value){
+        std::size_t size = encodedSize(value);
+        buffer.ensureReceivableSize(size);
+        BinaryCodec<type_VALUE>::encode(buffer.receivingPos(),value);
+        buffer.movePutPos(size);
+        return size;
+    }
+
+    /**
+     * @brief 从 in 指向的内存解码对象
+     * @return std::size_t 读取的字节数
+     * @throw AntonaStandard::Globals::DataCorrupted_Error 数据不完整
+     */
+    template<typename type_VALUE>
+    inline std::size_t deserialize(const char* in,std::size_t size,type_VALUE& value){
+        return BinaryCodec<type_VALUE>::decode(in,in + size,value) - in;
+    }
+
+    /**
+     * @brief 从缓冲区的读取位点解码对象，成功后移动读取位点
+     * @return std::size_t 读取的字节数
+     * @throw AntonaStandard::Globals::DataCorrupted_Error 数据不完整，此时读取位点不变
+     */
+    template<typename type_VALUE>
+    inline std::size_t deserialize(AntonaStandard::CPS::SocketDataBuffer& buffer,type_VALUE& value){
+        std::size_t size = deserialize(buffer.readingPos(),buffer.getReadableSize(),value);
+        buffer.moveGetPos(size);
+        return size;
+    }
+}
+#endif
@@ -0,0 +1,211 @@
+/**
+ * @file ConcurrentDelegate.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 线程安全的事件委托
+ * @details
+ *      Delegate 的并发版本，委托函数存储在一个不可变的数组中，由 RcuPointer 管理：
+ *      - 调用委托时只获取数组的快照，不加锁，也不会被添加和移除委托阻塞
+ *      - 添加和移除委托时拷贝一份数组进行修改，然后原子地发布，调用方永远不会看到修改到一半的数组
+ *      适用于调用频繁、增删委托较少的场景
+ * @warning
+ *      委托函数内不能对正在调用它的 ConcurrentDelegate 进行增删操作，原因见 RcuPointer
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_CONCURRENTDELEGATE_H
+#define UTILITIES_CONCURRENTDELEGATE_H
+
+#include <vector>
+#include <memory>
+#include <Utilities/Delegate.h>
+#include <Utilities/RcuPointer.h>
+#include <Globals/Exception.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Utilities{
+        template<typename type_RETURN_VALUE, typename... type_PARAMETERS_PACK>
+        class ConcurrentDelegateBase;
+
+        template<typename type_RETURN_VALUE, typename... type_PARAMETERS_PACK>
+        class ConcurrentDelegate;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /**
+     * @brief 线程安全委托的公共部分，负责委托函数的存储和增删
+     *
+     * @tparam type_RETURN_VALUE
+     * @tparam type_PARAMETERS_PACK
+     */
+    template<typename type_RETURN_VALUE, typename... type_PARAMETERS_PACK>
+    class ConcurrentDelegateBase{
+        TESTING_MESSAGE
+    public:
+        using Container = BaseFuncPointerContainer<type_RETURN_VALUE,type_PARAMETERS_PACK...>;
+        /// @brief 容器由不同版本的数组共享，最后一个引用它的数组被释放时才删除
+        using ContainerPtr = std::shared_ptr<Container>;
+        using DelegateArray = std::vector<ContainerPtr>;
+        using ReadGuard = typename RcuPointer<DelegateArray>::ReadGuard;
+    protected:
+        RcuPointer<DelegateArray> delegateArray;
+
+        /**
+         * @brief 添加委托，重复的委托会被忽略
+         * @param other_ptr 由 newDelegate 创建的容器，所有权转移给委托
+         */
+        void add(Container* other_ptr){
+            ContainerPtr new_container(other_ptr);
+            this->delegateArray.update([&new_container](DelegateArray& arr){
+                for(auto& container:arr){
+                    if(container->equal(new_container.get())){
+                        return false;
+                    }
+                }
+                arr.push_back(new_container);
+                return true;
+            });
+        }
+        /**
+         * @brief 移除委托
+         * @param other_ptr 由 newDelegate 创建的容器，仅用于比较，函数返回前会被删除
+         * @throw AntonaStandard::Globals::NotFound_Error 没有找到对应的委托
+         */
+        void remove(Container* other_ptr){
+            std::unique_ptr<Container> target(other_ptr);
+            bool found = this->delegateArray.update([&target](DelegateArray& arr){
+                for(auto iter = arr.begin();iter != arr.end();++iter){
+                    if((*iter)->equal(target.get())){
+                        arr.erase(iter);
+                        return true;
+                    }
+                }
+                return false;
+            });
+            if(!found){
+                throw AntonaStandard::Globals::NotFound_Error("The function pointer was not found,fail to delete its container!");
+            }
+        }
+    public:
+        ConcurrentDelegateBase() = default;
+        ConcurrentDelegateBase(const ConcurrentDelegateBase&) = delete;
+        ConcurrentDelegateBase& operator=(const ConcurrentDelegateBase&) = delete;
+        virtual ~ConcurrentDelegateBase() = default;
+
+        /// @brief 获取委托数量
+        inline unsigned long size()const{
+            return this->delegateArray.read()->size();
+        }
+        /// @brief 判断委托是否为空
+        inline bool empty()const{
+            return this->delegateArray.read()->empty();
+        }
+        /// @brief 清空委托
+        void clear(){
+            this->delegateArray.reset(DelegateArray());
+        }
+        /**
+         * @brief 获取当前委托数组的快照
+         * @details 快照在返回的 ReadGuard 析构前有效，期间其它线程的增删不会影响它
+         * @return ReadGuard
+         */
+        inline ReadGuard snapshot()const{
+            return this->delegateArray.read();
+        }
+        /// @brief 以无返回值的形式调用所有委托
+        void call_without_return(type_PARAMETERS_PACK... parama_args){
+            auto guard = this->delegateArray.read();
+            for(auto& container:*guard){
+                container->call(parama_args...);
+            }
+        }
+    };
+
+    /**
+     * @brief 线程安全的委托类
+     *
+     * @tparam type_RETURN_VALUE
+     * @tparam type_PARAMETERS_PACK
+     */
+    template<typename type_RETURN_VALUE, typename... type_PARAMETERS_PACK>
+    class ConcurrentDelegate<type_RETURN_VALUE(type_PARAMETERS_PACK...)>
+        :public ConcurrentDelegateBase<type_RETURN_VALUE,type_PARAMETERS_PACK...>{
+    public:
+        using Base = ConcurrentDelegateBase<type_RETURN_VALUE,type_PARAMETERS_PACK...>;
+
+        ConcurrentDelegate() = default;
+        virtual ~ConcurrentDelegate() = default;
+
+        /// @brief 添加委托
+        ConcurrentDelegate& operator+=(typename Base::Container* other_ptr){
+            this->add(other_ptr);
+            return *this;
+        }
+        /// @brief 移除委托
+        ConcurrentDelegate& operator-=(typename Base::Container* other_ptr){
+            this->remove(other_ptr);
+            return *this;
+        }
+        /**
+         * @brief 调用所有的委托函数
+         * @details 所有委托的函数的返回值会脱去引用拷贝到一个vector对象中返回
+         * @param parama_args
+         * @return std::vector<typename std::remove_reference<type_RETURN_VALUE>::type>
+         */
+        std::vector<typename std::remove_reference<type_RETURN_VALUE>::type> operator()(type_PARAMETERS_PACK... parama_args){
+            auto guard = this->delegateArray.read();
+            std::vector<typename std::remove_reference<type_RETURN_VALUE>::type> temp_vec;
+            temp_vec.reserve(guard->size());
+            for(auto& container:*guard){
+                temp_vec.push_back(container->call(parama_args...));
+            }
+            return temp_vec;
+        }
+        /**
+         * @brief 调用所有的委托函数，返回值交给合并策略处理，不分配内存
+         * @see Delegate::combine
+         */
+        template<typename type_COMBINER>
+        auto combine(type_COMBINER combiner,type_PARAMETERS_PACK... parama_args)->decltype(combiner.result()){
+            auto guard = this->delegateArray.read();
+            for(auto& container:*guard){
+                if(!combiner.accept(container->call(parama_args...))){
+                    break;
+                }
+            }
+            return combiner.result();
+        }
+    };
+
+    /**
+     * @brief 线程安全的委托类，返回值是 void 的特化版本
+     *
+     * @tparam type_PARAMETERS_PACK
+     */
+    template<typename... type_PARAMETERS_PACK>
+    class ConcurrentDelegate<void(type_PARAMETERS_PACK...)>
+        :public ConcurrentDelegateBase<void,type_PARAMETERS_PACK...>{
+    public:
+        using Base = ConcurrentDelegateBase<void,type_PARAMETERS_PACK...>;
+
+        ConcurrentDelegate() = default;
+        virtual ~ConcurrentDelegate() = default;
+
+        ConcurrentDelegate& operator+=(typename Base::Container* other_ptr){
+            this->add(other_ptr);
+            return *this;
+        }
+        ConcurrentDelegate& operator-=(typename Base::Container* other_ptr){
+            this->remove(other_ptr);
+            return *this;
+        }
+        void operator()(type_PARAMETERS_PACK... parama_args){
+            this->call_without_return(parama_args...);
+        }
+    };
+}
+#endif
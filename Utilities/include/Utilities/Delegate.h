@@ -6,7 +6,7 @@
  *      模拟实现了 std::function 和 std::bind 的功能
  *      该项目更多是用于练手，研究模板编程，因为论功能和安全性都比不过 std::function 和 std::bind（std::function 可以通过异步框架保证线程安全）
  * @warning
- *      该事件委托线程不安全，请在必要的时刻加锁
+ *      该事件委托线程不安全，请在必要的时刻加锁。需要在多线程中一边调用一边增删委托时请使用 ConcurrentDelegate（Utilities/ConcurrentDelegate.h）
  * @version 0.1
  * @date 2024-03-07
  * 
@@ -20,6 +20,7 @@
 #include <list>
 #include <stdexcept>
 #include <Globals/Exception.h>
+#include <Utilities/DelegateCombiner.h>
 #include <TestingSupport/TestingMessageMacro.h>
 
 
@@ -232,6 +233,10 @@ namespace AntonaStandard::Utilities{
         inline virtual bool empty()const{
             return this->delegateList.empty();
         }
+        /// @brief 获取委托链表，只读
+        inline const DelegateList& getDelegateList()const{
+            return this->delegateList;
+        }
         /// @brief 清空委托
         virtual void clear();
         /// @brief 添加委托
@@ -253,6 +258,17 @@ namespace AntonaStandard::Utilities{
         virtual  std::vector<typename std::remove_reference<type_RETURN_VALUE>::type> operator()(type_PARAMETERS_PACK... parama_args);
         /// @brief 返回值如果要存到一个vector中效率较低，这里提供一个无返回值的接口
         virtual void call_without_return(type_PARAMETERS_PACK... parama_args);
+        /**
+         * @brief 调用所有的委托函数，返回值交给合并策略处理，不分配内存
+         * @details
+         *      合并策略见 DelegateCombiner.h，combiner.accept() 返回 false 时剩余的委托不再调用
+         * @tparam type_COMBINER 
+         * @param combiner 
+         * @param parama_args 
+         * @return combiner.result() 的返回值
+         */
+        template<typename type_COMBINER>
+        auto combine(type_COMBINER combiner,type_PARAMETERS_PACK... parama_args)->decltype(combiner.result());
 
         //  左值赋值构造函数，和赋值函数
         Delegate(const Delegate&);
@@ -294,6 +310,10 @@ namespace AntonaStandard::Utilities{
             // 判断委托是否为空
         inline virtual bool empty()const{
             return this->delegateList.empty();
+        }
+        /// @brief 获取委托链表，只读
+        inline const DelegateList& getDelegateList()const{
+            return this->delegateList;
         }
             // 清空委托
         virtual void clear();
@@ -489,6 +509,22 @@ namespace AntonaStandard::Utilities{
         }
     }
 
+        // 通过合并策略处理返回值
+    template<typename type_RETURN_VALUE, typename... type_PARAMETERS_PACK> 
+    template<typename type_COMBINER>
+    auto
+    Delegate<type_RETURN_VALUE(type_PARAMETERS_PACK...)>::
+    combine(type_COMBINER combiner,type_PARAMETERS_PACK... parama_args)->decltype(combiner.result()){
+        DelegateListIterator iter = this->delegateList.begin();
+        while(iter != this->delegateList.end()){
+            if(!combiner.accept((*iter)->call(parama_args...))){
+                break;
+            }
+            ++iter;
+        }
+        return combiner.result();
+    }
+
     // 左值引用复制构造函数
     template<typename type_RETURN_VALUE, typename... type_PARAMETERS_PACK> 
     Delegate<type_RETURN_VALUE(type_PARAMETERS_PACK...)>::
@@ -0,0 +1,173 @@
+/**
+ * @file DelegateCombiner.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 委托返回值的合并策略
+ * @details
+ *      Delegate::operator() 会把每个委托的返回值拷贝到一个新建的 std::vector 中，每次调用都要分配内存。
+ *      合并策略（Combiner）在调用过程中逐个接收返回值，只保留需要的结果，配合 Delegate::combine 使用不会分配内存。
+ *      一个合并策略需要提供以下两个接口：
+ *      - `bool accept(value)` 接收一个委托的返回值，返回 false 表示不再调用剩余的委托
+ *      - `result()` 调用结束后获取合并结果
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_DELEGATECOMBINER_H
+#define UTILITIES_DELEGATECOMBINER_H
+
+#include <optional>
+#include <utility>
+
+namespace AntonaStandard{
+    namespace Utilities{
+        template<typename type_VALUE>
+        class FirstCombiner;
+
+        template<typename type_VALUE>
+        class LastCombiner;
+
+        template<typename type_ACCUMULATOR,typename type_FUNC>
+        class ReduceCombiner;
+
+        template<typename type_OUTPUT_ITERATOR>
+        class OutputCombiner;
+
+        template<typename type_VALUE,typename type_PREDICATE>
+        class UntilCombiner;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /**
+     * @brief 保留第一个委托的返回值，所有委托都会被调用
+     * @tparam type_VALUE
+     */
+    template<typename type_VALUE>
+    class FirstCombiner{
+    private:
+        std::optional<type_VALUE> value;
+    public:
+        template<typename type_ARG>
+        inline bool accept(type_ARG&& arg){
+            if(!this->value.has_value()){
+                this->value.emplace(std::forward<type_ARG>(arg));
+            }
+            return true;
+        }
+        /// @brief 没有委托时返回 std::nullopt
+        inline std::optional<type_VALUE> result(){
+            return std::move(this->value);
+        }
+    };
+
+    /**
+     * @brief 保留最后一个委托的返回值
+     * @tparam type_VALUE
+     */
+    template<typename type_VALUE>
+    class LastCombiner{
+    private:
+        std::optional<type_VALUE> value;
+    public:
+        template<typename type_ARG>
+        inline bool accept(type_ARG&& arg){
+            this->value.emplace(std::forward<type_ARG>(arg));
+            return true;
+        }
+        /// @brief 没有委托时返回 std::nullopt
+        inline std::optional<type_VALUE> result(){
+            return std::move(this->value);
+        }
+    };
+
+    /**
+     * @brief 用二元函数 func(accumulator, value) 折叠所有返回值
+     * @tparam type_ACCUMULATOR 累加值类型
+     * @tparam type_FUNC
+     */
+    template<typename type_ACCUMULATOR,typename type_FUNC>
+    class ReduceCombiner{
+    private:
+        type_ACCUMULATOR accumulator;
+        type_FUNC func;
+    public:
+        ReduceCombiner(type_ACCUMULATOR init,type_FUNC func):accumulator(std::move(init)),func(std::move(func)){};
+        template<typename type_ARG>
+        inline bool accept(type_ARG&& arg){
+            this->accumulator = this->func(std::move(this->accumulator),std::forward<type_ARG>(arg));
+            return true;
+        }
+        inline type_ACCUMULATOR result(){
+            return std::move(this->accumulator);
+        }
+    };
+
+    /**
+     * @brief 将返回值依次写入输出迭代器
+     * @tparam type_OUTPUT_ITERATOR
+     */
+    template<typename type_OUTPUT_ITERATOR>
+    class OutputCombiner{
+    private:
+        type_OUTPUT_ITERATOR iter;
+    public:
+        OutputCombiner(type_OUTPUT_ITERATOR iter):iter(iter){};
+        template<typename type_ARG>
+        inline bool accept(type_ARG&& arg){
+            *(this->iter) = std::forward<type_ARG>(arg);
+            ++(this->iter);
+            return true;
+        }
+        /// @brief 返回写入最后一个元素之后的迭代器
+        inline type_OUTPUT_ITERATOR result(){
+            return this->iter;
+        }
+    };
+
+    /**
+     * @brief 依次调用委托，直到某个返回值满足谓词，剩余的委托不再调用
+     * @tparam type_VALUE
+     * @tparam type_PREDICATE 签名为 bool(const type_VALUE&)
+     */
+    template<typename type_VALUE,typename type_PREDICATE>
+    class UntilCombiner{
+    private:
+        std::optional<type_VALUE> value;
+        type_PREDICATE pred;
+    public:
+        UntilCombiner(type_PREDICATE pred):pred(std::move(pred)){};
+        template<typename type_ARG>
+        inline bool accept(type_ARG&& arg){
+            if(this->pred(arg)){
+                this->value.emplace(std::forward<type_ARG>(arg));
+                return false;
+            }
+            return true;
+        }
+        /// @brief 返回第一个满足谓词的返回值，没有则返回 std::nullopt
+        inline std::optional<type_VALUE> result(){
+            return std::move(this->value);
+        }
+    };
+
+    /// @brief 创建 ReduceCombiner，自动推导累加值和函数类型
+    template<typename type_ACCUMULATOR,typename type_FUNC>
+    inline ReduceCombiner<type_ACCUMULATOR,type_FUNC> makeReduceCombiner(type_ACCUMULATOR init,type_FUNC func){
+        return ReduceCombiner<type_ACCUMULATOR,type_FUNC>(std::move(init),std::move(func));
+    }
+
+    /// @brief 创建 OutputCombiner，自动推导迭代器类型
+    template<typename type_OUTPUT_ITERATOR>
+    inline OutputCombiner<type_OUTPUT_ITERATOR> makeOutputCombiner(type_OUTPUT_ITERATOR iter){
+        return OutputCombiner<type_OUTPUT_ITERATOR>(iter);
+    }
+
+    /// @brief 创建 UntilCombiner，只需要指定返回值类型
+    template<typename type_VALUE,typename type_PREDICATE>
+    inline UntilCombiner<type_VALUE,type_PREDICATE> makeUntilCombiner(type_PREDICATE pred){
+        return UntilCombiner<type_VALUE,type_PREDICATE>(std::move(pred));
+    }
+}
+#endif
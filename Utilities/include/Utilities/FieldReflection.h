@@ -0,0 +1,167 @@
+/**
+ * @file FieldReflection.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 编译期的成员变量元数据
+ * @details
+ *      Reflection 只能根据类名创建对象，无法得知对象有哪些成员。REFLECT_FIELDS 宏在编译期为类记录每个成员变量的
+ *      名称、类型和偏移量，生成的元数据是一个由 FieldInfo 组成的 std::tuple，遍历时完全展开，没有虚函数调用。
+ *      用法（宏需要写在类所在的命名空间中，最多支持 16 个成员）：
+ *      @code
+ *      namespace rpc{
+ *          struct Point{
+ *              int x;
+ *              double y;
+ *              std::string label;
+ *          };
+ *          REFLECT_FIELDS(Point,x,y,label)
+ *      }
+ *      AntonaStandard::Utilities::forEachField(point,[](std::string_view name,auto& value){ ... });
+ *      @endcode
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_FIELDREFLECTION_H
+#define UTILITIES_FIELDREFLECTION_H
+
+#include <cstddef>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// 计算可变参数的个数，最多 16 个
+#define ANTONA_FIELDS_ARG_N(_1,_2,_3,_4,_5,_6,_7,_8,_9,_10,_11,_12,_13,_14,_15,_16,N,...) N
+#define ANTONA_FIELDS_COUNT(...) ANTONA_FIELDS_ARG_N(__VA_ARGS__,16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0)
+#define ANTONA_FIELDS_CONCAT_IMPL(a,b) a##b
+#define ANTONA_FIELDS_CONCAT(a,b) ANTONA_FIELDS_CONCAT_IMPL(a,b)
+
+// 对每个参数调用 macro，结果以逗号分隔
+#define ANTONA_FIELDS_EACH_1(macro,a) macro(a)
+#define ANTONA_FIELDS_EACH_2(macro,a,...) macro(a),ANTONA_FIELDS_EACH_1(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_3(macro,a,...) macro(a),ANTONA_FIELDS_EACH_2(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_4(macro,a,...) macro(a),ANTONA_FIELDS_EACH_3(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_5(macro,a,...) macro(a),ANTONA_FIELDS_EACH_4(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_6(macro,a,...) macro(a),ANTONA_FIELDS_EACH_5(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_7(macro,a,...) macro(a),ANTONA_FIELDS_EACH_6(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_8(macro,a,...) macro(a),ANTONA_FIELDS_EACH_7(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_9(macro,a,...) macro(a),ANTONA_FIELDS_EACH_8(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_10(macro,a,...) macro(a),ANTONA_FIELDS_EACH_9(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_11(macro,a,...) macro(a),ANTONA_FIELDS_EACH_10(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_12(macro,a,...) macro(a),ANTONA_FIELDS_EACH_11(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_13(macro,a,...) macro(a),ANTONA_FIELDS_EACH_12(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_14(macro,a,...) macro(a),ANTONA_FIELDS_EACH_13(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_15(macro,a,...) macro(a),ANTONA_FIELDS_EACH_14(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH_16(macro,a,...) macro(a),ANTONA_FIELDS_EACH_15(macro,__VA_ARGS__)
+#define ANTONA_FIELDS_EACH(macro,...) \
+ANTONA_FIELDS_CONCAT(ANTONA_FIELDS_EACH_,ANTONA_FIELDS_COUNT(__VA_ARGS__))(macro,__VA_ARGS__)
+
+/// @brief 生成单个成员变量的元数据，type_Reflected 由 REFLECT_FIELDS 定义
+#define ANTONA_REFLECT_FIELD(field)                                                             \
+AntonaStandard::Utilities::makeFieldInfo(#field,&type_Reflected::field,offsetof(type_Reflected,field))
+
+/**
+ * @brief 注册类的成员变量
+ * @details 生成一个可以通过 ADL 找到的 constexpr 函数 antonaReflectFields，返回成员变量的元数据
+ */
+#define REFLECT_FIELDS(className,...)                                                           \
+constexpr auto antonaReflectFields(const className*){                                           \
+    using type_Reflected = className;                                                           \
+    static_assert(std::is_standard_layout<type_Reflected>::value,                               \
+        "REFLECT_FIELDS requires a standard-layout type");                                      \
+    return std::make_tuple(ANTONA_FIELDS_EACH(ANTONA_REFLECT_FIELD,__VA_ARGS__));               \
+}
+
+namespace AntonaStandard{
+    namespace Utilities{
+        template<typename type_CLASS,typename type_FIELD>
+        struct FieldInfo;
+
+        template<typename type_CLASS,typename = void>
+        struct HasFieldMetadata;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /**
+     * @brief 成员变量的元数据
+     * @tparam type_CLASS 所属的类
+     * @tparam type_FIELD 成员变量的类型
+     */
+    template<typename type_CLASS,typename type_FIELD>
+    struct FieldInfo{
+        using Class = type_CLASS;
+        using Type = type_FIELD;
+        /// @brief 成员变量的名称
+        std::string_view name;
+        /// @brief 成员指针，访问时直接寻址
+        type_FIELD type_CLASS::* member;
+        /// @brief 成员变量相对于对象起始地址的偏移量
+        std::size_t offset;
+
+        inline constexpr type_FIELD& get(type_CLASS& obj)const{
+            return obj.*(this->member);
+        }
+        inline constexpr const type_FIELD& get(const type_CLASS& obj)const{
+            return obj.*(this->member);
+        }
+    };
+
+    template<typename type_CLASS,typename type_FIELD>
+    constexpr FieldInfo<type_CLASS,type_FIELD> makeFieldInfo(std::string_view name,type_FIELD type_CLASS::* member,std::size_t offset){
+        return FieldInfo<type_CLASS,type_FIELD>{name,member,offset};
+    }
+
+    /// @brief 判断类型是否通过 REFLECT_FIELDS 注册了成员变量
+    template<typename type_CLASS,typename>
+    struct HasFieldMetadata:std::false_type{};
+
+    template<typename type_CLASS>
+    struct HasFieldMetadata<type_CLASS,std::void_t<decltype(antonaReflectFields(static_cast<const type_CLASS*>(nullptr)))>>:std::true_type{};
+
+    template<typename type_CLASS>
+    constexpr bool hasFieldMetadata_v = HasFieldMetadata<type_CLASS>::value;
+
+    /**
+     * @brief 获取类的成员变量元数据
+     * @return 由 FieldInfo 组成的 std::tuple
+     */
+    template<typename type_CLASS>
+    constexpr auto fieldsOf(){
+        static_assert(hasFieldMetadata_v<type_CLASS>,"The type was not registered by REFLECT_FIELDS");
+        return antonaReflectFields(static_cast<const type_CLASS*>(nullptr));
+    }
+
+    /// @brief 获取类注册的成员变量个数
+    template<typename type_CLASS>
+    constexpr std::size_t fieldCount(){
+        return std::tuple_size<decltype(fieldsOf<type_CLASS>())>::value;
+    }
+
+    /**
+     * @brief 按照注册顺序遍历对象的成员变量
+     * @param obj
+     * @param func 签名为 void(std::string_view name,auto& value)
+     */
+    template<typename type_CLASS,typename type_FUNC>
+    constexpr void forEachField(type_CLASS& obj,type_FUNC&& func){
+        using type_Plain = std::remove_const_t<type_CLASS>;
+        std::apply([&obj,&func](const auto&... fields){
+            (func(fields.name,fields.get(obj)),...);
+        },fieldsOf<type_Plain>());
+    }
+
+    /**
+     * @brief 按照注册顺序遍历类的成员变量元数据
+     * @param func 签名为 void(const FieldInfo<...>&)
+     */
+    template<typename type_CLASS,typename type_FUNC>
+    constexpr void forEachFieldInfo(type_FUNC&& func){
+        std::apply([&func](const auto&... fields){
+            (func(fields),...);
+        },fieldsOf<type_CLASS>());
+    }
+}
+#endif
@@ -0,0 +1,234 @@
+/**
+ * @file ObjectPool.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 实现按类型划分的对象池
+ * @details
+ *      频繁创建和销毁大量短生命周期的小对象时，每次都向堆申请内存的开销较大。对象池按块（chunk）批量申请内存，
+ *      释放的对象不归还给堆，而是挂到空闲链表上供下一次创建复用：
+ *      - ObjectPool<T> 每种类型一个全局对象池，线程安全
+ *      - PooledPtr<T> 独占所有权的句柄（std::unique_ptr），析构时把对象归还给对象池，没有引用计数的开销
+ *      - PoolAllocator<T> 满足标准库分配器要求，配合 std::allocate_shared 使用时对象和控制块一起从对象池分配
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_OBJECTPOOL_H
+#define UTILITIES_OBJECTPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Utilities{
+        template<typename type_Ele>
+        class ObjectPool;
+
+        template<typename type_Ele>
+        class PoolDeleter;
+
+        template<typename type_Ele>
+        class PoolAllocator;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /**
+     * @brief 对象池
+     * @details
+     *      每个槽位的大小和对齐与 type_Ele 相同，空闲的槽位复用自身的存储构成单向链表。
+     *      空闲链表为空时申请一个新的块，块的大小从 initial_chunk_size 开始倍增，直到 max_chunk_size。
+     *      块只会在对象池析构时释放
+     * @tparam type_Ele
+     */
+    template<typename type_Ele>
+    class ObjectPool{
+        TESTING_MESSAGE
+    private:
+        union Slot{
+            Slot* next;
+            alignas(type_Ele) unsigned char storage[sizeof(type_Ele)];
+        };
+        static constexpr std::size_t initial_chunk_size = 64;
+        static constexpr std::size_t max_chunk_size = 4096;
+
+        std::mutex mtx;
+        /// @brief 空闲链表
+        Slot* free_list;
+        /// @brief 申请的所有块
+        std::vector<Slot*> chunks;
+        std::size_t next_chunk_size;
+        std::size_t slot_num;
+        std::size_t free_num;
+
+        /// @brief 申请一个新的块并把所有槽位挂到空闲链表上，调用前需要持有锁
+        void grow(){
+            std::size_t chunk_size = this->next_chunk_size;
+            Slot* chunk = static_cast<Slot*>(::operator new(sizeof(Slot) * chunk_size,std::align_val_t(alignof(Slot))));
+            this->chunks.push_back(chunk);
+            for(std::size_t i = 0; i < chunk_size; ++i){
+                chunk[i].next = this->free_list;
+                this->free_list = &chunk[i];
+            }
+            this->slot_num += chunk_size;
+            this->free_num += chunk_size;
+            if(this->next_chunk_size < max_chunk_size){
+                this->next_chunk_size *= 2;
+            }
+        }
+    public:
+        ObjectPool():free_list(nullptr),next_chunk_size(initial_chunk_size),slot_num(0),free_num(0){};
+        ObjectPool(const ObjectPool&) = delete;
+        ObjectPool& operator=(const ObjectPool&) = delete;
+        ObjectPool(ObjectPool&&) = delete;
+        ObjectPool& operator=(ObjectPool&&) = delete;
+        /// @warning 析构时所有对象必须已经归还
+        ~ObjectPool(){
+            for(auto chunk:this->chunks){
+                ::operator delete(chunk,std::align_val_t(alignof(Slot)));
+            }
+        }
+        /**
+         * @brief 获取 type_Ele 的全局对象池
+         * @details 全局对象池永不析构，保证程序退出阶段析构的静态对象仍然可以归还内存
+         * @return ObjectPool&
+         */
+        static ObjectPool& instance(){
+            static ObjectPool* pool = new ObjectPool();
+            return *pool;
+        }
+        /**
+         * @brief 分配一个未初始化的槽位
+         * @return void*
+         * @throw std::bad_alloc
+         */
+        void* allocate(){
+            std::lock_guard<std::mutex> lck(this->mtx);
+            if(this->free_list == nullptr){
+                this->grow();
+            }
+            Slot* slot = this->free_list;
+            this->free_list = slot->next;
+            --this->free_num;
+            return slot->storage;
+        }
+        /**
+         * @brief 归还槽位，槽位上的对象需要已经析构
+         * @param ptr 由 allocate() 返回的指针
+         */
+        void deallocate(void* ptr)noexcept{
+            if(ptr == nullptr){
+                return;
+            }
+            Slot* slot = reinterpret_cast<Slot*>(ptr);
+            std::lock_guard<std::mutex> lck(this->mtx);
+            slot->next = this->free_list;
+            this->free_list = slot;
+            ++this->free_num;
+        }
+        /**
+         * @brief 在对象池中构造对象
+         * @return type_Ele* 需要通过 destroy() 释放
+         */
+        template<typename... type_Args>
+        type_Ele* create(type_Args&&... args){
+            void* ptr = this->allocate();
+            try{
+                return ::new(ptr) type_Ele(std::forward<type_Args>(args)...);
+            }
+            catch(...){
+                this->deallocate(ptr);
+                throw;
+            }
+        }
+        /// @brief 析构对象并归还槽位
+        void destroy(type_Ele* ptr)noexcept{
+            if(ptr == nullptr){
+                return;
+            }
+            ptr->~type_Ele();
+            this->deallocate(ptr);
+        }
+        /// @brief 获取已经申请的槽位总数
+        inline std::size_t capacity(){
+            std::lock_guard<std::mutex> lck(this->mtx);
+            return this->slot_num;
+        }
+        /// @brief 获取空闲的槽位数
+        inline std::size_t available(){
+            std::lock_guard<std::mutex> lck(this->mtx);
+            return this->free_num;
+        }
+    };
+
+    /**
+     * @brief 把对象归还给全局对象池的删除器
+     * @tparam type_Ele
+     */
+    template<typename type_Ele>
+    class PoolDeleter{
+    public:
+        inline void operator()(type_Ele* ptr)const noexcept{
+            ObjectPool<type_Ele>::instance().destroy(ptr);
+        }
+    };
+
+    /// @brief 从对象池中创建的独占句柄，没有引用计数
+    template<typename type_Ele>
+    using PooledPtr = std::unique_ptr<type_Ele,PoolDeleter<type_Ele>>;
+
+    /**
+     * @brief 在全局对象池中创建对象
+     * @return PooledPtr<type_Ele>
+     */
+    template<typename type_Ele,typename... type_Args>
+    PooledPtr<type_Ele> makePooled(type_Args&&... args){
+        return PooledPtr<type_Ele>(ObjectPool<type_Ele>::instance().create(std::forward<type_Args>(args)...));
+    }
+
+    /**
+     * @brief 从全局对象池分配内存的分配器
+     * @details
+     *      单个元素从 ObjectPool<type_Ele> 分配，多个元素退化为 ::operator new。
+     *      std::allocate_shared 会把分配器重新绑定到控制块类型，因此对象和控制块一起从控制块类型的对象池中分配
+     * @tparam type_Ele
+     */
+    template<typename type_Ele>
+    class PoolAllocator{
+    public:
+        using value_type = type_Ele;
+
+        PoolAllocator() = default;
+        template<typename type_Other>
+        PoolAllocator(const PoolAllocator<type_Other>&)noexcept{};
+
+        type_Ele* allocate(std::size_t n){
+            if(n == 1){
+                return static_cast<type_Ele*>(ObjectPool<type_Ele>::instance().allocate());
+            }
+            return static_cast<type_Ele*>(::operator new(sizeof(type_Ele) * n,std::align_val_t(alignof(type_Ele))));
+        }
+        void deallocate(type_Ele* ptr,std::size_t n)noexcept{
+            if(n == 1){
+                ObjectPool<type_Ele>::instance().deallocate(ptr);
+                return;
+            }
+            ::operator delete(ptr,std::align_val_t(alignof(type_Ele)));
+        }
+        template<typename type_Other>
+        inline bool operator==(const PoolAllocator<type_Other>&)const noexcept{
+            return true;
+        }
+        template<typename type_Other>
+        inline bool operator!=(const PoolAllocator<type_Other>&)const noexcept{
+            return false;
+        }
+    };
+}
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @file RcuPointer.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 实现简单的读-拷贝-更新（RCU）指针
+ * @details
+ *      读者通过 read() 获取当前数据的只读快照，整个过程只包含几次原子操作，不会加锁也不会被写者阻塞。
+ *      写者通过 update() 拷贝一份数据进行修改，修改完成后原子地发布新数据，然后等待所有可能还持有旧数据的
+ *      读者退出（宽限期）后再释放旧数据。写者之间通过互斥锁串行化
+ * @warning
+ *      持有 ReadGuard 的线程不能对同一个 RcuPointer 调用 update()/reset()，否则写者会一直等待自己持有的读者计数，造成死锁
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_RCUPOINTER_H
+#define UTILITIES_RCUPOINTER_H
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <TestingSupport/TestingMessageMacro.h>
+
+namespace AntonaStandard{
+    namespace Utilities{
+        template<typename type_Value>
+        class RcuPointer;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /**
+     * @brief 读-拷贝-更新指针
+     * @details
+     *      读者计数分为两组，由 epoch 的奇偶性决定读者登记到哪一组。写者发布新数据后翻转 epoch，
+     *      此后新来的读者只会登记到另一组，写者只需要等待旧的一组计数归零就可以安全地释放旧数据。
+     *      读者登记后会再次检查 epoch 的奇偶性，如果在登记期间发生了翻转就撤销登记并重试，
+     *      从而保证写者等待的那一组一定包含所有可能持有旧数据的读者
+     * @tparam type_Value 被保护的数据类型，需要支持拷贝构造
+     */
+    template<typename type_Value>
+    class RcuPointer{
+        TESTING_MESSAGE
+    private:
+        /// @brief 当前发布的数据，只读
+        std::atomic<type_Value*> current;
+        /// @brief 读者登记的组号，只有写者会修改
+        std::atomic<unsigned long> epoch;
+        /// @brief 两组读者计数
+        mutable std::atomic<long> readers[2];
+        /// @brief 串行化写者
+        std::mutex writer_mtx;
+
+        /**
+         * @brief 翻转 epoch 并等待旧一组读者全部退出
+         * @details 调用前必须已经发布了新数据并持有 writer_mtx
+         */
+        void synchronize(){
+            unsigned long old_epoch = this->epoch.load();
+            this->epoch.store(old_epoch + 1);
+            while(this->readers[old_epoch & 1].load() != 0){
+                std::this_thread::yield();
+            }
+        }
+        /// @brief 发布新数据，等待宽限期结束后释放旧数据
+        void publish(type_Value* new_value){
+            type_Value* old_value = this->current.exchange(new_value);
+            this->synchronize();
+            delete old_value;
+        }
+    public:
+        /**
+         * @brief 读者持有的快照，析构时撤销读者登记
+         * @details 快照在 ReadGuard 的生命周期内始终有效，不会被写者释放
+         */
+        class ReadGuard{
+        private:
+            const RcuPointer* owner;
+            unsigned long index;
+            const type_Value* value;
+        public:
+            ReadGuard(const RcuPointer* owner):owner(owner){
+                while(true){
+                    this->index = owner->epoch.load() & 1;
+                    owner->readers[this->index].fetch_add(1);
+                    // 登记期间 epoch 没有翻转才算登记成功
+                    if((owner->epoch.load() & 1) == this->index){
+                        break;
+                    }
+                    owner->readers[this->index].fetch_sub(1);
+                }
+                this->value = owner->current.load();
+            }
+            ReadGuard(const ReadGuard&) = delete;
+            ReadGuard& operator=(const ReadGuard&) = delete;
+            ReadGuard(ReadGuard&& other):owner(other.owner),index(other.index),value(other.value){
+                other.owner = nullptr;
+            }
+            ReadGuard& operator=(ReadGuard&&) = delete;
+            ~ReadGuard(){
+                if(this->owner != nullptr){
+                    this->owner->readers[this->index].fetch_sub(1);
+                }
+            }
+            inline const type_Value* get()const{
+                return this->value;
+            }
+            inline const type_Value& operator*()const{
+                return *(this->value);
+            }
+            inline const type_Value* operator->()const{
+                return this->value;
+            }
+        };
+
+        RcuPointer():RcuPointer(type_Value()){};
+        explicit RcuPointer(type_Value init_value):current(new type_Value(std::move(init_value))),epoch(0){
+            this->readers[0].store(0);
+            this->readers[1].store(0);
+        }
+        // 禁用拷贝和移动
+        RcuPointer(const RcuPointer&) = delete;
+        RcuPointer& operator=(const RcuPointer&) = delete;
+        RcuPointer(RcuPointer&&) = delete;
+        RcuPointer& operator=(RcuPointer&&) = delete;
+        ~RcuPointer(){
+            delete this->current.load();
+        }
+
+        /**
+         * @brief 获取当前数据的只读快照，无锁
+         * @return ReadGuard
+         */
+        inline ReadGuard read()const{
+            return ReadGuard(this);
+        }
+        /**
+         * @brief 拷贝当前数据，交由 modifier 修改后发布
+         * @details
+         *      modifier 的签名为 bool(type_Value&)，返回 false 表示没有修改，此时丢弃拷贝，不发布也不等待宽限期
+         * @tparam type_Modifier
+         * @param modifier
+         * @return true 发布了新数据
+         * @return false 没有发布新数据
+         */
+        template<typename type_Modifier>
+        bool update(type_Modifier&& modifier){
+            std::lock_guard<std::mutex> lck(this->writer_mtx);
+            type_Value* new_value = new type_Value(*(this->current.load()));
+            bool changed = false;
+            try{
+                changed = modifier(*new_value);
+            }
+            catch(...){
+                delete new_value;
+                throw;
+            }
+            if(!changed){
+                delete new_value;
+                return false;
+            }
+            this->publish(new_value);
+            return true;
+        }
+        /**
+         * @brief 直接用新值替换当前数据
+         * @param new_value
+         */
+        void reset(type_Value new_value){
+            std::lock_guard<std::mutex> lck(this->writer_mtx);
+            this->publish(new type_Value(std::move(new_value)));
+        }
+    };
+}
+#endif
@@ -14,6 +14,9 @@
 #include <memory>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <typeinfo>
+#include <Utilities/ObjectPool.h>
 #include <Globals/Exception.h>
 #include <TestingSupport/TestingMessageMacro.h>
 
@@ -30,6 +33,7 @@ f =  [](){                                      \
 };                                              \
 str_name = #className;                          \
 this->func_map.insert({str_name,f});  \
+this->typed_map.insert({str_name,AntonaStandard::Utilities::Reflection::makeTypedCreator<className>()});  \
 
 
 /// @brief lambda表达式宏，可以为回调函数修改别名
@@ -39,6 +43,27 @@ f =  [](){                                      \
 };                                              \
 str_name = #regist_name;                        \
 this->func_map.insert(pair<std::string,std::function<std::shared_ptr<void>(void)>>(str_name,f));  \
+this->typed_map.insert({str_name,AntonaStandard::Utilities::Reflection::makeTypedCreator<className>()});  \
+
+
+/// @brief 与 REGISTER 相同，但 createInstance 返回的实例连同 shared_ptr 的控制块一起从对象池中分配，释放后回收复用
+#define REGISTER_POOLED(className)              \
+f =  [](){                                      \
+        return std::allocate_shared<className>(AntonaStandard::Utilities::PoolAllocator<className>());   \
+};                                              \
+str_name = #className;                          \
+this->func_map.insert({str_name,f});  \
+this->typed_map.insert({str_name,AntonaStandard::Utilities::Reflection::makeTypedCreator<className>()});  \
+
+
+/// @brief 与 REGISTER_BY_OTHERNAME 相同，但实例从对象池中分配
+#define REGISTER_POOLED_BY_OTHERNAME(className,regist_name)       \
+f =  [](){                                      \
+        return std::allocate_shared<className>(AntonaStandard::Utilities::PoolAllocator<className>());   \
+};                                              \
+str_name = #regist_name;                        \
+this->func_map.insert({str_name,f});  \
+this->typed_map.insert({str_name,AntonaStandard::Utilities::Reflection::makeTypedCreator<className>()});  \
 
 
 namespace AntonaStandard{
@@ -57,8 +82,36 @@ namespace AntonaStandard::Utilities{
      */
     class Reflection{
         TESTING_MESSAGE
+    public:
+        /**
+         * @brief 类型化的构造回调
+         * @details 记录类型信息，用于 createInstance<T>() 检查类型，实例总是从对象池中分配
+         */
+        struct TypedCreator{
+            const std::type_info* type;
+            void* (*create)();
+        };
+        /// @brief 生成类型 className 的类型化构造回调，由注册宏调用
+        template<typename type_CLASS>
+        static TypedCreator makeTypedCreator(){
+            return TypedCreator{&typeid(type_CLASS),[]()->void*{
+                return AntonaStandard::Utilities::ObjectPool<type_CLASS>::instance().create();
+            }};
+        }
+        /// @brief 支持以 std::string_view 查找的哈希，按名称查找时不需要构造 std::string
+        struct NameHash{
+            using is_transparent = void;
+            inline std::size_t operator()(std::string_view name)const noexcept{
+                return std::hash<std::string_view>()(name);
+            }
+        };
+        template<typename type_VALUE>
+        using NameMap = std::unordered_map<std::string,type_VALUE,NameHash,std::equal_to<>>;
     protected:
-        std::unordered_map<std::string,std::function<std::shared_ptr<void>(void)>> func_map;
+        NameMap<std::function<std::shared_ptr<void>(void)>> func_map;
+        NameMap<TypedCreator> typed_map;
+        /// @brief 两个 createInstance 重载共用的查找，不分配内存
+        std::shared_ptr<void> createByName(std::string_view name_str);
     public:
         Reflection(){};
         /**
@@ -84,6 +137,30 @@ namespace AntonaStandard::Utilities{
          *      createInstance(const char*)
          */
         virtual std::shared_ptr<void> createInstance(const std::string& name_str);
+        /**
+         * @brief 根据字符串创建相关类的实例，返回类型化的独占句柄
+         * @details
+         *      实例从 type_CLASS 的对象池中分配，句柄析构时归还对象池。句柄没有引用计数，也不需要类型转换
+         * @tparam type_CLASS 必须与注册的类型完全相同
+         * @param name_str 
+         * @return PooledPtr<type_CLASS> 
+         * @throw AntonaStandard::Globals::NotFound_Error 类型没有注册
+         * @throw AntonaStandard::Globals::WrongArgument_Error type_CLASS 与注册的类型不同
+         */
+        template<typename type_CLASS>
+        PooledPtr<type_CLASS> createInstance(const std::string& name_str){
+            auto iter = this->typed_map.find(name_str);
+            if(iter == this->typed_map.end()){
+                std::string msg = "The type you create was not registered!: " + name_str;
+                throw AntonaStandard::Globals::NotFound_Error(msg.c_str());
+            }
+            if(*(iter->second.type) != typeid(type_CLASS)){
+                std::string msg = "The type you create does not match the registered type!: " + name_str;
+                throw AntonaStandard::Globals::WrongArgument_Error(msg.c_str());
+            }
+            return PooledPtr<type_CLASS>(static_cast<type_CLASS*>(iter->second.create()));
+        }
     };
+    // 编译期注册、无需分配内存即可查找的版本见 StaticReflection.h
 } // namespace AntonaStandard
 #endif 
@@ -0,0 +1,206 @@
+/**
+ * @file ReflectionRegistry.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 线程安全的类名反射注册表，支持从插件中注册
+ * @details
+ *      Reflection 的注册表只在 load() 中填充，没有同步措施，不能在其它线程创建实例的同时注册新的类。
+ *      ReflectionRegistry 用 RcuPointer 保存注册表：
+ *      - 创建实例时只读取注册表的快照，不加锁
+ *      - 注册时拷贝一份注册表进行修改后原子地发布，同一批注册要么全部生效，要么全部不生效
+ *      - 通过 loadPlugin() 加载的动态库可以在导出的入口函数中注册自己的类，入口函数用 REFLECTION_PLUGIN_ENTRY 定义
+ *
+ *      插件的写法：
+ *      @code
+ *      REFLECTION_PLUGIN_ENTRY(batch){
+ *          batch->registerClass<Message>("Message");
+ *          batch->registerPooledClass<Order>("Order");
+ *      }
+ *      @endcode
+ * @warning
+ *      卸载插件前，必须先释放所有由插件注册的类创建的实例
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_REFLECTIONREGISTRY_H
+#define UTILITIES_REFLECTIONREGISTRY_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <CPS/Dll.h>
+#include <Utilities/RcuPointer.h>
+#include <Utilities/ObjectPool.h>
+#include <Utilities/Reflection.h>
+#include <Globals/Exception.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+/// @brief 插件入口函数的导出名
+#define REFLECTION_PLUGIN_ENTRY_NAME "AntonaStandard_RegisterReflection"
+
+/**
+ * @brief 定义插件的入口函数
+ * @details 入口函数在 ReflectionRegistry::loadPlugin() 中被调用，参数为 ReflectionRegistry::Batch*
+ */
+#define REFLECTION_PLUGIN_ENTRY(batch)                                                          \
+extern "C" ASD_EXPORT void AntonaStandard_RegisterReflection(AntonaStandard::Utilities::ReflectionRegistry::Batch* batch)
+
+namespace AntonaStandard{
+    namespace Utilities{
+        class ReflectionRegistry;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /**
+     * @brief 线程安全的反射注册表
+     */
+    class ReflectionRegistry{
+        TESTING_MESSAGE
+    public:
+        /// @brief 注册表中的一项
+        struct Entry{
+            std::function<std::shared_ptr<void>(void)> factory;
+            Reflection::TypedCreator typed;
+        };
+        /// @brief 支持以 std::string_view 查找，创建实例时不需要构造 std::string
+        using Table = Reflection::NameMap<Entry>;
+
+        /**
+         * @brief 一批注册操作
+         * @details 由 ReflectionRegistry::batch() 创建，修改的是注册表的拷贝，批次结束时一次性发布
+         */
+        class Batch{
+            friend class ReflectionRegistry;
+        private:
+            Table& table;
+            /// @brief 本批次注册的类名，用于卸载插件时移除
+            std::vector<std::string> names;
+            Batch(Table& table):table(table){};
+        public:
+            Batch(const Batch&) = delete;
+            Batch& operator=(const Batch&) = delete;
+            /**
+             * @brief 注册一项
+             * @throw AntonaStandard::Globals::Conflict_Error 类名已经注册
+             */
+            void registerEntry(const std::string& name,Entry entry);
+            /// @brief 注册类，实例通过 std::make_shared 创建
+            template<typename type_CLASS>
+            void registerClass(const std::string& name){
+                this->registerEntry(name,Entry{[](){
+                    return std::static_pointer_cast<void>(std::make_shared<type_CLASS>());
+                },Reflection::makeTypedCreator<type_CLASS>()});
+            }
+            /// @brief 注册类，实例连同 shared_ptr 的控制块一起从对象池中分配
+            template<typename type_CLASS>
+            void registerPooledClass(const std::string& name){
+                this->registerEntry(name,Entry{[](){
+                    return std::static_pointer_cast<void>(std::allocate_shared<type_CLASS>(PoolAllocator<type_CLASS>()));
+                },Reflection::makeTypedCreator<type_CLASS>()});
+            }
+            /// @brief 移除一项，返回是否存在
+            bool unregisterEntry(const std::string& name);
+        };
+    private:
+        struct Plugin{
+            CPS::HandlePtr_t handle;
+            std::vector<std::string> names;
+        };
+        RcuPointer<Table> table;
+        /// @brief 保护 plugins，同时串行化插件的加载和卸载
+        std::mutex plugin_mtx;
+        std::vector<Plugin> plugins;
+
+        /// @brief 查找类名对应的项，调用方需要持有快照
+        const Entry& find(const Table& table,std::string_view name)const;
+    public:
+        ReflectionRegistry() = default;
+        ReflectionRegistry(const ReflectionRegistry&) = delete;
+        ReflectionRegistry& operator=(const ReflectionRegistry&) = delete;
+        /// @brief 析构时卸载所有插件
+        virtual ~ReflectionRegistry();
+
+        /**
+         * @brief 执行一批注册操作
+         * @details modifier 的签名为 void(Batch&)，抛出异常时本批次的所有修改都不会生效
+         * @return std::vector<std::string> 本批次注册的类名
+         */
+        template<typename type_Modifier>
+        std::vector<std::string> batch(type_Modifier&& modifier){
+            std::vector<std::string> names;
+            this->table.update([&modifier,&names](Table& table){
+                Batch batch(table);
+                modifier(batch);
+                names = std::move(batch.names);
+                return true;
+            });
+            return names;
+        }
+        /// @brief 注册单个类
+        template<typename type_CLASS>
+        void registerClass(const std::string& name){
+            this->batch([&name](Batch& batch){
+                batch.registerClass<type_CLASS>(name);
+            });
+        }
+        /// @brief 注册单个类，实例从对象池中分配
+        template<typename type_CLASS>
+        void registerPooledClass(const std::string& name){
+            this->batch([&name](Batch& batch){
+                batch.registerPooledClass<type_CLASS>(name);
+            });
+        }
+        /// @brief 移除一个类，返回是否存在
+        bool unregisterClass(const std::string& name);
+
+        /// @brief 判断类名是否已经注册，无锁
+        bool contains(std::string_view name)const;
+        /// @brief 获取注册的类的数量，无锁
+        unsigned long size()const;
+        /**
+         * @brief 根据类名创建实例，无锁
+         * @throw AntonaStandard::Globals::NotFound_Error 类名没有注册
+         */
+        std::shared_ptr<void> createInstance(std::string_view name)const;
+        /**
+         * @brief 根据类名创建类型化的独占句柄，无锁
+         * @throw AntonaStandard::Globals::NotFound_Error 类名没有注册
+         * @throw AntonaStandard::Globals::WrongArgument_Error type_CLASS 与注册的类型不同
+         */
+        template<typename type_CLASS>
+        PooledPtr<type_CLASS> createInstance(std::string_view name)const{
+            auto guard = this->table.read();
+            const Entry& entry = this->find(*guard,name);
+            if(*(entry.typed.type) != typeid(type_CLASS)){
+                std::string msg = "The type you create does not match the registered type!: " + std::string(name);
+                throw AntonaStandard::Globals::WrongArgument_Error(msg.c_str());
+            }
+            return PooledPtr<type_CLASS>(static_cast<type_CLASS*>(entry.typed.create()));
+        }
+
+        /**
+         * @brief 加载插件并调用其入口函数注册类
+         * @details 入口函数注册失败时插件会被卸载，注册表保持不变
+         * @param path 动态库的路径
+         * @throw AntonaStandard::Globals::FailToLoadDll_Error 动态库加载失败
+         * @throw AntonaStandard::Globals::FailToGetFunction_Error 动态库没有定义入口函数
+         * @throw AntonaStandard::Globals::Conflict_Error 插件注册的类名与已有的冲突
+         */
+        void loadPlugin(const std::string& path);
+        /**
+         * @brief 移除所有插件注册的类并卸载插件
+         * @warning 调用前必须释放所有由插件注册的类创建的实例
+         */
+        void unloadPlugins();
+    };
+}
+#endif
@@ -0,0 +1,292 @@
+/**
+ * @file StaticReflection.h
+ * @author Anton (yunye_helloworld@qq.com)
+ * @brief 编译期注册的类名反射
+ * @details
+ *      Reflection 在运行时把类名存储到 std::unordered_map<std::string,...> 中，每次创建实例都要计算哈希并查找哈希表，类型 id 也只能在运行时得到。
+ *      StaticReflection 在编译期完成注册，并用 hash-and-displace 算法构造一张完美哈希表：
+ *      - 所有类名先按照第一次哈希分到若干个桶中，每个桶在编译期搜索一个种子，使桶内的类名用该种子做第二次哈希后落到互不冲突的槽位
+ *      - 查找时计算两次哈希，比较一次字符串即可确定结果，不会分配内存
+ *      - 每个类按照注册顺序拥有一个类型 id，可以在编译期通过 typeId() 求出，之后按 id 创建实例只需要一次数组访问
+ *
+ *      用法：
+ *      @code
+ *      constexpr auto reflection = makeStaticReflection(STATIC_REGISTER(A),STATIC_REGISTER(B));
+ *      constexpr std::size_t id_a = reflection.typeId("A");
+ *      auto a = std::static_pointer_cast<A>(reflection.createInstance(id_a));
+ *      auto b = std::static_pointer_cast<B>(reflection.createInstance("B"));
+ *      @endcode
+ *      重复注册同一个类名会导致编译失败
+ * @version 1.0.0
+ * @date 2024-03-07
+ *
+ * @copyright Copyright (c) 2024
+ *
+ */
+#ifndef UTILITIES_STATICREFLECTION_H
+#define UTILITIES_STATICREFLECTION_H
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+#include <Globals/Exception.h>
+#include <TestingSupport/TestingMessageMacro.h>
+
+/// @brief 生成一条编译期注册项，注册名与类名相同
+#define STATIC_REGISTER(className)                                      \
+AntonaStandard::Utilities::makeStaticEntry<className>(#className)
+
+/// @brief 生成一条编译期注册项，使用别名注册
+#define STATIC_REGISTER_BY_OTHERNAME(className,regist_name)             \
+AntonaStandard::Utilities::makeStaticEntry<className>(#regist_name)
+
+namespace AntonaStandard{
+    namespace Utilities{
+        struct StaticReflectionEntry;
+
+        template<std::size_t N>
+        class StaticReflection;
+    }
+}
+
+namespace AntonaStandard::Utilities{
+    /// @brief 创建实例的回调函数类型
+    using StaticFactory = std::shared_ptr<void>(*)();
+
+    /// @brief 编译期注册项
+    struct StaticReflectionEntry{
+        std::string_view name;
+        StaticFactory factory;
+    };
+
+    /// @brief 创建 type_CLASS 实例的回调函数
+    template<typename type_CLASS>
+    std::shared_ptr<void> staticFactory(){
+        return std::make_shared<type_CLASS>();
+    }
+
+    /// @brief 生成注册项
+    template<typename type_CLASS>
+    constexpr StaticReflectionEntry makeStaticEntry(std::string_view name){
+        return StaticReflectionEntry{name,&staticFactory<type_CLASS>};
+    }
+
+    /**
+     * @brief 带种子的 FNV-1a 哈希
+     * @param str
+     * @param seed 种子为 0 时用于分桶，非 0 时用于定位槽位
+     * @return std::uint64_t
+     */
+    constexpr std::uint64_t staticReflectionHash(std::string_view str,std::uint64_t seed){
+        std::uint64_t hash = 14695981039346656037ULL ^ (seed * 0x9E3779B97F4A7C15ULL);
+        for(char c:str){
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 1099511628211ULL;
+        }
+        // FNV 的低位分布较差，混合一下高位
+        hash ^= hash >> 29;
+        hash *= 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    /**
+     * @brief 编译期完美哈希反射表
+     * @details
+     *      槽位数取不小于 N 的最小的 2 的幂。构造函数是 constexpr 的，声明为 constexpr 变量时整张表在编译期构造完成
+     * @tparam N 注册的类的数量
+     */
+    template<std::size_t N>
+    class StaticReflection{
+        TESTING_MESSAGE
+    public:
+        /// @brief 查找失败时 find() 的返回值
+        static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+    private:
+        static constexpr std::size_t bucketCount(){
+            return N == 0 ? 1 : N;
+        }
+        static constexpr std::size_t slotCount(){
+            std::size_t capacity = 1;
+            while(capacity < N){
+                capacity <<= 1;
+            }
+            return capacity;
+        }
+        /// @brief 单个桶搜索种子的上限，超过说明哈希函数退化
+        static constexpr std::uint32_t max_seed = 1u << 20;
+
+        /// @brief 按类型 id 存储的注册项
+        std::array<StaticReflectionEntry,N> entries;
+        /// @brief 每个桶的种子
+        std::array<std::uint32_t,bucketCount()> seeds;
+        /// @brief 槽位存储类型 id + 1，0 表示空槽
+        std::array<std::uint32_t,slotCount()> slots;
+
+        static constexpr std::size_t bucketOf(std::string_view name){
+            return staticReflectionHash(name,0) % bucketCount();
+        }
+        static constexpr std::size_t slotOf(std::string_view name,std::uint32_t seed){
+            return staticReflectionHash(name,seed) & (slotCount() - 1);
+        }
+    public:
+        /**
+         * @brief 构造完美哈希表
+         * @param list 注册项
+         * @throw AntonaStandard::Globals::Conflict_Error 重复注册了同一个类名，在编译期表现为编译错误
+         */
+        constexpr StaticReflection(const std::array<StaticReflectionEntry,N>& list):entries(list),seeds{},slots{}{
+            for(std::size_t i = 0; i < N; ++i){
+                for(std::size_t j = i + 1; j < N; ++j){
+                    if(this->entries[i].name == this->entries[j].name){
+                        throw AntonaStandard::Globals::Conflict_Error("The type name was registered more than once!");
+                    }
+                }
+            }
+            // 统计每个桶的大小，按桶从大到小的顺序分配种子，大桶越早分配越容易找到空闲槽位
+            std::array<std::size_t,bucketCount()> bucket_size{};
+            std::array<std::size_t,bucketCount()> order{};
+            for(std::size_t i = 0; i < N; ++i){
+                ++bucket_size[bucketOf(this->entries[i].name)];
+            }
+            for(std::size_t b = 0; b < bucketCount(); ++b){
+                order[b] = b;
+            }
+            // 插入排序，constexpr 环境下不能使用 std::sort
+            for(std::size_t i = 1; i < bucketCount(); ++i){
+                std::size_t current = order[i];
+                std::size_t j = i;
+                while(j > 0 && bucket_size[order[j - 1]] < bucket_size[current]){
+                    order[j] = order[j - 1];
+                    --j;
+                }
+                order[j] = current;
+            }
+            for(std::size_t k = 0; k < bucketCount() && bucket_size[order[k]] != 0; ++k){
+                std::size_t bucket = order[k];
+                std::uint32_t seed = 1;
+                while(true){
+                    if(seed >= max_seed){
+                        throw AntonaStandard::Globals::Conflict_Error("Fail to build the perfect hash table!");
+                    }
+                    // 检查桶内所有类名是否都落到空闲且互不相同的槽位
+                    bool usable = true;
+                    for(std::size_t i = 0; i < N && usable; ++i){
+                        if(bucketOf(this->entries[i].name) != bucket){
+                            continue;
+                        }
+                        std::size_t slot = slotOf(this->entries[i].name,seed);
+                        if(this->slots[slot] != 0){
+                            usable = false;
+                            break;
+                        }
+                        for(std::size_t j = 0; j < i; ++j){
+                            if(bucketOf(this->entries[j].name) == bucket && slotOf(this->entries[j].name,seed) == slot){
+                                usable = false;
+                                break;
+                            }
+                        }
+                    }
+                    if(usable){
+                        break;
+                    }
+                    ++seed;
+                }
+                this->seeds[bucket] = seed;
+                for(std::size_t i = 0; i < N; ++i){
+                    if(bucketOf(this->entries[i].name) == bucket){
+                        this->slots[slotOf(this->entries[i].name,seed)] = static_cast<std::uint32_t>(i + 1);
+                    }
+                }
+            }
+        }
+
+        /// @brief 获取注册的类的数量
+        constexpr std::size_t size()const{
+            return N;
+        }
+        /**
+         * @brief 查找类名对应的类型 id
+         * @param name
+         * @return std::size_t 类型 id，未注册时返回 npos
+         */
+        constexpr std::size_t find(std::string_view name)const{
+            if(N == 0){
+                return npos;
+            }
+            std::uint32_t slot = this->slots[slotOf(name,this->seeds[bucketOf(name)])];
+            if(slot == 0 || this->entries[slot - 1].name != name){
+                return npos;
+            }
+            return slot - 1;
+        }
+        /// @brief 判断类名是否已经注册
+        constexpr bool contains(std::string_view name)const{
+            return this->find(name) != npos;
+        }
+        /**
+         * @brief 获取类名对应的类型 id，在编译期调用时未注册的类名会导致编译错误
+         * @param name
+         * @return std::size_t
+         * @throw AntonaStandard::Globals::NotFound_Error 类名未注册
+         */
+        constexpr std::size_t typeId(std::string_view name)const{
+            std::size_t id = this->find(name);
+            if(id == npos){
+                throw AntonaStandard::Globals::NotFound_Error("The type you create was not registered!");
+            }
+            return id;
+        }
+        /// @brief 获取类型 id 对应的注册名
+        constexpr std::string_view nameOf(std::size_t id)const{
+            if(id >= N){
+                throw AntonaStandard::Globals::NotFound_Error("The type id is out of range!");
+            }
+            return this->entries[id].name;
+        }
+        /**
+         * @brief 根据类型 id 创建实例
+         * @param id
+         * @return std::shared_ptr<void>
+         * @throw AntonaStandard::Globals::NotFound_Error 类型 id 越界
+         */
+        std::shared_ptr<void> createInstance(std::size_t id)const{
+            if(id >= N){
+                throw AntonaStandard::Globals::NotFound_Error("The type id is out of range!");
+            }
+            return this->entries[id].factory();
+        }
+        /**
+         * @brief 根据类名创建实例
+         * @param name
+         * @return std::shared_ptr<void>
+         * @throw AntonaStandard::Globals::NotFound_Error 类名未注册
+         */
+        std::shared_ptr<void> createInstance(std::string_view name)const{
+            std::size_t id = this->find(name);
+            if(id == npos){
+                std::string msg = "The type you create was not registered!: ";
+                msg.append(name);
+                throw AntonaStandard::Globals::NotFound_Error(msg.c_str());
+            }
+            return this->entries[id].factory();
+        }
+        /// @brief 与 createInstance(std::string_view) 相同，避免字符串字面量匹配到 createInstance(std::size_t)
+        std::shared_ptr<void> createInstance(const char* name)const{
+            return this->createInstance(std::string_view(name));
+        }
+    };
+
+    /**
+     * @brief 由注册项构造 StaticReflection，自动推导注册数量
+     * @param entries 由 STATIC_REGISTER 或 makeStaticEntry 生成
+     */
+    template<typename... type_ENTRIES>
+    constexpr StaticReflection<sizeof...(type_ENTRIES)> makeStaticReflection(type_ENTRIES... entries){
+        return StaticReflection<sizeof...(type_ENTRIES)>(std::array<StaticReflectionEntry,sizeof...(type_ENTRIES)>{entries...});
+    }
+}
+#endif
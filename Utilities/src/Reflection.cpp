@@ -2,24 +2,22 @@
 #include <sstream>
 namespace AntonaStandard::Utilities{
     std::shared_ptr<void> Reflection::createInstance(const char* name_str){
-             // 检查key即name_str是否存在
-        if(this->func_map.count(name_str)==0){
-            // 不存在抛出异常
-            std::stringstream ss;
-            ss<<"The type you create was not registered!: "<<name_str;
-            throw AntonaStandard::Globals::NotFound_Error(ss.str().c_str());
-        }
-        return this->func_map[name_str]();              // 调用对应的回调函数
+        return this->createByName(name_str);
     }
     
     std::shared_ptr<void> Reflection::createInstance(const std::string& name_str){
-         // 检查key即name_str是否存在
-        if(this->func_map.count(name_str)==0){
+        return this->createByName(name_str);
+    }
+
+    std::shared_ptr<void> Reflection::createByName(std::string_view name_str){
+        // 只查找一次，找到后直接调用对应的回调函数
+        auto iter = this->func_map.find(name_str);
+        if(iter == this->func_map.end()){
             // 不存在抛出异常
             std::stringstream ss;
             ss<<"The type you create was not registered!: "<<name_str;
             throw AntonaStandard::Globals::NotFound_Error(ss.str().c_str());
         }
-        return this->func_map[name_str]();              // 调用对应的回调函数
+        return iter->second();
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,94 @@
+#include <Utilities/ReflectionRegistry.h>
+#include <sstream>
+
+namespace AntonaStandard::Utilities{
+    void ReflectionRegistry::Batch::registerEntry(const std::string& name,Entry entry){
+        if(!this->table.emplace(name,std::move(entry)).second){
+            std::stringstream ss;
+            ss<<"The type name was already registered!: "<<name;
+            throw AntonaStandard::Globals::Conflict_Error(ss.str().c_str());
+        }
+        this->names.push_back(name);
+    }
+
+    bool ReflectionRegistry::Batch::unregisterEntry(const std::string& name){
+        return this->table.erase(name) != 0;
+    }
+
+    ReflectionRegistry::~ReflectionRegistry(){
+        try{
+            this->unloadPlugins();
+        }
+        catch(...){
+            // 析构函数不能抛出异常
+        }
+    }
+
+    const ReflectionRegistry::Entry& ReflectionRegistry::find(const Table& table,std::string_view name)const{
+        auto iter = table.find(name);
+        if(iter == table.end()){
+            std::stringstream ss;
+            ss<<"The type you create was not registered!: "<<name;
+            throw AntonaStandard::Globals::NotFound_Error(ss.str().c_str());
+        }
+        return iter->second;
+    }
+
+    bool ReflectionRegistry::unregisterClass(const std::string& name){
+        return this->table.update([&name](Table& table){
+            return table.erase(name) != 0;
+        });
+    }
+
+    bool ReflectionRegistry::contains(std::string_view name)const{
+        auto guard = this->table.read();
+        return guard->count(name) != 0;
+    }
+
+    unsigned long ReflectionRegistry::size()const{
+        return this->table.read()->size();
+    }
+
+    std::shared_ptr<void> ReflectionRegistry::createInstance(std::string_view name)const{
+        auto guard = this->table.read();
+        return this->find(*guard,name).factory();
+    }
+
+    void ReflectionRegistry::loadPlugin(const std::string& path){
+        std::lock_guard<std::mutex> lck(this->plugin_mtx);
+        CPS::HandlePtr_t handle = CPS::loadDll(path);
+        std::vector<std::string> names;
+        try{
+            using Entry_t = void(*)(Batch*);
+            Entry_t entry = reinterpret_cast<Entry_t>(CPS::getFunc(REFLECTION_PLUGIN_ENTRY_NAME,handle));
+            names = this->batch([entry](Batch& batch){
+                entry(&batch);
+            });
+        }
+        catch(...){
+            CPS::unloadDll(handle);
+            throw;
+        }
+        this->plugins.push_back(Plugin{handle,std::move(names)});
+    }
+
+    void ReflectionRegistry::unloadPlugins(){
+        std::lock_guard<std::mutex> lck(this->plugin_mtx);
+        if(this->plugins.empty()){
+            return;
+        }
+        // 先移除插件注册的类，宽限期结束后不会再有读者调用插件中的代码
+        this->table.update([this](Table& table){
+            for(auto& plugin:this->plugins){
+                for(auto& name:plugin.names){
+                    table.erase(name);
+                }
+            }
+            return true;
+        });
+        for(auto& plugin:this->plugins){
+            CPS::unloadDll(plugin.handle);
+        }
+        this->plugins.clear();
+    }
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <Utilities/BinarySerializer.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rpc{
+    enum class Side:std::uint8_t{
+        Buy = 1,
+        Sell = 2
+    };
+    struct Point{
+        int x;
+        double y;
+    };
+    REFLECT_FIELDS(Point,x,y)
+
+    struct Order{
+        std::uint64_t id;
+        Side side;
+        std::string symbol;
+        std::vector<double> prices;
+        std::vector<std::string> tags;
+        std::array<Point,2> corners;
+        bool urgent;
+    };
+    REFLECT_FIELDS(Order,id,side,symbol,prices,tags,corners,urgent)
+}
+
+// 成员变量元数据
+TEST(Test_BinarySerializer, FieldMetadata){
+    using namespace AntonaStandard::Utilities;
+    static_assert(hasFieldMetadata_v<rpc::Point>, "Point is reflected");
+    static_assert(!hasFieldMetadata_v<int>, "int is not reflected");
+    static_assert(fieldCount<rpc::Order>() == 7, "Order has seven fields");
+    constexpr auto fields = fieldsOf<rpc::Point>();
+    static_assert(std::get<0>(fields).name == "x", "first field");
+    static_assert(std::get<1>(fields).offset == offsetof(rpc::Point, y), "offset of y");
+
+    rpc::Point point{3, 4.5};
+    std::vector<std::string> names;
+    forEachField(point, [&names](std::string_view name, auto& value){
+        names.emplace_back(name);
+        value += 1;
+    });
+    ASSERT_EQ(2, names.size());
+    EXPECT_EQ("y", names[1]);
+    EXPECT_EQ(4, point.x);
+    EXPECT_DOUBLE_EQ(5.5, point.y);
+}
+
+// 编码格式
+TEST(Test_BinarySerializer, Layout){
+    using namespace AntonaStandard::Utilities;
+    rpc::Point point{0x01020304, 0.0};
+    EXPECT_EQ(12, encodedSize(point));
+    char out[12];
+    EXPECT_EQ(12, serialize(out, point));
+    // 小端序
+    EXPECT_EQ(0x04, out[0]);
+    EXPECT_EQ(0x01, out[3]);
+
+    std::string text = "abc";
+    EXPECT_EQ(7, encodedSize(text));
+}
+
+// 通过 SocketDataBuffer 往返
+TEST(Test_BinarySerializer, RoundTrip){
+    using namespace AntonaStandard::Utilities;
+    rpc::Order order{42, rpc::Side::Sell, "ASD", {1.5, 2.5, 3.5}, {"a", "bc"}, {rpc::Point{1, 2.0}, rpc::Point{3, 4.0}}, true};
+    AntonaStandard::CPS::SocketDataBuffer buffer;
+    std::size_t written = 0;
+    // 连续写入多个对象，超过初始容量时会扩容
+    for(int i = 0; i < 20; ++i){
+        order.id = i;
+        written += serialize(buffer, order);
+    }
+    EXPECT_EQ(written, buffer.getSendableSize());
+    EXPECT_EQ(written, buffer.getReadableSize());
+
+    for(int i = 0; i < 20; ++i){
+        rpc::Order decoded{};
+        deserialize(buffer, decoded);
+        EXPECT_EQ(i, decoded.id);
+        EXPECT_EQ(rpc::Side::Sell, decoded.side);
+        EXPECT_EQ("ASD", decoded.symbol);
+        EXPECT_EQ(order.prices, decoded.prices);
+        EXPECT_EQ(order.tags, decoded.tags);
+        EXPECT_EQ(3, decoded.corners[1].x);
+        EXPECT_DOUBLE_EQ(4.0, decoded.corners[1].y);
+        EXPECT_TRUE(decoded.urgent);
+    }
+    EXPECT_EQ(0, buffer.getReadableSize());
+}
+
+// 数据不完整时抛出异常，读取位点不变
+TEST(Test_BinarySerializer, Truncated){
+    using namespace AntonaStandard::Utilities;
+    rpc::Order order{7, rpc::Side::Buy, "SYMBOL", {1.0}, {"tag"}, {}, false};
+    std::vector<char> bytes(encodedSize(order));
+    serialize(bytes.data(), order);
+
+    AntonaStandard::CPS::SocketDataBuffer buffer;
+    buffer.append(bytes.data(), bytes.size() - 1);
+    rpc::Order decoded{};
+    EXPECT_THROW(deserialize(buffer, decoded), AntonaStandard::Globals::DataCorrupted_Error);
+    EXPECT_EQ(bytes.size() - 1, buffer.getReadableSize());
+
+    buffer.append(bytes.data() + bytes.size() - 1, 1);
+    EXPECT_EQ(bytes.size(), deserialize(buffer, decoded));
+    EXPECT_EQ("SYMBOL", decoded.symbol);
+
+    // 恶意的长度前缀
+    char bad[4] = {'\xff', '\xff', '\xff', '\x7f'};
+    std::vector<std::string> strings;
+    EXPECT_THROW(deserialize(bad, sizeof(bad), strings), AntonaStandard::Globals::DataCorrupted_Error);
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <Utilities/ConcurrentDelegate.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+    std::atomic<int> invoke_times(0);
+
+    int return_one(){
+        ++invoke_times;
+        return 1;
+    }
+    int return_two(){
+        ++invoke_times;
+        return 2;
+    }
+    void add_value(int value){
+        invoke_times += value;
+    }
+
+    class Counter{
+    public:
+        int count = 0;
+        int increase(int step){
+            count += step;
+            return count;
+        }
+    };
+}
+
+// 基本的增删和调用
+TEST(Test_ConcurrentDelegate, AddRemoveInvoke){
+    using namespace AntonaStandard::Utilities;
+    ConcurrentDelegate<int()> delegate;
+    EXPECT_TRUE(delegate.empty());
+
+    delegate += newDelegate(return_one);
+    delegate += newDelegate(return_two);
+    // 重复添加会被忽略
+    delegate += newDelegate(return_one);
+    EXPECT_EQ(2, delegate.size());
+
+    auto results = delegate();
+    ASSERT_EQ(2, results.size());
+    EXPECT_EQ(1, results[0]);
+    EXPECT_EQ(2, results[1]);
+
+    delegate -= newDelegate(return_one);
+    EXPECT_EQ(1, delegate.size());
+    EXPECT_THROW(delegate -= newDelegate(return_one), AntonaStandard::Globals::NotFound_Error);
+
+    delegate.clear();
+    EXPECT_TRUE(delegate.empty());
+    EXPECT_TRUE(delegate().empty());
+}
+
+// 成员函数与 void 特化
+TEST(Test_ConcurrentDelegate, MethodAndVoid){
+    using namespace AntonaStandard::Utilities;
+    Counter counter;
+    ConcurrentDelegate<int(int)> delegate;
+    delegate += newDelegate(counter, &Counter::increase);
+    auto results = delegate(3);
+    ASSERT_EQ(1, results.size());
+    EXPECT_EQ(3, counter.count);
+
+    invoke_times = 0;
+    ConcurrentDelegate<void(int)> void_delegate;
+    void_delegate += newDelegate(add_value);
+    void_delegate(5);
+    EXPECT_EQ(5, invoke_times.load());
+}
+
+// 快照不受之后的增删影响
+TEST(Test_ConcurrentDelegate, SnapshotIsImmutable){
+    using namespace AntonaStandard::Utilities;
+    ConcurrentDelegate<int()> delegate;
+    delegate += newDelegate(return_one);
+    std::thread writer;
+    {
+        auto snapshot = delegate.snapshot();
+        writer = std::thread([&delegate](){
+            delegate += newDelegate(return_two);
+        });
+        // 写者需要等待快照释放才能返回，但新数组已经发布
+        while(delegate.size() != 2){
+            std::this_thread::yield();
+        }
+        EXPECT_EQ(1, snapshot->size());
+    }
+    writer.join();
+    EXPECT_EQ(2, delegate.size());
+}
+
+// 一边调用一边增删
+TEST(Test_ConcurrentDelegate, ConcurrentInvokeAndModify){
+    using namespace AntonaStandard::Utilities;
+    ConcurrentDelegate<int()> delegate;
+    delegate += newDelegate(return_one);
+    std::atomic<bool> stop(false);
+    std::atomic<long> observed(0);
+
+    std::vector<std::thread> readers;
+    for(int i = 0; i < 4; ++i){
+        readers.emplace_back([&](){
+            while(!stop.load()){
+                auto results = delegate();
+                // 每一次调用都只可能看到完整的数组
+                ASSERT_TRUE(results.size() == 1 || results.size() == 2);
+                EXPECT_EQ(1, results[0]);
+                observed += results.size();
+            }
+        });
+    }
+    // 等待读者开始调用，单核机器上写者可能在读者被调度之前就已经结束
+    while(observed.load() == 0){
+        std::this_thread::yield();
+    }
+    for(int i = 0; i < 2000; ++i){
+        delegate += newDelegate(return_two);
+        delegate -= newDelegate(return_two);
+    }
+    stop.store(true);
+    for(auto& reader:readers){
+        reader.join();
+    }
+    EXPECT_EQ(1, delegate.size());
+    EXPECT_GT(observed.load(), 0);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <Utilities/Delegate.h>
+#include <Utilities/ConcurrentDelegate.h>
+#include <Utilities/DelegateCombiner.h>
+#include <iterator>
+#include <vector>
+
+namespace {
+    int invoke_times = 0;
+
+    int return_one(int base){
+        ++invoke_times;
+        return base + 1;
+    }
+    int return_two(int base){
+        ++invoke_times;
+        return base + 2;
+    }
+    int return_three(int base){
+        ++invoke_times;
+        return base + 3;
+    }
+
+    class Holder{
+    public:
+        int value = 7;
+        int& get(int){
+            return value;
+        }
+    };
+}
+
+// 保留第一个和最后一个返回值
+TEST(Test_DelegateCombiner, FirstAndLast){
+    using namespace AntonaStandard::Utilities;
+    Delegate<int(int)> delegate;
+    EXPECT_FALSE(delegate.combine(FirstCombiner<int>(), 0).has_value());
+
+    delegate += newDelegate(return_one);
+    delegate += newDelegate(return_two);
+    delegate += newDelegate(return_three);
+
+    invoke_times = 0;
+    auto first = delegate.combine(FirstCombiner<int>(), 10);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(11, *first);
+    // 所有委托都被调用
+    EXPECT_EQ(3, invoke_times);
+
+    auto last = delegate.combine(LastCombiner<int>(), 10);
+    ASSERT_TRUE(last.has_value());
+    EXPECT_EQ(13, *last);
+}
+
+// 折叠与输出迭代器
+TEST(Test_DelegateCombiner, ReduceAndOutput){
+    using namespace AntonaStandard::Utilities;
+    Delegate<int(int)> delegate;
+    delegate += newDelegate(return_one);
+    delegate += newDelegate(return_two);
+    delegate += newDelegate(return_three);
+
+    long sum = delegate.combine(makeReduceCombiner(0L, [](long acc, int value){
+        return acc + value;
+    }), 1);
+    EXPECT_EQ(2 + 3 + 4, sum);
+
+    int buffer[4] = {0, 0, 0, 0};
+    int* end = delegate.combine(makeOutputCombiner(buffer), 0);
+    EXPECT_EQ(buffer + 3, end);
+    EXPECT_EQ(1, buffer[0]);
+    EXPECT_EQ(2, buffer[1]);
+    EXPECT_EQ(3, buffer[2]);
+
+    std::vector<int> results;
+    delegate.combine(makeOutputCombiner(std::back_inserter(results)), 0);
+    EXPECT_EQ(3, results.size());
+}
+
+// 满足谓词后提前退出
+TEST(Test_DelegateCombiner, EarlyExit){
+    using namespace AntonaStandard::Utilities;
+    Delegate<int(int)> delegate;
+    delegate += newDelegate(return_one);
+    delegate += newDelegate(return_two);
+    delegate += newDelegate(return_three);
+
+    invoke_times = 0;
+    auto found = delegate.combine(makeUntilCombiner<int>([](int value){
+        return value % 2 == 0;
+    }), 0);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(2, *found);
+    // 第三个委托不会被调用
+    EXPECT_EQ(2, invoke_times);
+
+    auto not_found = delegate.combine(makeUntilCombiner<int>([](int value){
+        return value > 100;
+    }), 0);
+    EXPECT_FALSE(not_found.has_value());
+}
+
+// 返回引用的委托
+TEST(Test_DelegateCombiner, ReferenceReturn){
+    using namespace AntonaStandard::Utilities;
+    Holder holder;
+    Delegate<int&(int)> delegate;
+    delegate += newDelegate(holder, &Holder::get);
+    auto last = delegate.combine(LastCombiner<int>(), 0);
+    ASSERT_TRUE(last.has_value());
+    EXPECT_EQ(7, *last);
+}
+
+// 线程安全的委托同样支持合并策略
+TEST(Test_DelegateCombiner, ConcurrentDelegate){
+    using namespace AntonaStandard::Utilities;
+    ConcurrentDelegate<int(int)> delegate;
+    delegate += newDelegate(return_one);
+    delegate += newDelegate(return_two);
+
+    auto last = delegate.combine(LastCombiner<int>(), 0);
+    ASSERT_TRUE(last.has_value());
+    EXPECT_EQ(2, *last);
+
+    int sum = delegate.combine(makeReduceCombiner(0, [](int acc, int value){
+        return acc + value;
+    }), 0);
+    EXPECT_EQ(3, sum);
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <Utilities/Reflection.h>
+#include <Utilities/StaticReflection.h>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    class A{
+    public:
+        int value = 1;
+    };
+    class B{
+    public:
+        int value = 2;
+    };
+    class C{
+    public:
+        int value = 3;
+    };
+
+    class Message{
+    public:
+        static std::atomic<int> alive;
+        long payload[4] = {0, 0, 0, 0};
+        Message(){++alive;};
+        ~Message(){--alive;};
+    };
+    std::atomic<int> Message::alive(0);
+
+    class Factory:public AntonaStandard::Utilities::Reflection{
+    public:
+        Factory():Reflection(){this->load();};
+        virtual void load()override{
+            INIT;
+            REGISTER(A);
+            REGISTER(B);
+            REGISTER_POOLED(Message);
+        }
+    };
+
+    constexpr auto static_reflection = AntonaStandard::Utilities::makeStaticReflection(
+        STATIC_REGISTER(A),
+        STATIC_REGISTER(B),
+        STATIC_REGISTER_BY_OTHERNAME(C,Message)
+    );
+}
+
+// 运行时注册的反射
+TEST(Test_Reflection, Basic){
+    Factory factory;
+    std::string name = "B";
+    EXPECT_EQ(1, std::static_pointer_cast<A>(factory.createInstance("A"))->value);
+    EXPECT_EQ(2, std::static_pointer_cast<B>(factory.createInstance(name))->value);
+    EXPECT_THROW(factory.createInstance("C"), AntonaStandard::Globals::NotFound_Error);
+}
+
+// 编译期求出类型 id
+TEST(Test_Reflection, StaticTypeId){
+    constexpr std::size_t id_a = static_reflection.typeId("A");
+    constexpr std::size_t id_message = static_reflection.typeId("Message");
+    static_assert(id_a == 0, "type id follows registration order");
+    static_assert(id_message == 2, "type id follows registration order");
+    static_assert(static_reflection.size() == 3, "three types registered");
+    static_assert(!static_reflection.contains("C"), "only the alias is registered");
+    static_assert(static_reflection.nameOf(1) == "B", "name of type id");
+
+    EXPECT_EQ(1, std::static_pointer_cast<A>(static_reflection.createInstance(id_a))->value);
+    EXPECT_EQ(3, std::static_pointer_cast<C>(static_reflection.createInstance(id_message))->value);
+    EXPECT_THROW(static_reflection.createInstance(std::size_t(3)), AntonaStandard::Globals::NotFound_Error);
+}
+
+// 按类名查找
+TEST(Test_Reflection, StaticLookup){
+    std::string name = "B";
+    EXPECT_EQ(2, std::static_pointer_cast<B>(static_reflection.createInstance(name))->value);
+    EXPECT_EQ(1, std::static_pointer_cast<A>(static_reflection.createInstance("A"))->value);
+    EXPECT_THROW(static_reflection.createInstance("C"), AntonaStandard::Globals::NotFound_Error);
+    EXPECT_THROW(static_reflection.createInstance(""), AntonaStandard::Globals::NotFound_Error);
+    EXPECT_THROW(static_reflection.typeId("AB"), AntonaStandard::Globals::NotFound_Error);
+}
+
+// 大量注册时每个类名都能被找到
+TEST(Test_Reflection, StaticManyEntries){
+    using namespace AntonaStandard::Utilities;
+    constexpr auto reflection = makeStaticReflection(
+        STATIC_REGISTER_BY_OTHERNAME(A,Login), STATIC_REGISTER_BY_OTHERNAME(A,Logout),
+        STATIC_REGISTER_BY_OTHERNAME(A,Heartbeat), STATIC_REGISTER_BY_OTHERNAME(A,Ping),
+        STATIC_REGISTER_BY_OTHERNAME(A,Pong), STATIC_REGISTER_BY_OTHERNAME(A,Subscribe),
+        STATIC_REGISTER_BY_OTHERNAME(A,Unsubscribe), STATIC_REGISTER_BY_OTHERNAME(A,Publish),
+        STATIC_REGISTER_BY_OTHERNAME(A,Ack), STATIC_REGISTER_BY_OTHERNAME(A,Nack),
+        STATIC_REGISTER_BY_OTHERNAME(A,Order), STATIC_REGISTER_BY_OTHERNAME(A,Cancel),
+        STATIC_REGISTER_BY_OTHERNAME(A,Trade), STATIC_REGISTER_BY_OTHERNAME(A,Quote),
+        STATIC_REGISTER_BY_OTHERNAME(A,Snapshot), STATIC_REGISTER_BY_OTHERNAME(A,Reject),
+        STATIC_REGISTER_BY_OTHERNAME(A,Status)
+    );
+    for(std::size_t id = 0; id < reflection.size(); ++id){
+        EXPECT_EQ(id, reflection.find(reflection.nameOf(id)));
+    }
+    EXPECT_EQ(reflection.npos, reflection.find("Unknown"));
+}
+
+// 重复注册在运行期构造时抛出异常，在编译期构造时无法通过编译
+TEST(Test_Reflection, StaticDuplicate){
+    using namespace AntonaStandard::Utilities;
+    EXPECT_THROW(makeStaticReflection(STATIC_REGISTER(A), STATIC_REGISTER_BY_OTHERNAME(B,A)), AntonaStandard::Globals::Conflict_Error);
+}
+
+// 类型化的独占句柄从对象池中分配，释放后复用
+TEST(Test_Reflection, TypedPooledInstance){
+    using namespace AntonaStandard::Utilities;
+    Factory factory;
+    Message* first_address = nullptr;
+    {
+        PooledPtr<Message> message = factory.createInstance<Message>("Message");
+        first_address = message.get();
+        EXPECT_EQ(1, Message::alive);
+    }
+    EXPECT_EQ(0, Message::alive);
+    auto message = factory.createInstance<Message>("Message");
+    EXPECT_EQ(first_address, message.get());
+
+    // 普通注册的类同样可以创建类型化句柄
+    EXPECT_EQ(1, factory.createInstance<A>("A")->value);
+    // 类型不匹配和未注册
+    EXPECT_THROW(factory.createInstance<B>("A"), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(factory.createInstance<A>("C"), AntonaStandard::Globals::NotFound_Error);
+}
+
+// REGISTER_POOLED 注册的类通过 shared_ptr 创建时同样回收复用
+TEST(Test_Reflection, PooledSharedInstance){
+    Factory factory;
+    void* first_address = nullptr;
+    {
+        auto message = factory.createInstance("Message");
+        first_address = message.get();
+        EXPECT_EQ(1, Message::alive);
+    }
+    EXPECT_EQ(0, Message::alive);
+    auto message = factory.createInstance("Message");
+    EXPECT_EQ(first_address, message.get());
+}
+
+// 多线程创建和释放
+TEST(Test_Reflection, PooledConcurrent){
+    using namespace AntonaStandard::Utilities;
+    Factory factory;
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t){
+        threads.emplace_back([&factory](){
+            std::vector<PooledPtr<Message>> messages;
+            for(int round = 0; round < 100; ++round){
+                for(int i = 0; i < 50; ++i){
+                    messages.push_back(factory.createInstance<Message>("Message"));
+                }
+                messages.clear();
+            }
+        });
+    }
+    for(auto& thread:threads){
+        thread.join();
+    }
+    EXPECT_EQ(0, Message::alive);
+    auto& pool = ObjectPool<Message>::instance();
+    EXPECT_EQ(pool.capacity(), pool.available());
+}
@@ -0,0 +1,22 @@
+#include <Utilities/ReflectionRegistry.h>
+#include "PluginInterface.h"
+
+namespace {
+    class PluginMessage:public PluginInterface{
+    public:
+        virtual int id()override{
+            return 42;
+        }
+    };
+    class PluginOrder:public PluginInterface{
+    public:
+        virtual int id()override{
+            return 7;
+        }
+    };
+}
+
+REFLECTION_PLUGIN_ENTRY(batch){
+    batch->registerClass<PluginMessage>("PluginMessage");
+    batch->registerPooledClass<PluginOrder>("PluginOrder");
+}
@@ -0,0 +1,11 @@
+#ifndef TEST_REFLECTIONREGISTRY_PLUGININTERFACE_H
+#define TEST_REFLECTIONREGISTRY_PLUGININTERFACE_H
+
+// 插件中的类实现的接口
+class PluginInterface{
+public:
+    virtual ~PluginInterface() = default;
+    virtual int id() = 0;
+};
+
+#endif
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <Utilities/ReflectionRegistry.h>
+#include "PluginInterface.h"
+#include <atomic>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace {
+    class A{
+    public:
+        int value = 1;
+    };
+    class B{
+    public:
+        int value = 2;
+    };
+}
+
+// 注册、创建和移除
+TEST(Test_ReflectionRegistry, RegisterAndCreate){
+    using namespace AntonaStandard::Utilities;
+    ReflectionRegistry registry;
+    registry.registerClass<A>("A");
+    registry.registerPooledClass<B>("B");
+    EXPECT_EQ(2, registry.size());
+    EXPECT_TRUE(registry.contains("A"));
+
+    EXPECT_EQ(1, std::static_pointer_cast<A>(registry.createInstance("A"))->value);
+    EXPECT_EQ(2, std::static_pointer_cast<B>(registry.createInstance("B"))->value);
+    EXPECT_EQ(2, registry.createInstance<B>("B")->value);
+    EXPECT_THROW(registry.createInstance<A>("B"), AntonaStandard::Globals::WrongArgument_Error);
+    EXPECT_THROW(registry.createInstance("C"), AntonaStandard::Globals::NotFound_Error);
+    // 以 std::string_view 查找，名称不需要以 '\0' 结尾
+    std::string_view names = "AB";
+    EXPECT_TRUE(registry.contains(names.substr(1)));
+    EXPECT_EQ(1, std::static_pointer_cast<A>(registry.createInstance(names.substr(0, 1)))->value);
+    EXPECT_THROW(registry.registerClass<B>("A"), AntonaStandard::Globals::Conflict_Error);
+
+    EXPECT_TRUE(registry.unregisterClass("A"));
+    EXPECT_FALSE(registry.unregisterClass("A"));
+    EXPECT_FALSE(registry.contains("A"));
+}
+
+// 一批注册中有冲突时整批都不生效
+TEST(Test_ReflectionRegistry, BatchIsAtomic){
+    using namespace AntonaStandard::Utilities;
+    ReflectionRegistry registry;
+    registry.registerClass<A>("A");
+    EXPECT_THROW(registry.batch([](ReflectionRegistry::Batch& batch){
+        batch.registerClass<B>("B");
+        batch.registerClass<B>("A");
+    }), AntonaStandard::Globals::Conflict_Error);
+    EXPECT_EQ(1, registry.size());
+    EXPECT_FALSE(registry.contains("B"));
+
+    auto names = registry.batch([](ReflectionRegistry::Batch& batch){
+        batch.registerClass<B>("B");
+        batch.registerClass<B>("B2");
+    });
+    EXPECT_EQ(2, names.size());
+    EXPECT_EQ(3, registry.size());
+}
+
+// 一边创建实例一边注册
+TEST(Test_ReflectionRegistry, ConcurrentCreateAndRegister){
+    using namespace AntonaStandard::Utilities;
+    ReflectionRegistry registry;
+    registry.registerClass<A>("A");
+    std::atomic<bool> stop(false);
+    std::atomic<long> created(0);
+    std::vector<std::thread> readers;
+    for(int i = 0; i < 4; ++i){
+        readers.emplace_back([&](){
+            while(!stop.load()){
+                auto a = std::static_pointer_cast<A>(registry.createInstance("A"));
+                EXPECT_EQ(1, a->value);
+                ++created;
+            }
+        });
+    }
+    // 等待读者开始创建实例，单核机器上注册可能在读者被调度之前就已经结束
+    while(created.load() == 0){
+        std::this_thread::yield();
+    }
+    for(int i = 0; i < 200; ++i){
+        registry.registerClass<B>("B" + std::to_string(i));
+    }
+    stop.store(true);
+    for(auto& reader:readers){
+        reader.join();
+    }
+    EXPECT_EQ(201, registry.size());
+    EXPECT_GT(created.load(), 0);
+}
+
+// 从插件中注册
+TEST(Test_ReflectionRegistry, LoadPlugin){
+    using namespace AntonaStandard::Utilities;
+    ReflectionRegistry registry;
+    registry.registerClass<A>("A");
+    registry.loadPlugin(PLUGIN_PATH);
+    EXPECT_EQ(3, registry.size());
+    {
+        auto message = std::static_pointer_cast<PluginInterface>(registry.createInstance("PluginMessage"));
+        EXPECT_EQ(42, message->id());
+        auto order = std::static_pointer_cast<PluginInterface>(registry.createInstance("PluginOrder"));
+        EXPECT_EQ(7, order->id());
+    }
+    // 再次加载会与已有的类名冲突，注册表保持不变
+    EXPECT_THROW(registry.loadPlugin(PLUGIN_PATH), AntonaStandard::Globals::Conflict_Error);
+    EXPECT_EQ(3, registry.size());
+
+    registry.unloadPlugins();
+    EXPECT_EQ(1, registry.size());
+    EXPECT_FALSE(registry.contains("PluginMessage"));
+    EXPECT_THROW(registry.loadPlugin("./not_exist_plugin.so"), AntonaStandard::Globals::FailToLoadDll_Error);
+}